@@ -66,6 +66,8 @@ typedef union _LARGE_INTEGER {
 #define READ_FILE(fd, buf, size, b_read, ret) do { b_read = read((fd), (buf), (size)); ret = (b_read >= 0); } while (false)
 #define CLOSE_FILE(fd) close((fd))
 #define LSEEK(fd, off, flag) lseek((fd), (off.QuadPart), (flag))
+// same as LSEEK, but off receives the new file position (as on Windows)
+#define SEEK_FILE(fd, off, flag) ((off).QuadPart = lseek((fd), ((off).QuadPart), (flag)))
 #define FOPEN(res, path, mode) ({ res = fopen((path), (mode)); })
 #define SPRINTF(buffer, format, ...) sprintf((buffer), (format), ##__VA_ARGS__)
 
@@ -76,6 +78,15 @@ typedef union _LARGE_INTEGER {
    ret;                                                            \
    })
 
+#define RESERVE_MEMORY(size)                                       \
+  ({ void *ret = mmap(nullptr, (size), PROT_NONE,                  \
+       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);        \
+   (MAP_FAILED == ret) ? nullptr : ret;                            \
+   })
+#define COMMIT_MEMORY(addr, size) (0 == mprotect((addr), (size), PROT_READ | PROT_WRITE))
+#define DECOMMIT_MEMORY(addr, size) (0 == madvise((addr), (size), MADV_DONTNEED))
+#define RELEASE_MEMORY(addr, size) munmap((addr), (size))
+
 #include <pthread.h>
 typedef pthread_t THREAD_T;
 struct event_t {
@@ -166,11 +177,17 @@ typedef HANDLE MAPPING_HANDLE;
 #define READ_FILE(fd, buf, size, read, ret) do { ret = ReadFile((fd), (buf), (size), &(read), nullptr); } while (false)
 #define CLOSE_FILE(fd) CloseHandle(fd)
 #define LSEEK(fd, off, flag) SetFilePointerEx((fd), (off), &(off), (flag))
+#define SEEK_FILE(fd, off, flag) SetFilePointerEx((fd), (off), &(off), (flag))
 #define FOPEN(res, path, mode) fopen_s(&(res), (path), (mode))
 #define SPRINTF(buffer, format, ...) sprintf_s((buffer), (format), ##__VA_ARGS__)
 
 #define MAP_FILE_RWX(file, size) CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_EXECUTE_READWRITE, 0, (size), (file))
 
+#define RESERVE_MEMORY(size) VirtualAlloc(nullptr, (size), MEM_RESERVE, PAGE_NOACCESS)
+#define COMMIT_MEMORY(addr, size) (nullptr != VirtualAlloc((addr), (size), MEM_COMMIT, PAGE_READWRITE))
+#define DECOMMIT_MEMORY(addr, size) (FALSE != VirtualFree((addr), (size), MEM_DECOMMIT))
+#define RELEASE_MEMORY(addr, size) VirtualFree((addr), 0, MEM_RELEASE)
+
 #define GET_CURRENT_PROC() GetCurrentProcess()
 
 // manual dynamic loading
@@ -1,5 +1,6 @@
 #include "CommonExecutionController.h"
 #include "../revtracer/DebugPrintFlags.h"
+#include "../ipclib/DebugLog.h"
 #include "../CommonCrossPlatform/Common.h"
 #include <iostream>
 
@@ -130,6 +131,12 @@ CommonExecutionController::CommonExecutionController() {
 	trackCb = nullptr;
 	markCb = nullptr;
 	symbCb = nullptr;
+	symbStreamCb = nullptr;
+
+	translationCache = nullptr;
+	translationCacheSize = 0;
+
+	debugMask = DEBUG_LOG_ALL_STAGES;
 }
 
 int CommonExecutionController::GetState() const {
@@ -183,6 +190,23 @@ void CommonExecutionController::SetSymbolicHandler(rev::SymbolicHandlerFunc symb
 	symbCb = symb;
 }
 
+void CommonExecutionController::SetSymbolicStreamHandler(rev::SymbolicStreamHandlerFunc symbStream) {
+	symbStreamCb = symbStream;
+}
+
+void CommonExecutionController::SetTranslationCache(void *buffer, unsigned int size) {
+	translationCache = buffer;
+	translationCacheSize = size;
+}
+
+void CommonExecutionController::SetDebugMask(unsigned int mask) {
+	debugMask = mask;
+}
+
+bool CommonExecutionController::TraceThread(void *threadProc, void *param) {
+	return false;
+}
+
 unsigned int CommonExecutionController::ExecutionBegin(void *address, void *cbCtx) {
 	execState = SUSPENDED_AT_START;
 	return observer->ExecutionBegin(cbCtx, address);
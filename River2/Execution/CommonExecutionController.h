@@ -69,6 +69,12 @@ protected:
 	rev::TrackCallbackFunc trackCb;
 	rev::MarkCallbackFunc markCb;
 	rev::SymbolicHandlerFunc symbCb;
+	rev::SymbolicStreamHandlerFunc symbStreamCb;
+
+	void *translationCache;
+	unsigned int translationCacheSize;
+
+	unsigned int debugMask;
 
 	static const rev::RevtracerVersion supportedVersion;
 public :
@@ -82,6 +88,10 @@ public :
 	virtual void SetExecutionObserver(ExecutionObserver *obs);
 	virtual void SetTrackingObserver(rev::TrackCallbackFunc track, rev::MarkCallbackFunc mark);
 	virtual void SetSymbolicHandler(rev::SymbolicHandlerFunc symb);
+	virtual void SetSymbolicStreamHandler(rev::SymbolicStreamHandlerFunc symbStream);
+	virtual void SetTranslationCache(void *buffer, unsigned int size);
+	virtual void SetDebugMask(unsigned int mask);
+	virtual bool TraceThread(void *threadProc, void *param);
 
 	virtual unsigned int ExecutionBegin(void *address, void *cbCtx);
 	virtual unsigned int ExecutionControl(void *address, void *cbCtx);
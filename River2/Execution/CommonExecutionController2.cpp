@@ -110,6 +110,9 @@ nodep::DWORD ErrorHandlerFunc(void *context, void *userContext, rev::RevtracerEr
 			case RIVER_DISASSEMBLER_ID:
 				exec->DebugPrintf(PRINT_ERROR, "Translation step: Disassembler\n");
 				break;
+			case RIVER_ASSEMBLER_ID:
+				exec->DebugPrintf(PRINT_ERROR, "Translation step: Assembler\n");
+				break;
 			default:
 				exec->DebugPrintf(PRINT_ERROR, "Translation step: unknown\n");
 
@@ -46,6 +46,11 @@ typedef void *ADDR_TYPE;
 #define EXECUTION_FEATURE_TRACKING				0x00000002
 #define EXECUTION_FEATURE_ADVANCED_TRACKING		0x00000004 // never use this flag --- use _SYMBOLIC instead
 #define EXECUTION_FEATURE_SYMBOLIC				EXECUTION_FEATURE_TRACKING | EXECUTION_FEATURE_ADVANCED_TRACKING
+#define EXECUTION_FEATURE_SYMBOLIC_STREAM		0x00000008 // use together with _SYMBOLIC, see SetSymbolicStreamHandler
+#define EXECUTION_FEATURE_BULK_REP				0x00000010 // single step rep movs/stos, ignored with _SYMBOLIC
+#define EXECUTION_FEATURE_PEEPHOLE				0x00000020 // optimize the instrumented code of each basic block
+#define EXECUTION_FEATURE_SUPERBLOCK			0x00000040 // the branch handler only sees superblock exits, ignored with _REVERSIBLE or _TRACKING
+#define EXECUTION_FEATURE_SPECULATIVE			0x00000080 // translate likely successors on a background thread (in-process execution only)
 
 #define EXECUTION_ADVANCE					0x00000000
 #define EXECUTION_BACKTRACK					0x00000001
@@ -149,6 +154,15 @@ public:
 	virtual void SetExecutionObserver(ExecutionObserver *obs) = 0;
 	virtual void SetTrackingObserver(rev::TrackCallbackFunc track, rev::MarkCallbackFunc mark) = 0;
 	virtual void SetSymbolicHandler(rev::SymbolicHandlerFunc symb) = 0;
+	virtual void SetSymbolicStreamHandler(rev::SymbolicStreamHandlerFunc symbStream) = 0;
+	// buffer is a shared mapping of the translation cache file, zero filled when the file is new (in-process execution only)
+	virtual void SetTranslationCache(void *buffer, unsigned int size) = 0;
+	// DEBUG_LOG_STAGE bits of the tracer messages written in the debug log, all of them by default (external execution only)
+	virtual void SetDebugMask(unsigned int mask) = 0;
+
+	// traces threadProc(param) on a new thread, with its own execution environment (in-process execution only, see rev::TraceThread)
+	// only valid once the execution has begun, WaitForTermination also waits for these threads
+	virtual bool TraceThread(void *threadProc, void *param) = 0;
 
 	virtual unsigned int ExecutionBegin(void *address, void *cbCtx) = 0;
 	virtual unsigned int ExecutionControl(void *address, void *cbCtx) = 0;
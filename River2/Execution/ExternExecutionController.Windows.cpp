@@ -174,6 +174,7 @@ bool ExternExecutionController::InitializeRevtracer() {
 #endif
 
 	revtracer.pImports->dbgPrintFunc = (rev::DbgPrintFunc)ipc.pExports->debugPrint;
+	*ipc.pExports->debugMask = debugMask;
 
 	/* Memory management function */
 	revtracer.pImports->memoryAllocFunc = ipc.pExports->memoryAlloc;
@@ -207,6 +208,10 @@ bool ExternExecutionController::InitializeRevtracer() {
 		revtracer.pImports->symbolicHandler = symbCb;
 	}
 
+	if (nullptr != symbStreamCb) {
+		revtracer.pImports->symbolicStreamHandler = symbStreamCb;
+	}
+
 	gfe = revtracer.pExports->getFirstEsp;
 	gcr = revtracer.pExports->getCurrentRegisters;
 	gmi = revtracer.pExports->getMemoryInfo;
@@ -217,6 +222,9 @@ bool ExternExecutionController::InitializeRevtracer() {
 	InitSegments(hMainThread, revtracer.pConfig->segmentOffsets);
 	revtracer.pConfig->hookCount = 0;
 	revtracer.pConfig->featureFlags = featureFlags;
+	// the translation cache mapping belongs to this process
+	revtracer.pConfig->translationCache = nullptr;
+	revtracer.pConfig->translationCacheSize = 0;
 	//revtracer.pConfig->sCons = symbolicConstructor;
 
 #ifdef DUMP_BLOCKS
@@ -7,6 +7,9 @@
 
 #ifdef __linux__
 #include <string.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/uio.h>
 #endif
 
 #ifdef __linux__
@@ -142,6 +145,121 @@ DWORD __stdcall ThreadProc(LPVOID p) {
 }
 #endif
 
+/* Background translation threads of the tracer (EXECUTION_FEATURE_SPECULATIVE) */
+struct TracerThreadParam {
+	rev::ThreadProcFunc proc;
+	void *param;
+};
+
+#ifdef __linux__
+void *TracerThreadProc(void *p) {
+	TracerThreadParam *ttp = (TracerThreadParam *)p;
+	ttp->proc(ttp->param);
+	delete ttp;
+	return nullptr;
+}
+#else
+DWORD __stdcall TracerThreadProc(LPVOID p) {
+	TracerThreadParam *ttp = (TracerThreadParam *)p;
+	ttp->proc(ttp->param);
+	delete ttp;
+	return 0;
+}
+#endif
+
+/* Guest thread routines traced with their own execution environment (TraceThread) */
+struct TracedThreadParam {
+	InprocessExecutionController *ctrl;
+	void *proc;
+	void *param;
+};
+
+#ifdef __linux__
+void *TracedThreadProc(void *p) {
+	TracedThreadParam *ttp = (TracedThreadParam *)p;
+	ttp->ctrl->TracedThread(ttp->proc, ttp->param);
+	delete ttp;
+	return nullptr;
+}
+#else
+DWORD __stdcall TracedThreadProc(LPVOID p) {
+	TracedThreadParam *ttp = (TracedThreadParam *)p;
+	DWORD ret = ttp->ctrl->TracedThread(ttp->proc, ttp->param);
+	delete ttp;
+	return ret;
+}
+#endif
+
+bool TracerCreateThread(rev::ThreadProcFunc proc, void *param) {
+	TracerThreadParam *ttp = new TracerThreadParam;
+	ttp->proc = proc;
+	ttp->param = param;
+
+	THREAD_T tid;
+	int ret;
+	CREATE_THREAD(tid, TracerThreadProc, ttp, ret);
+	if (!ret) {
+		delete ttp;
+		return false;
+	}
+
+	// the tracer waits for its threads on its own
+#ifdef __linux__
+	pthread_detach(tid);
+#else
+	CloseHandle(tid);
+#endif
+	return true;
+}
+
+void TracerYieldExecution() {
+#ifdef __linux__
+	sched_yield();
+#else
+	SwitchToThread();
+#endif
+}
+
+// used by the background translation thread before it decodes guest code
+bool TracerIsReadable(ADDR_TYPE addr, nodep::DWORD size) {
+#ifdef __linux__
+	// process_vm_readv fails with EFAULT instead of raising a signal
+	char buff[0x1000];
+	char *ptr = (char *)addr;
+
+	while (size > 0) {
+		nodep::DWORD chunk = (size < sizeof(buff)) ? size : sizeof(buff);
+		struct iovec local = { buff, chunk };
+		struct iovec remote = { ptr, chunk };
+
+		if ((ssize_t)chunk != process_vm_readv(getpid(), &local, 1, &remote, 1, 0)) {
+			return false;
+		}
+
+		ptr += chunk;
+		size -= chunk;
+	}
+	return true;
+#else
+	char *ptr = (char *)addr;
+	char *end = ptr + size;
+
+	while (ptr < end) {
+		MEMORY_BASIC_INFORMATION mbi;
+		if (0 == VirtualQuery(ptr, &mbi, sizeof(mbi))) {
+			return false;
+		}
+
+		if ((MEM_COMMIT != mbi.State) || (mbi.Protect & (PAGE_NOACCESS | PAGE_GUARD))) {
+			return false;
+		}
+
+		ptr = (char *)mbi.BaseAddress + mbi.RegionSize;
+	}
+	return true;
+#endif
+}
+
 //unsigned int BranchHandler(void *context, void *userContext, void *nextInstruction);
 void SyscallControlFunc(void *context, void *userContext);
 
@@ -213,6 +331,14 @@ bool InprocessExecutionController::Execute() {
 		revtracer.pImports->symbolicHandler = symbCb;
 	}
 
+	if (nullptr != symbStreamCb) {
+		revtracer.pImports->symbolicStreamHandler = symbStreamCb;
+	}
+
+	revtracer.pImports->createThread = TracerCreateThread;
+	revtracer.pImports->yieldExecution = TracerYieldExecution;
+	revtracer.pImports->isReadable = TracerIsReadable;
+
     // Comentarii aici
 	wrapper.pImports = (revwrapper::WrapperImports *)GET_PROC_ADDRESS(wrapper.module, wrapper.base, "wrapperImports");
 	wrapper.pExports = (revwrapper::WrapperExports *)GET_PROC_ADDRESS(wrapper.module, wrapper.base, "wrapperExports");
@@ -248,6 +374,8 @@ bool InprocessExecutionController::Execute() {
 	revtracer.pConfig->featureFlags = featureFlags;
 	revtracer.pConfig->context = this;
 	revtracer.pConfig->hookCount = 0;
+	revtracer.pConfig->translationCache = translationCache;
+	revtracer.pConfig->translationCacheSize = translationCacheSize;
 
     // Comentarii aici    
 	revtracerInitialize = (InitializeFunc)GET_PROC_ADDRESS(revtracer.module, revtracer.base, "Initialize");
@@ -277,9 +405,43 @@ DWORD InprocessExecutionController::ControlThread() {
 	return 0;
 }
 
+bool InprocessExecutionController::TraceThread(void *threadProc, void *param) {
+	// the tracer is initialized on the control thread, before the execution begins
+	if ((NEW == execState) || (INITIALIZED == execState) || (TERMINATED == execState)) {
+		return false;
+	}
+
+	TracedThreadParam *ttp = new TracedThreadParam;
+	ttp->ctrl = this;
+	ttp->proc = threadProc;
+	ttp->param = param;
+
+	THREAD_T tid;
+	int ret;
+	CREATE_THREAD(tid, TracedThreadProc, ttp, ret);
+	if (!ret) {
+		delete ttp;
+		return false;
+	}
+
+	tracedThreads.push_back(tid);
+	return true;
+}
+
+DWORD InprocessExecutionController::TracedThread(void *threadProc, void *param) {
+	return revtracer.pExports->traceThread((rev::ADDR_TYPE)threadProc, param);
+}
+
 bool InprocessExecutionController::WaitForTermination() {
 	int ret;
 	JOIN_THREAD(hThread, ret);
+
+	for (auto it = tracedThreads.begin(); it != tracedThreads.end(); ++it) {
+		int tret;
+		JOIN_THREAD(*it, tret);
+		ret = ret && tret;
+	}
+	tracedThreads.clear();
 	return TRUE == ret;
 }
 
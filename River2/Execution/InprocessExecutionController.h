@@ -15,6 +15,9 @@ class InprocessExecutionController : public CommonExecutionController {
 private :
 	THREAD_T hThread;
 
+	// threads started with TraceThread, joined by WaitForTermination
+	std::vector<THREAD_T> tracedThreads;
+
 	ext::LibraryLayout libLayout, **expLayout;
 	
 	struct {
@@ -49,6 +52,9 @@ public :
 
 	virtual bool Execute();
 	virtual bool WaitForTermination();
+
+	virtual bool TraceThread(void *threadProc, void *param);
+	DWORD TracedThread(void *threadProc, void *param);
 };
 
 #endif
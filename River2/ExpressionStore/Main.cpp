@@ -0,0 +1,200 @@
+#include <stdio.h>
+
+#include "../SymbolicEnvironment/ExpressionStore.h"
+
+using namespace sym;
+
+int failures = 0;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			failures++; \
+		} \
+	} while (0)
+
+static bool IsConst(const Expression *expr, nodep::DWORD value, nodep::DWORD bits) {
+	return (EXPR_CONST == expr->kind) && (value == expr->value) && (bits == expr->bits);
+}
+
+void TestHashConsing() {
+	ExpressionStore store;
+
+	Expression *x = store.MakeVariable("x", 32);
+	Expression *y = store.MakeVariable("y", 32);
+
+	CHECK(store.MakeConst(5, 32) == store.MakeConst(5, 32));
+	CHECK(store.MakeConst(5, 32) != store.MakeConst(5, 16));
+	CHECK(store.MakeBinary(EXPR_SUB, x, y) == store.MakeBinary(EXPR_SUB, x, y));
+	CHECK(store.MakeBinary(EXPR_SUB, x, y) != store.MakeBinary(EXPR_SUB, y, x));
+
+	// commutative operations share a node regardless of operand order
+	CHECK(store.MakeBinary(EXPR_ADD, x, y) == store.MakeBinary(EXPR_ADD, y, x));
+	CHECK(store.MakeBinary(EXPR_EQ, x, y) == store.MakeBinary(EXPR_EQ, y, x));
+
+	Expression *c = store.MakeConst(7, 32);
+	Expression *a = store.MakeBinary(EXPR_AND, c, x);
+	CHECK(a == store.MakeBinary(EXPR_AND, x, c));
+	CHECK(a->operands[1] == c);
+}
+
+void TestConstantFolding() {
+	ExpressionStore store;
+
+	CHECK(IsConst(store.MakeBinary(EXPR_ADD, store.MakeConst(0xFFFFFFFF, 32), store.MakeConst(2, 32)), 1, 32));
+	CHECK(IsConst(store.MakeBinary(EXPR_SUB, store.MakeConst(1, 8), store.MakeConst(2, 8)), 0xFF, 8));
+	CHECK(IsConst(store.MakeBinary(EXPR_MUL, store.MakeConst(0x10, 8), store.MakeConst(0x10, 8)), 0, 8));
+	CHECK(IsConst(store.MakeBinary(EXPR_SHL, store.MakeConst(1, 32), store.MakeConst(32, 32)), 0, 32));
+	CHECK(IsConst(store.MakeBinary(EXPR_ASHR, store.MakeConst(0x80, 8), store.MakeConst(3, 8)), 0xF0, 8));
+	CHECK(IsConst(store.MakeBinary(EXPR_ASHR, store.MakeConst(0x80, 8), store.MakeConst(9, 8)), 0xFF, 8));
+	CHECK(IsConst(store.MakeBinary(EXPR_ULT, store.MakeConst(0xFF, 8), store.MakeConst(1, 8)), 0, 1));
+	CHECK(IsConst(store.MakeBinary(EXPR_SLT, store.MakeConst(0xFF, 8), store.MakeConst(1, 8)), 1, 1));
+
+	CHECK(IsConst(store.MakeUnary(EXPR_NOT, store.MakeConst(0x0F, 8)), 0xF0, 8));
+	CHECK(IsConst(store.MakeUnary(EXPR_NEG, store.MakeConst(1, 16)), 0xFFFF, 16));
+
+	CHECK(IsConst(store.MakeExtend(EXPR_SEXT, store.MakeConst(0x80, 8), 32), 0xFFFFFF80, 32));
+	CHECK(IsConst(store.MakeExtend(EXPR_ZEXT, store.MakeConst(0x80, 8), 32), 0x80, 32));
+	CHECK(IsConst(store.MakeExtract(store.MakeConst(0x12345678, 32), 8, 16), 0x3456, 16));
+	CHECK(IsConst(store.MakeConcat(store.MakeConst(0x12, 8), store.MakeConst(0x34, 8)), 0x1234, 16));
+}
+
+void TestIdentities() {
+	ExpressionStore store;
+
+	Expression *x = store.MakeVariable("x", 32);
+	Expression *zero = store.MakeConst(0, 32);
+	Expression *ones = store.MakeConst(0xFFFFFFFF, 32);
+
+	CHECK(store.MakeBinary(EXPR_ADD, x, zero) == x);
+	CHECK(store.MakeBinary(EXPR_ADD, zero, x) == x);
+	CHECK(store.MakeBinary(EXPR_SHL, x, zero) == x);
+	CHECK(store.MakeBinary(EXPR_MUL, x, store.MakeConst(1, 32)) == x);
+	CHECK(store.MakeBinary(EXPR_MUL, x, zero) == zero);
+	CHECK(store.MakeBinary(EXPR_AND, x, ones) == x);
+	CHECK(store.MakeBinary(EXPR_AND, x, zero) == zero);
+	CHECK(store.MakeBinary(EXPR_OR, x, ones) == ones);
+
+	CHECK(store.MakeBinary(EXPR_SUB, x, x) == zero);
+	CHECK(store.MakeBinary(EXPR_XOR, x, x) == zero);
+	CHECK(store.MakeBinary(EXPR_AND, x, x) == x);
+	CHECK(store.MakeBinary(EXPR_OR, x, x) == x);
+	CHECK(IsConst(store.MakeBinary(EXPR_EQ, x, x), 1, 1));
+	CHECK(IsConst(store.MakeBinary(EXPR_ULT, x, x), 0, 1));
+
+	CHECK(store.MakeUnary(EXPR_NOT, store.MakeUnary(EXPR_NOT, x)) == x);
+	CHECK(store.MakeUnary(EXPR_NEG, store.MakeUnary(EXPR_NEG, x)) == x);
+	CHECK(store.MakeExtend(EXPR_ZEXT, x, 32) == x);
+
+	Expression *y = store.MakeVariable("y", 32);
+	Expression *cond = store.MakeBinary(EXPR_EQ, x, y);
+	CHECK(store.MakeIte(store.MakeConst(1, 1), x, y) == x);
+	CHECK(store.MakeIte(store.MakeConst(0, 1), x, y) == y);
+	CHECK(store.MakeIte(cond, x, x) == x);
+}
+
+void TestExtractConcat() {
+	ExpressionStore store;
+
+	Expression *x = store.MakeVariable("x", 32);
+	Expression *h = store.MakeVariable("h", 16);
+	Expression *l = store.MakeVariable("l", 16);
+
+	CHECK(store.MakeExtract(x, 0, 32) == x);
+
+	// extract of extract collapses into a single extract
+	Expression *e = store.MakeExtract(store.MakeExtract(x, 8, 16), 4, 8);
+	CHECK((EXPR_EXTRACT == e->kind) && (x == e->operands[0]) && (12 == e->value) && (8 == e->bits));
+
+	// extract of a concat picks the part that holds the bits
+	Expression *hl = store.MakeConcat(h, l);
+	CHECK(store.MakeExtract(hl, 0, 16) == l);
+	CHECK(store.MakeExtract(hl, 16, 16) == h);
+	CHECK(store.MakeExtract(hl, 4, 8) == store.MakeExtract(l, 4, 8));
+	CHECK(EXPR_EXTRACT == store.MakeExtract(hl, 8, 16)->kind);
+
+	// adjacent extracts of the same node concatenate back into one extract
+	CHECK(store.MakeConcat(store.MakeExtract(x, 16, 16), store.MakeExtract(x, 0, 16)) == x);
+	Expression *m = store.MakeConcat(store.MakeExtract(x, 16, 8), store.MakeExtract(x, 8, 8));
+	CHECK((EXPR_EXTRACT == m->kind) && (8 == m->value) && (16 == m->bits));
+}
+
+void TestCollect() {
+	ExpressionStore store;
+
+	Expression *x = store.MakeVariable("x", 32);
+	Expression *y = store.MakeVariable("y", 32);
+	Expression *kept = store.MakeBinary(EXPR_ADD, x, y);
+	ExpressionStore::AddRef(kept);
+
+	store.MakeBinary(EXPR_SUB, x, y);
+	store.MakeBinary(EXPR_MUL, store.MakeBinary(EXPR_XOR, x, y), y);
+	CHECK(6 == store.GetCount());
+
+	// operands of a referenced node survive, everything else is freed
+	store.Collect();
+	CHECK(3 == store.GetCount());
+	CHECK(EXPR_ADD == kept->kind);
+	CHECK(kept == store.MakeBinary(EXPR_ADD, y, x));
+
+	ExpressionStore::DecRef(kept);
+	CHECK(0 == store.GetCount());
+}
+
+void TestRelease() {
+	ExpressionStore store;
+
+	// a deep single use chain must be released without recursion
+	const int depth = 1000000;
+	Expression *one = store.MakeConst(1, 32);
+	Expression *y = store.MakeVariable("y", 32);
+	Expression *crt = store.MakeVariable("x", 32);
+	for (int i = 0; i < depth; ++i) {
+		crt = store.MakeBinary(EXPR_XOR, store.MakeBinary(EXPR_ADD, crt, one), y);
+	}
+
+	ExpressionStore::AddRef(crt);
+	CHECK(2 * depth + 3 == store.GetCount());
+
+	ExpressionStore::DecRef(crt);
+	CHECK(0 == store.GetCount());
+}
+
+void TestRecycledIds() {
+	ExpressionStore store;
+
+	Expression *x = store.MakeVariable("x", 32);
+	ExpressionStore::AddRef(x);
+
+	Expression *a = store.MakeUnary(EXPR_NOT, x);
+	ExpressionStore::AddRef(a);
+	nodep::QWORD id = a->id;
+	ExpressionStore::DecRef(a);
+
+	// the released slot is reused, but under a different id
+	Expression *b = store.MakeUnary(EXPR_NEG, x);
+	CHECK(a == b);
+	CHECK(id != b->id);
+	CHECK(x->id != b->id);
+
+	ExpressionStore::DecRef(x);
+}
+
+int main() {
+	TestHashConsing();
+	TestConstantFolding();
+	TestIdentities();
+	TestExtractConcat();
+	TestCollect();
+	TestRelease();
+	TestRecycledIds();
+
+	if (0 != failures) {
+		printf("%d checks failed\n", failures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
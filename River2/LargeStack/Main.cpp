@@ -1,22 +1,33 @@
 #include <stdio.h>
 
-#include "LargeStack.h"
+#include "../SymbolicEnvironment/LargeStack.h"
 
-using namespace rev;
+using namespace stk;
 
-rev::DWORD stack[0x10000];
-rev::DWORD top;
+stk::DWORD stack[0x10000];
+stk::DWORD top;
 
-int main() {
-	LargeStack ls(stack, sizeof(stack), &top, "stack.bin");
+/* Runs the same push/pop pattern over a file only spill and over a
+ * mapping backed spill. Each iteration leaves one value on the stack,
+ * so the stack keeps growing and regions are spilled continuously. */
+bool RunBenchmark(const char *name, char *fName, stk::DWORD spillReserve, int iterations) {
+	TIME_T start, end;
+	TIME_FREQ_T freq;
+	TIME_RES_T res;
+
+	top = (stk::DWORD)&stack[sizeof(stack) / sizeof(stack[0])];
+	LargeStack ls(stack, sizeof(stack), &top, fName, spillReserve);
+
+	GET_FREQ(freq);
+	START_COUNTER(start, freq);
 
 	unsigned int val = 0;
-	for (int i = 0; i < 0x1000000; ++i) {
+	for (int i = 0; i < iterations; ++i) {
 		for (int j = 0; j < 13; ++j) {
 
 			//push equivalent
 			top -= 4; 
-			*((rev::DWORD *)top) = val;
+			*((stk::DWORD *)top) = val;
 			
 			val++;
 		}
@@ -26,14 +37,47 @@ int main() {
 		for (int j = 0; j < 12; ++j) {
 			val--;
 
-			rev::DWORD v = *((rev::DWORD *)top);
+			stk::DWORD v = *((stk::DWORD *)top);
 			top += 4;
 
-			if (v != val) __asm int 3;
+			if (v != val) {
+				printf("%s: push/pop mismatch %08x != %08x\n", name, v, val);
+				return false;
+			}
 		}
 
 		ls.Update();
 	}
 
+	// unwind everything, this reloads every spilled region
+	while (val > 0) {
+		val--;
+
+		stk::DWORD v = *((stk::DWORD *)top);
+		top += 4;
+		ls.Update();
+
+		if (v != val) {
+			printf("%s: unwind mismatch %08x != %08x\n", name, v, val);
+			return false;
+		}
+	}
+
+	GET_COUNTER(start, end, freq, res);
+	printf("%s: %f\n", name, (double)res);
+	return true;
+}
+
+int main() {
+	const int iterations = 0x100000;
+
+	if (!RunBenchmark("file", (char *)"stack.bin", 0, iterations)) {
+		return 1;
+	}
+
+	if (!RunBenchmark("mapping", nullptr, LARGE_STACK_SPILL_RESERVE, iterations)) {
+		return 1;
+	}
+
 	return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,461 @@
+#include "ExpressionStore.h"
+
+#define EXPRESSION_SLAB_SIZE 4096
+
+namespace sym {
+
+	static nodep::DWORD _Mask(nodep::DWORD bits) {
+		return (bits >= 32) ? 0xFFFFFFFF : ((1 << bits) - 1);
+	}
+
+	static nodep::DWORD _SignExtend(nodep::DWORD value, nodep::DWORD bits) {
+		if ((bits < 32) && (value & (1 << (bits - 1)))) {
+			value |= ~_Mask(bits);
+		}
+		return value;
+	}
+
+	static bool _IsConst(const Expression *expr) {
+		return EXPR_CONST == expr->kind;
+	}
+
+	static bool _IsCommutative(nodep::WORD kind) {
+		switch (kind) {
+			case EXPR_ADD:
+			case EXPR_MUL:
+			case EXPR_AND:
+			case EXPR_OR:
+			case EXPR_XOR:
+			case EXPR_EQ:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	static nodep::DWORD _Hash(nodep::WORD kind, nodep::WORD bits, nodep::DWORD value, Expression *op0, Expression *op1, Expression *op2) {
+		nodep::DWORD h = 0x811C9DC5;
+
+		h = (h ^ kind) * 0x01000193;
+		h = (h ^ bits) * 0x01000193;
+		h = (h ^ value) * 0x01000193;
+		h = (h ^ (nodep::DWORD)op0) * 0x01000193;
+		h = (h ^ (nodep::DWORD)op1) * 0x01000193;
+		h = (h ^ (nodep::DWORD)op2) * 0x01000193;
+		return h ^ (h >> 15);
+	}
+
+	ExpressionStore::ExpressionStore(nodep::DWORD logBuckets) {
+		bucketMask = (1 << logBuckets) - 1;
+		buckets = new Expression *[bucketMask + 1];
+		for (nodep::DWORD i = 0; i <= bucketMask; ++i) {
+			buckets[i] = nullptr;
+		}
+
+		count = 0;
+		nextId = 0;
+		freeList = nullptr;
+	}
+
+	ExpressionStore::~ExpressionStore() {
+		for (std::vector<Expression *>::iterator it = slabs.begin(); it != slabs.end(); ++it) {
+			delete[] *it;
+		}
+		delete[] buckets;
+	}
+
+	Expression *ExpressionStore::Allocate() {
+		if (nullptr == freeList) {
+			Expression *slab = new Expression[EXPRESSION_SLAB_SIZE];
+			slabs.push_back(slab);
+
+			for (int i = EXPRESSION_SLAB_SIZE - 1; i >= 0; --i) {
+				slab[i].kind = EXPR_FREE;
+				slab[i].next = freeList;
+				freeList = &slab[i];
+			}
+		}
+
+		Expression *ret = freeList;
+		freeList = ret->next;
+		return ret;
+	}
+
+	void ExpressionStore::Unlink(Expression *expr) {
+		Expression **it = &buckets[expr->hash & bucketMask];
+		while (*it != expr) {
+			it = &(*it)->next;
+		}
+		*it = expr->next;
+		count--;
+	}
+
+	// iterative on purpose, long chains of single use expressions are common
+	void ExpressionStore::Release(Expression *expr) {
+		Unlink(expr);
+		expr->next = nullptr;
+
+		Expression *pending = expr;
+		while (nullptr != pending) {
+			Expression *crt = pending;
+			pending = crt->next;
+
+			for (int i = 0; i < 3; ++i) {
+				Expression *op = crt->operands[i];
+				if ((nullptr != op) && (0 == --op->refCount)) {
+					Unlink(op);
+					op->next = pending;
+					pending = op;
+				}
+			}
+
+			crt->kind = EXPR_FREE;
+			crt->next = freeList;
+			freeList = crt;
+		}
+	}
+
+	void ExpressionStore::Grow() {
+		nodep::DWORD newMask = (bucketMask << 1) | 1;
+		Expression **newBuckets = new Expression *[newMask + 1];
+		for (nodep::DWORD i = 0; i <= newMask; ++i) {
+			newBuckets[i] = nullptr;
+		}
+
+		for (nodep::DWORD i = 0; i <= bucketMask; ++i) {
+			Expression *it = buckets[i];
+			while (nullptr != it) {
+				Expression *next = it->next;
+				it->next = newBuckets[it->hash & newMask];
+				newBuckets[it->hash & newMask] = it;
+				it = next;
+			}
+		}
+
+		delete[] buckets;
+		buckets = newBuckets;
+		bucketMask = newMask;
+	}
+
+	Expression *ExpressionStore::Lookup(nodep::WORD kind, nodep::WORD bits, nodep::DWORD value, Expression *op0, Expression *op1, Expression *op2) {
+		nodep::DWORD hash = _Hash(kind, bits, value, op0, op1, op2);
+
+		for (Expression *it = buckets[hash & bucketMask]; nullptr != it; it = it->next) {
+			if ((it->hash == hash) && (it->kind == kind) && (it->bits == bits) && (it->value == value) &&
+				(it->operands[0] == op0) && (it->operands[1] == op1) && (it->operands[2] == op2)) {
+				return it;
+			}
+		}
+
+		if (count > (bucketMask << 1)) {
+			Grow();
+		}
+
+		Expression *ret = Allocate();
+		ret->refCount = 0;
+		ret->hash = hash;
+		ret->store = this;
+		ret->id = nextId++;
+		ret->kind = kind;
+		ret->bits = bits;
+		ret->value = value;
+		ret->operands[0] = op0;
+		ret->operands[1] = op1;
+		ret->operands[2] = op2;
+
+		for (int i = 0; i < 3; ++i) {
+			if (nullptr != ret->operands[i]) {
+				ret->operands[i]->refCount++;
+			}
+		}
+
+		ret->next = buckets[hash & bucketMask];
+		buckets[hash & bucketMask] = ret;
+		count++;
+		return ret;
+	}
+
+	void ExpressionStore::AddRef(void *expr) {
+		((Expression *)expr)->refCount++;
+	}
+
+	void ExpressionStore::DecRef(void *expr) {
+		Expression *e = (Expression *)expr;
+		if (0 == --e->refCount) {
+			e->store->Release(e);
+		}
+	}
+
+	void ExpressionStore::Collect() {
+		for (std::vector<Expression *>::iterator it = slabs.begin(); it != slabs.end(); ++it) {
+			for (int i = 0; i < EXPRESSION_SLAB_SIZE; ++i) {
+				Expression *expr = &(*it)[i];
+				if ((EXPR_FREE != expr->kind) && (0 == expr->refCount)) {
+					Release(expr);
+				}
+			}
+		}
+	}
+
+	nodep::DWORD ExpressionStore::GetCount() const {
+		return count;
+	}
+
+	const char *ExpressionStore::GetVariableName(const Expression *expr) const {
+		if (EXPR_VARIABLE != expr->kind) {
+			return nullptr;
+		}
+		return variables[expr->value].c_str();
+	}
+
+	Expression *ExpressionStore::MakeConst(nodep::DWORD value, nodep::DWORD bits) {
+		if (bits > 32) {
+			DEBUG_BREAK;
+		}
+		return Lookup(EXPR_CONST, bits, value & _Mask(bits), nullptr, nullptr, nullptr);
+	}
+
+	Expression *ExpressionStore::MakeVariable(const char *name, nodep::DWORD bits) {
+		nodep::DWORD index = variables.size();
+		variables.push_back(name);
+		return Lookup(EXPR_VARIABLE, bits, index, nullptr, nullptr, nullptr);
+	}
+
+	Expression *ExpressionStore::MakeExtract(Expression *expr, nodep::DWORD lsb, nodep::DWORD bits) {
+		if (lsb + bits > expr->bits) {
+			DEBUG_BREAK;
+		}
+
+		if ((0 == lsb) && (bits == expr->bits)) {
+			return expr;
+		}
+
+		if (_IsConst(expr)) {
+			return MakeConst(expr->value >> lsb, bits);
+		}
+
+		if (EXPR_EXTRACT == expr->kind) {
+			return MakeExtract(expr->operands[0], expr->value + lsb, bits);
+		}
+
+		if (EXPR_CONCAT == expr->kind) {
+			nodep::DWORD low = expr->operands[1]->bits;
+			if (lsb + bits <= low) {
+				return MakeExtract(expr->operands[1], lsb, bits);
+			}
+
+			if (lsb >= low) {
+				return MakeExtract(expr->operands[0], lsb - low, bits);
+			}
+		}
+
+		return Lookup(EXPR_EXTRACT, bits, lsb, expr, nullptr, nullptr);
+	}
+
+	Expression *ExpressionStore::MakeConcat(Expression *msb, Expression *lsb) {
+		nodep::DWORD bits = msb->bits + lsb->bits;
+
+		if ((bits <= 32) && _IsConst(msb) && _IsConst(lsb)) {
+			return MakeConst((msb->value << lsb->bits) | lsb->value, bits);
+		}
+
+		// concat(extract(x, n + m, k), extract(x, n, m)) => extract(x, n, m + k)
+		if ((EXPR_EXTRACT == msb->kind) && (EXPR_EXTRACT == lsb->kind) &&
+			(msb->operands[0] == lsb->operands[0]) && (msb->value == lsb->value + lsb->bits)) {
+			return MakeExtract(lsb->operands[0], lsb->value, bits);
+		}
+
+		return Lookup(EXPR_CONCAT, bits, 0, msb, lsb, nullptr);
+	}
+
+	Expression *ExpressionStore::MakeExtend(nodep::WORD kind, Expression *expr, nodep::DWORD bits) {
+		if (bits == expr->bits) {
+			return expr;
+		}
+
+		if (bits < expr->bits) {
+			DEBUG_BREAK;
+		}
+
+		if ((bits <= 32) && _IsConst(expr)) {
+			nodep::DWORD value = (EXPR_SEXT == kind) ? _SignExtend(expr->value, expr->bits) : expr->value;
+			return MakeConst(value, bits);
+		}
+
+		return Lookup(kind, bits, 0, expr, nullptr, nullptr);
+	}
+
+	Expression *ExpressionStore::MakeUnary(nodep::WORD kind, Expression *expr) {
+		if ((expr->bits <= 32) && _IsConst(expr)) {
+			switch (kind) {
+				case EXPR_NOT :
+					return MakeConst(~expr->value, expr->bits);
+				case EXPR_NEG :
+					return MakeConst(0 - expr->value, expr->bits);
+			}
+		}
+
+		// not(not(x)) => x, neg(neg(x)) => x
+		if (((EXPR_NOT == kind) || (EXPR_NEG == kind)) && (kind == expr->kind)) {
+			return expr->operands[0];
+		}
+
+		return Lookup(kind, expr->bits, 0, expr, nullptr, nullptr);
+	}
+
+	// constant folding and trivial identities, returns nullptr if nothing applies
+	Expression *ExpressionStore::Fold(nodep::WORD kind, nodep::WORD bits, Expression *op1, Expression *op2) {
+		nodep::DWORD mask = _Mask(bits);
+
+		if ((bits <= 32) && _IsConst(op1) && _IsConst(op2)) {
+			nodep::DWORD a = op1->value, b = op2->value;
+
+			switch (kind) {
+				case EXPR_ADD :
+					return MakeConst(a + b, bits);
+				case EXPR_SUB :
+					return MakeConst(a - b, bits);
+				case EXPR_MUL :
+					return MakeConst(a * b, bits);
+				case EXPR_AND :
+					return MakeConst(a & b, bits);
+				case EXPR_OR :
+					return MakeConst(a | b, bits);
+				case EXPR_XOR :
+					return MakeConst(a ^ b, bits);
+				case EXPR_SHL :
+					return MakeConst((b >= bits) ? 0 : (a << b), bits);
+				case EXPR_LSHR :
+					return MakeConst((b >= bits) ? 0 : (a >> b), bits);
+				case EXPR_ASHR :
+					a = _SignExtend(a, bits);
+					return MakeConst((b >= bits) ? (nodep::DWORD)((int)a >> 31) : (nodep::DWORD)((int)a >> b), bits);
+				case EXPR_EQ :
+					return MakeConst(a == b, 1);
+				case EXPR_ULT :
+					return MakeConst(a < b, 1);
+				case EXPR_SLT :
+					return MakeConst((int)_SignExtend(a, bits) < (int)_SignExtend(b, bits), 1);
+			}
+		}
+
+		if (op1 == op2) {
+			switch (kind) {
+				case EXPR_SUB :
+				case EXPR_XOR :
+					return MakeConst(0, bits);
+				case EXPR_AND :
+				case EXPR_OR :
+					return op1;
+				case EXPR_EQ :
+					return MakeConst(1, 1);
+				case EXPR_ULT :
+				case EXPR_SLT :
+					return MakeConst(0, 1);
+			}
+		}
+
+		// commutative operations keep the constant in the second operand
+		if (_IsConst(op2)) {
+			nodep::DWORD b = op2->value;
+
+			switch (kind) {
+				case EXPR_ADD :
+				case EXPR_SUB :
+				case EXPR_OR :
+				case EXPR_XOR :
+				case EXPR_SHL :
+				case EXPR_LSHR :
+				case EXPR_ASHR :
+					if (0 == b) {
+						return op1;
+					}
+					break;
+				case EXPR_MUL :
+					if (1 == b) {
+						return op1;
+					}
+					if (0 == b) {
+						return op2;
+					}
+					break;
+				case EXPR_AND :
+					if (mask == b) {
+						return op1;
+					}
+					if (0 == b) {
+						return op2;
+					}
+					break;
+			}
+
+			if ((EXPR_OR == kind) && (mask == b)) {
+				return op2;
+			}
+		}
+
+		return nullptr;
+	}
+
+	Expression *ExpressionStore::MakeBinary(nodep::WORD kind, Expression *op1, Expression *op2) {
+		if (op1->bits != op2->bits) {
+			DEBUG_BREAK;
+		}
+
+		if (_IsCommutative(kind)) {
+			// canonical operand order, so that a + b and b + a share a node
+			if (_IsConst(op1) || (!_IsConst(op2) && (op1 > op2))) {
+				Expression *tmp = op1;
+				op1 = op2;
+				op2 = tmp;
+			}
+		}
+
+		Expression *ret = Fold(kind, op1->bits, op1, op2);
+		if (nullptr != ret) {
+			return ret;
+		}
+
+		nodep::WORD bits = ((EXPR_EQ == kind) || (EXPR_ULT == kind) || (EXPR_SLT == kind)) ? 1 : op1->bits;
+		return Lookup(kind, bits, 0, op1, op2, nullptr);
+	}
+
+	Expression *ExpressionStore::MakeIte(Expression *cond, Expression *exprTrue, Expression *exprFalse) {
+		if ((1 != cond->bits) || (exprTrue->bits != exprFalse->bits)) {
+			DEBUG_BREAK;
+		}
+
+		if (_IsConst(cond)) {
+			return cond->value ? exprTrue : exprFalse;
+		}
+
+		if (exprTrue == exprFalse) {
+			return exprTrue;
+		}
+
+		return Lookup(EXPR_ITE, exprTrue->bits, 0, cond, exprTrue, exprFalse);
+	}
+
+	ExpressionExecutor::ExpressionExecutor(SymbolicEnvironment *e) : SymbolicExecutor(e) {
+		if (nullptr != e) {
+			e->SetReferenceCounting(ExpressionStore::AddRef, ExpressionStore::DecRef);
+		}
+	}
+
+	void *ExpressionExecutor::CreateVariable(const char *name, nodep::DWORD size) {
+		return store.MakeVariable(name, size << 3);
+	}
+
+	void *ExpressionExecutor::MakeConst(nodep::DWORD value, nodep::DWORD bits) {
+		return store.MakeConst(value, bits);
+	}
+
+	void *ExpressionExecutor::ExtractBits(void *expr, nodep::DWORD lsb, nodep::DWORD size) {
+		return store.MakeExtract((Expression *)expr, lsb, size);
+	}
+
+	void *ExpressionExecutor::ConcatBits(void *expr1, void *expr2) {
+		return store.MakeConcat((Expression *)expr1, (Expression *)expr2);
+	}
+
+}; // namespace sym
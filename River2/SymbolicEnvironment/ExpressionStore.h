@@ -0,0 +1,130 @@
+#ifndef _EXPRESSION_STORE_H_
+#define _EXPRESSION_STORE_H_
+
+#include "SymbolicEnvironment.h"
+
+#include <string>
+#include <vector>
+
+namespace sym {
+
+	enum ExpressionKind {
+		EXPR_FREE = 0,
+
+		EXPR_CONST,
+		EXPR_VARIABLE,
+
+		EXPR_EXTRACT,	// value holds the lsb
+		EXPR_ZEXT,
+		EXPR_SEXT,
+		EXPR_NOT,
+		EXPR_NEG,
+
+		EXPR_CONCAT,	// operands[0] holds the most significant part
+		EXPR_ADD,
+		EXPR_SUB,
+		EXPR_MUL,
+		EXPR_AND,
+		EXPR_OR,
+		EXPR_XOR,
+		EXPR_SHL,
+		EXPR_LSHR,
+		EXPR_ASHR,
+		EXPR_EQ,		// comparisons yield 1 bit wide expressions
+		EXPR_ULT,
+		EXPR_SLT,
+
+		EXPR_ITE,		// operands[0] is a 1 bit wide condition
+
+		EXPR_KIND_COUNT
+	};
+
+	class ExpressionStore;
+
+	/* A node in the expression DAG. Nodes are unique: two nodes with the same
+	 * kind, width, value and operands are always the same object, thus they
+	 * may be compared by address. Released nodes are recycled, so anything
+	 * that outlives a node's references should key on id instead. */
+	struct Expression {
+		nodep::DWORD refCount;
+		nodep::DWORD hash;
+		Expression *next; // bucket chain, or free list once released
+		ExpressionStore *store;
+		nodep::QWORD id; // never reused within a store
+
+		nodep::WORD kind;
+		nodep::WORD bits;
+		nodep::DWORD value; // constant value, variable index or extract lsb
+		Expression *operands[3];
+	};
+
+	/** Hash-consed, reference counted storage for symbolic expressions.
+	 * Nodes are allocated from fixed size slabs and recycled through a free
+	 * list. Constant operands are folded when a node is built, so a constant
+	 * subtree never reaches the table.
+	 *
+	 * Newly made nodes have a reference count of 0. A node is freed when its
+	 * count drops back to 0 through DecRef, nodes that were never referenced
+	 * are reclaimed by Collect(). AddRef/DecRef match the AddRefFunc/DecRefFunc
+	 * signatures and can be passed to SymbolicEnvironment::SetReferenceCounting.
+	 */
+	class ExpressionStore {
+	private:
+		Expression **buckets;
+		nodep::DWORD bucketMask;
+		nodep::DWORD count;
+		nodep::QWORD nextId;
+
+		std::vector<Expression *> slabs;
+		Expression *freeList;
+
+		std::vector<std::string> variables;
+
+		Expression *Allocate();
+		void Release(Expression *expr);
+		void Unlink(Expression *expr);
+		void Grow();
+
+		Expression *Lookup(nodep::WORD kind, nodep::WORD bits, nodep::DWORD value, Expression *op0, Expression *op1, Expression *op2);
+		Expression *Fold(nodep::WORD kind, nodep::WORD bits, Expression *op0, Expression *op1);
+	public:
+		ExpressionStore(nodep::DWORD logBuckets = 16);
+		~ExpressionStore();
+
+		static void AddRef(void *expr);
+		static void DecRef(void *expr);
+
+		// frees every node that is not referenced
+		void Collect();
+
+		nodep::DWORD GetCount() const;
+		const char *GetVariableName(const Expression *expr) const;
+
+		Expression *MakeConst(nodep::DWORD value, nodep::DWORD bits);
+		Expression *MakeVariable(const char *name, nodep::DWORD bits);
+
+		Expression *MakeExtract(Expression *expr, nodep::DWORD lsb, nodep::DWORD bits);
+		Expression *MakeConcat(Expression *msb, Expression *lsb);
+		Expression *MakeExtend(nodep::WORD kind, Expression *expr, nodep::DWORD bits);
+		Expression *MakeUnary(nodep::WORD kind, Expression *expr);
+		Expression *MakeBinary(nodep::WORD kind, Expression *op1, Expression *op2);
+		Expression *MakeIte(Expression *cond, Expression *exprTrue, Expression *exprFalse);
+	};
+
+	/** Executor base that keeps its expressions in an ExpressionStore.
+	 * Derived classes only have to implement Execute. */
+	class ExpressionExecutor : public SymbolicExecutor {
+	protected:
+		ExpressionStore store;
+	public:
+		ExpressionExecutor(SymbolicEnvironment *e);
+
+		virtual void *CreateVariable(const char *name, nodep::DWORD size);
+		virtual void *MakeConst(nodep::DWORD value, nodep::DWORD bits);
+		virtual void *ExtractBits(void *expr, nodep::DWORD lsb, nodep::DWORD size);
+		virtual void *ConcatBits(void *expr1, void *expr2);
+	};
+
+}; // namespace sym
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef _EXPRESSION_Z3_H_
+#define _EXPRESSION_Z3_H_
+
+#include "ExpressionStore.h"
+
+#include <z3.h>
+#include <unordered_map>
+#include <vector>
+
+/* Z3 export for ExpressionStore nodes. Header only, so that the symbolic
+ * environment itself does not depend on z3. The cache maps node ids to
+ * already exported ASTs and can be kept across calls, even after nodes are
+ * released and their slots recycled, but only for nodes of a single store;
+ * the ASTs belong to a context created by Z3_mk_context. */
+
+namespace sym {
+
+	typedef std::unordered_map<nodep::QWORD, Z3_ast> Z3ExportCache;
+
+	inline Z3_ast _Z3BoolToBv(Z3_context ctx, Z3_ast b) {
+		Z3_sort s = Z3_mk_bv_sort(ctx, 1);
+		return Z3_mk_ite(ctx, b, Z3_mk_unsigned_int(ctx, 1, s), Z3_mk_unsigned_int(ctx, 0, s));
+	}
+
+	inline Z3_ast _Z3ExportNode(Z3_context ctx, const Expression *expr, Z3ExportCache &cache) {
+		Z3_ast ops[3];
+		for (int i = 0; i < 3; ++i) {
+			ops[i] = (nullptr != expr->operands[i]) ? cache[expr->operands[i]->id] : nullptr;
+		}
+
+		switch (expr->kind) {
+			case EXPR_CONST :
+				return Z3_mk_unsigned_int(ctx, expr->value, Z3_mk_bv_sort(ctx, expr->bits));
+			case EXPR_VARIABLE :
+				return Z3_mk_const(ctx, Z3_mk_string_symbol(ctx, expr->store->GetVariableName(expr)), Z3_mk_bv_sort(ctx, expr->bits));
+			case EXPR_EXTRACT :
+				return Z3_mk_extract(ctx, expr->value + expr->bits - 1, expr->value, ops[0]);
+			case EXPR_ZEXT :
+				return Z3_mk_zero_ext(ctx, expr->bits - expr->operands[0]->bits, ops[0]);
+			case EXPR_SEXT :
+				return Z3_mk_sign_ext(ctx, expr->bits - expr->operands[0]->bits, ops[0]);
+			case EXPR_NOT :
+				return Z3_mk_bvnot(ctx, ops[0]);
+			case EXPR_NEG :
+				return Z3_mk_bvneg(ctx, ops[0]);
+			case EXPR_CONCAT :
+				return Z3_mk_concat(ctx, ops[0], ops[1]);
+			case EXPR_ADD :
+				return Z3_mk_bvadd(ctx, ops[0], ops[1]);
+			case EXPR_SUB :
+				return Z3_mk_bvsub(ctx, ops[0], ops[1]);
+			case EXPR_MUL :
+				return Z3_mk_bvmul(ctx, ops[0], ops[1]);
+			case EXPR_AND :
+				return Z3_mk_bvand(ctx, ops[0], ops[1]);
+			case EXPR_OR :
+				return Z3_mk_bvor(ctx, ops[0], ops[1]);
+			case EXPR_XOR :
+				return Z3_mk_bvxor(ctx, ops[0], ops[1]);
+			case EXPR_SHL :
+				return Z3_mk_bvshl(ctx, ops[0], ops[1]);
+			case EXPR_LSHR :
+				return Z3_mk_bvlshr(ctx, ops[0], ops[1]);
+			case EXPR_ASHR :
+				return Z3_mk_bvashr(ctx, ops[0], ops[1]);
+			case EXPR_EQ :
+				return _Z3BoolToBv(ctx, Z3_mk_eq(ctx, ops[0], ops[1]));
+			case EXPR_ULT :
+				return _Z3BoolToBv(ctx, Z3_mk_bvult(ctx, ops[0], ops[1]));
+			case EXPR_SLT :
+				return _Z3BoolToBv(ctx, Z3_mk_bvslt(ctx, ops[0], ops[1]));
+			case EXPR_ITE :
+				return Z3_mk_ite(ctx,
+					Z3_mk_eq(ctx, ops[0], Z3_mk_unsigned_int(ctx, 1, Z3_mk_bv_sort(ctx, 1))),
+					ops[1],
+					ops[2]
+				);
+			default :
+				DEBUG_BREAK;
+				return nullptr;
+		}
+	}
+
+	// walks the DAG without recursion, traces routinely produce very deep chains
+	inline Z3_ast ExportZ3(Z3_context ctx, const Expression *expr, Z3ExportCache &cache) {
+		std::vector<std::pair<const Expression *, bool> > work;
+		work.push_back(std::make_pair(expr, false));
+
+		while (!work.empty()) {
+			const Expression *crt = work.back().first;
+			bool expanded = work.back().second;
+			work.pop_back();
+
+			if (cache.end() != cache.find(crt->id)) {
+				continue;
+			}
+
+			if (expanded) {
+				cache[crt->id] = _Z3ExportNode(ctx, crt, cache);
+				continue;
+			}
+
+			work.push_back(std::make_pair(crt, true));
+			for (int i = 0; i < 3; ++i) {
+				if ((nullptr != crt->operands[i]) && (cache.end() == cache.find(crt->operands[i]->id))) {
+					work.push_back(std::make_pair((const Expression *)crt->operands[i], false));
+				}
+			}
+		}
+
+		return cache[expr->id];
+	}
+
+	inline Z3_ast ExportZ3(Z3_context ctx, const Expression *expr) {
+		Z3ExportCache cache;
+		return ExportZ3(ctx, expr, cache);
+	}
+
+}; // namespace sym
+
+#endif
@@ -36,9 +36,11 @@
 #define CHUNK_COUNT    0x8
 #define MIN_STACK_SIZE (CHUNK_COUNT << LOG_MIN_CHUNK_SIZE)
 
+#define SPILL_COMMIT_SIZE (1 << 20)
+
 namespace stk {
 
-	LargeStack::LargeStack(DWORD *base, DWORD size, DWORD *top, const char *fName) {
+	LargeStack::LargeStack(DWORD *base, DWORD size, DWORD *top, const char *fName, DWORD spillReserve) {
 		if (size & (MIN_STACK_SIZE - 1)) {
 			DEBUG_BREAK;
 		}
@@ -56,15 +58,38 @@ namespace stk {
 		offsets[1] = 1;
 		offsets[2] = 0;
 
-		hVirtualStack = OPEN_FILE_RW(fName);
+		spillBase = nullptr;
+		spillReserved = spillCommitted = spillTop = 0;
+		if (0 != spillReserve) {
+			spillBase = (unsigned char *)RESERVE_MEMORY(spillReserve);
+			if (nullptr != spillBase) {
+				spillReserved = spillReserve;
+			}
+		}
+
+		hasFile = false;
+		fileRegions = 0;
+		if (nullptr != fName) {
+			hVirtualStack = OPEN_FILE_RW(fName);
 
-		if (FAIL_OPEN_FILE(hVirtualStack)) {
+			if (FAIL_OPEN_FILE(hVirtualStack)) {
+				DEBUG_BREAK;
+			} else {
+				hasFile = true;
+			}
+		} else if (nullptr == spillBase) {
 			DEBUG_BREAK;
 		}
 	}
 
 	LargeStack::~LargeStack() {
-		CLOSE_FILE(hVirtualStack);
+		if (hasFile) {
+			CLOSE_FILE(hVirtualStack);
+		}
+
+		if (nullptr != spillBase) {
+			RELEASE_MEMORY(spillBase, spillReserved);
+		}
 	}
 
 	DWORD LargeStack::CurrentRegion() const {
@@ -75,32 +100,106 @@ namespace stk {
 		return (ttop + 1) >> 1;
 	}
 
+	bool LargeStack::MappingPush(DWORD *buffer) {
+		DWORD regionSize = chunkSize << 1;
+
+		if (spillReserved - spillTop < regionSize) {
+			return false;
+		}
+
+		if (spillTop + regionSize > spillCommitted) {
+			DWORD commitSize = (spillTop + regionSize - spillCommitted + SPILL_COMMIT_SIZE - 1) & ~(SPILL_COMMIT_SIZE - 1);
+			if (commitSize > spillReserved - spillCommitted) {
+				commitSize = spillReserved - spillCommitted;
+			}
+
+			if (!COMMIT_MEMORY(spillBase + spillCommitted, commitSize)) {
+				return false;
+			}
+			spillCommitted += commitSize;
+		}
+
+		memcpy(spillBase + spillTop, buffer, regionSize);
+		spillTop += regionSize;
+		return true;
+	}
+
+	bool LargeStack::MappingPop(DWORD *buffer) {
+		DWORD regionSize = chunkSize << 1;
+
+		if (spillTop < regionSize) {
+			DEBUG_BREAK;
+			return false;
+		}
+
+		spillTop -= regionSize;
+		memcpy(buffer, spillBase + spillTop, regionSize);
+
+		// give the pages back, but keep one commit unit above the top
+		// so that going back and forth over a boundary is cheap
+		DWORD keep = (spillTop + (SPILL_COMMIT_SIZE << 1) - 1) & ~(SPILL_COMMIT_SIZE - 1);
+		if (keep < spillCommitted) {
+			DECOMMIT_MEMORY(spillBase + keep, spillCommitted - keep);
+			spillCommitted = keep;
+		}
+		return true;
+	}
+
 	bool LargeStack::VirtualPush(DWORD *buffer) {
+		// the file holds the regions pushed after the mapping filled up
+		if ((0 == fileRegions) && (nullptr != spillBase) && MappingPush(buffer)) {
+			return true;
+		}
+
+		return FilePush(buffer);
+	}
+
+	bool LargeStack::VirtualPop(DWORD *buffer) {
+		if (0 != fileRegions) {
+			return FilePop(buffer);
+		}
+
+		return MappingPop(buffer);
+	}
+
+	bool LargeStack::FilePush(DWORD *buffer) {
 		::DWORD dwWr;
+
+		if (!hasFile) {
+			DEBUG_BREAK;
+			return false;
+		}
 		
 		BOOL ret;
 		WRITE_FILE(hVirtualStack, buffer, chunkSize << 1, dwWr, ret);
-		return TRUE == ret;
+		if (TRUE != ret) {
+			return false;
+		}
+
+		fileRegions++;
+		return true;
 	}
 
-	bool LargeStack::VirtualPop(DWORD *buffer) {
+	bool LargeStack::FilePop(DWORD *buffer) {
 		LARGE_INTEGER liPos;
 		::DWORD dwRd;
 
 		liPos.QuadPart = ~(LONGLONG)(chunkSize << 1) + 1;
 
-		LSEEK(hVirtualStack, liPos, SEEK_END_FILE);
+		SEEK_FILE(hVirtualStack, liPos, SEEK_END_FILE);
 
 		BOOL ret;
 		READ_FILE(hVirtualStack, buffer, chunkSize << 1, dwRd, ret);
 
 #ifdef __linux__
-    ftruncate(hVirtualStack, liPos.QuadPart);
+		ftruncate(hVirtualStack, liPos.QuadPart);
+		SEEK_FILE(hVirtualStack, liPos, SEEK_BEGIN_FILE);
 #else
 		SetFilePointerEx(hVirtualStack, liPos, &liPos, FILE_BEGIN);
 		SetEndOfFile(hVirtualStack);
 #endif
 
+		fileRegions--;
 		return true;
 	}
 
@@ -156,6 +255,12 @@ namespace stk {
 
 			if (NULL != loadBuffer) {
 				VirtualPop(loadBuffer);
+
+				// the last chunk mirrors the start of region 1 (see case 0)
+				// refresh it, otherwise it still holds the previous wrap
+				if (3 == newRegion) {
+					memcpy((void *)((DWORD)stackBase + 7 * chunkSize), (void *)((DWORD)stackBase + chunkSize), chunkSize);
+				}
 			}
 
 			currentRegion = newRegion;
@@ -164,12 +269,14 @@ namespace stk {
 
 	void LargeStack::Push(DWORD value) {
 		*stackTop -= 4;
-		*stackTop = value;
+		*(DWORD *)*stackTop = value;
+		Update();
 	}
 
 	DWORD LargeStack::Pop() {
-		DWORD ret = *stackTop;
+		DWORD ret = *(DWORD *)*stackTop;
 		*stackTop += 4;
+		Update();
 		return ret;
 	}
 };
@@ -7,6 +7,12 @@
 
 #include "../CommonCrossPlatform/Common.h"
 
+// default address space reserved for spilled regions, kept small since
+// every stack (per thread, per environment) has its own reservation
+#ifndef LARGE_STACK_SPILL_RESERVE
+#define LARGE_STACK_SPILL_RESERVE	0x01000000
+#endif
+
 namespace stk {
 	typedef unsigned int DWORD;
 
@@ -20,14 +26,32 @@ namespace stk {
 
 		DWORD offsets[3];
 
+		/* spill storage: regions are saved in a reserved memory mapping,
+		 * the file is only used once the mapping fills up */
+		unsigned char *spillBase;
+		DWORD spillReserved;
+		DWORD spillCommitted;
+		DWORD spillTop;
+
 		FILE_T hVirtualStack;
+		bool hasFile;
+		DWORD fileRegions;
 
 		DWORD CurrentRegion() const;
 
 		bool VirtualPush(DWORD *buffer);
 		bool VirtualPop(DWORD *buffer);
+
+		bool MappingPush(DWORD *buffer);
+		bool MappingPop(DWORD *buffer);
+		bool FilePush(DWORD *buffer);
+		bool FilePop(DWORD *buffer);
 	public:
-		LargeStack(DWORD *base, DWORD size, DWORD *top, const char *fName);
+		/* spillReserve - address space reserved for spilled regions,
+		 *                0 disables the memory mapping
+		 * fName        - overflow file, used when the mapping is full
+		 *                (may be nullptr when spillReserve is not 0) */
+		LargeStack(DWORD *base, DWORD size, DWORD *top, const char *fName, DWORD spillReserve = LARGE_STACK_SPILL_RESERVE);
 		~LargeStack();
 
 		void Push(DWORD value);
@@ -28,12 +28,26 @@ static nodep::BYTE _GetFundamentalRegister(nodep::BYTE reg) {
 }
 
 OverlappedRegistersEnvironment::OverlappedRegister::OverlappedRegister() {
-	for (int i = 0; i < 5; ++i) {
-		subRegs[i] = nullptr;
-	}
+	index = 0;
+	parent = nullptr;
+}
+
+bool OverlappedRegistersEnvironment::OverlappedRegister::IsValue(void *value) {
+	return (nullptr != value) && (&needExtract != value) && (&needConcat != value);
+}
+
+void **OverlappedRegistersEnvironment::OverlappedRegister::Nodes() const {
+	return parent->state->regs[index]->subRegs;
+}
+
+void **OverlappedRegistersEnvironment::OverlappedRegister::WritableNodes() {
+	parent->MakeWritable(index);
+	return Nodes();
 }
 
 void OverlappedRegistersEnvironment::OverlappedRegister::MarkNeedExtract(nodep::DWORD node, bool doRefCount) {
+	void **subRegs = Nodes();
+
 	nodep::DWORD c = rLChild[node];
 	if (c != 0xFF) {
 		if ((doRefCount) && (nullptr != subRegs[c]) && (&needExtract != subRegs[c]) && (&needConcat != subRegs[c])) {
@@ -54,6 +68,8 @@ void OverlappedRegistersEnvironment::OverlappedRegister::MarkNeedExtract(nodep::
 }
 
 void OverlappedRegistersEnvironment::OverlappedRegister::MarkUnset(nodep::DWORD node, bool doRefCount) {
+	void **subRegs = Nodes();
+
 	nodep::DWORD c = rLChild[node];
 	if (c != 0xFF) {
 		if ((doRefCount) && (nullptr != subRegs[c]) && (&needExtract != subRegs[c]) && (&needConcat != subRegs[c])) {
@@ -76,6 +92,8 @@ void OverlappedRegistersEnvironment::OverlappedRegister::MarkUnset(nodep::DWORD
 }
 
 void *OverlappedRegistersEnvironment::OverlappedRegister::Get(nodep::DWORD node, nodep::DWORD concreteValue) {
+	void **subRegs = Nodes();
+
 	if (subRegs[node] == &needExtract) {
 		nodep::DWORD c;
 		c = node;
@@ -123,8 +141,9 @@ void *OverlappedRegistersEnvironment::OverlappedRegister::Get(nodep::DWORD node,
 	}
 }
 
-void OverlappedRegistersEnvironment::OverlappedRegister::SetParent(OverlappedRegistersEnvironment *p) {
+void OverlappedRegistersEnvironment::OverlappedRegister::SetParent(OverlappedRegistersEnvironment *p, nodep::DWORD idx) {
 	parent = p;
+	index = idx;
 }
 
 void *OverlappedRegistersEnvironment::OverlappedRegister::Get(RiverRegister &reg, nodep::DWORD &concreteValue) {
@@ -146,6 +165,8 @@ void *OverlappedRegistersEnvironment::OverlappedRegister::Get(RiverRegister &reg
 // recursive function that should mark node parent for needConcat
 //
 void OverlappedRegistersEnvironment::OverlappedRegister::MarkNeedConcat(nodep::DWORD node, bool doRefCount) {
+	void **subRegs = Nodes();
+
 	// is symbolic or needExtract
 	if ((nullptr != subRegs[node]) && (&needConcat != subRegs[node])) {
 		// if it has child and child needs extract
@@ -211,6 +232,7 @@ void OverlappedRegistersEnvironment::OverlappedRegister::Set(RiverRegister &reg,
 	}
 
 	nodep::DWORD seed = rSeed[idx];
+	void **subRegs = WritableNodes();
 
 	// set the current register
 	if (doRefCount) {
@@ -246,6 +268,8 @@ bool OverlappedRegistersEnvironment::OverlappedRegister::Unset(RiverRegister &re
 	}
 
 	nodep::DWORD seed = rSeed[idx];
+	void **subRegs = WritableNodes();
+
 	// set the current register
 	subRegs[seed] = nullptr;
 
@@ -266,18 +290,6 @@ bool OverlappedRegistersEnvironment::OverlappedRegister::Unset(RiverRegister &re
 	return (subRegs[0] == nullptr);
 }
 
-void OverlappedRegistersEnvironment::OverlappedRegister::SaveState(stk::LargeStack &stack) {
-	for (int i = 0; i < 5; ++i) {
-		stack.Push((DWORD)subRegs[i]);
-	}
-}
-
-void OverlappedRegistersEnvironment::OverlappedRegister::LoadState(stk::LargeStack &stack) {
-	for (int i = 4; i >= 0; ++i) {
-		subRegs[i] = (void *)stack.Pop();
-	}
-}
-
 bool OverlappedRegistersEnvironment::_SetCurrentInstruction(RiverInstruction *instruction, void *opBuffer) {
 	current = instruction;
 	return true;
@@ -288,24 +300,92 @@ void OverlappedRegistersEnvironment::_SetReferenceCounting(AddRefFunc addRef, De
 	decRefFunc = decRef;
 }
 
-void OverlappedRegistersEnvironment::_PushState(stk::LargeStack &stack) {
+void OverlappedRegistersEnvironment::MakeWritable(nodep::DWORD index) {
+	if (1 < state->refCount) {
+		StateNode *copy = new StateNode(*state);
+		copy->refCount = 1;
+		for (int i = 0; i < 8; ++i) {
+			copy->regs[i]->refCount++;
+		}
+
+		state->refCount--;
+		state = copy;
+	}
+
+	RegisterNode *&node = state->regs[index];
+	if (1 < node->refCount) {
+		RegisterNode *copy = new RegisterNode(*node);
+		copy->refCount = 1;
+
+		// the copy holds its own reference to every shared value
+		for (int j = 0; j < 5; ++j) {
+			if ((nullptr != addRefFunc) && (OverlappedRegister::IsValue(copy->subRegs[j]))) {
+				addRefFunc(copy->subRegs[j]);
+			}
+		}
+
+		node->refCount--;
+		node = copy;
+	}
+}
+
+void OverlappedRegistersEnvironment::ReleaseNode(RegisterNode *node) {
+	if (0 != --node->refCount) {
+		return;
+	}
+
+	for (int j = 0; j < 5; ++j) {
+		if ((nullptr != decRefFunc) && (OverlappedRegister::IsValue(node->subRegs[j]))) {
+			decRefFunc(node->subRegs[j]);
+		}
+	}
+	delete node;
+}
+
+void OverlappedRegistersEnvironment::ReleaseState(StateNode *s) {
+	if (0 != --s->refCount) {
+		return;
+	}
+
 	for (int i = 0; i < 8; ++i) {
-		subRegisters[i].SaveState(stack);
+		ReleaseNode(s->regs[i]);
 	}
+	delete s;
+}
+
+void OverlappedRegistersEnvironment::_PushState(stk::LargeStack &stack) {
+	// the saved state is shared with the current one until either is modified
+	state->refCount++;
+	stack.Push((DWORD)state);
 }
 
 void OverlappedRegistersEnvironment::_PopState(stk::LargeStack &stack) {
-	for (int i = 7; i >= 0; --i) {
-		subRegisters[i].LoadState(stack);
-	}
+	ReleaseState(state);
+	state = (StateNode *)stack.Pop();
 }
 
 OverlappedRegistersEnvironment::OverlappedRegistersEnvironment() {
+	addRefFunc = nullptr;
+	decRefFunc = nullptr;
+
+	state = new StateNode;
+	state->refCount = 1;
+
 	for (int i = 7; i >= 0; --i) {
-		subRegisters[i].SetParent(this);
+		state->regs[i] = new RegisterNode;
+		state->regs[i]->refCount = 1;
+		for (int j = 0; j < 5; ++j) {
+			state->regs[i]->subRegs[j] = nullptr;
+		}
+
+		subRegisters[i].SetParent(this, i);
 	}
 }
 
+OverlappedRegistersEnvironment::~OverlappedRegistersEnvironment() {
+	ReleaseState(state);
+}
+
 bool OverlappedRegistersEnvironment::GetAddressBase(struct OperandInfo &opInfo) {
 	bool ret = subEnv->GetAddressBase(opInfo);
 	if ((RIVER_OPTYPE(current->opTypes[opInfo.opIdx]) != RIVER_OPTYPE_MEM) ||
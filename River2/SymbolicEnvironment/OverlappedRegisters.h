@@ -8,9 +8,28 @@
 
 class OverlappedRegistersEnvironment : public sym::ScopedSymbolicEnvironment {
 private :
+	/* Register state is persistent: checkpoints share the nodes below and
+	 * a node is copied only when it is modified while still being shared.
+	 * Pushing a state is a reference increment, popping it swaps the root. */
+	struct RegisterNode {
+		void *subRegs[5];
+		nodep::DWORD refCount;
+	};
+
+	struct StateNode {
+		RegisterNode *regs[8];
+		nodep::DWORD refCount;
+	};
+
+	StateNode *state;
+
+	void MakeWritable(nodep::DWORD index);
+	void ReleaseNode(RegisterNode *node);
+	void ReleaseState(StateNode *s);
+
 	class OverlappedRegister {
 	private:
-		void *subRegs[5];
+		nodep::DWORD index;
 		static const nodep::DWORD rOff[5], rSize[5], rParent[5], rMChild[5], rLChild[5];
 		static const nodep::DWORD rSeed[4];
 		static nodep::DWORD needConcat, needExtract;
@@ -22,17 +41,22 @@ private :
 		void MarkUnset(nodep::DWORD node, bool doRefCount);
 
 		void *Get(nodep::DWORD node, nodep::DWORD concreteValue);
+
+		// current sub-register values, only valid until the next checkpoint
+		void **Nodes() const;
+		// same as above, but unshares the register node first
+		void **WritableNodes();
 	public:
 		OverlappedRegister();
 
-		void SetParent(OverlappedRegistersEnvironment *p);
+		// true for actual symbolic values, false for empty and marker slots
+		static bool IsValue(void *value);
+
+		void SetParent(OverlappedRegistersEnvironment *p, nodep::DWORD idx);
 
 		void *Get(RiverRegister &reg, nodep::DWORD &concreteValue);
 		void Set(RiverRegister &reg, void *value, bool doRefCount);
 		bool Unset(RiverRegister &reg, bool doRefCount);
-
-		void SaveState(stk::LargeStack &stack);
-		void LoadState(stk::LargeStack &stack);
 	} subRegisters[8];
 
 	RiverInstruction *current;
@@ -49,6 +73,7 @@ protected :
 
 public :
 	OverlappedRegistersEnvironment();
+	~OverlappedRegistersEnvironment();
 
 	virtual bool GetOperand(struct OperandInfo &opInfo);
 	virtual bool GetAddressBase(struct OperandInfo &opInfo);
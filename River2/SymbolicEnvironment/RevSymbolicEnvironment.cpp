@@ -43,111 +43,6 @@ RevSymbolicEnvironment::RevSymbolicEnvironment(void *revEnv, ExecutionController
 	decRefFunc = NoDecRef;
 }
 
-void RevSymbolicEnvironment::GetOperandLayout(const RiverInstruction &rIn) {
-	unsigned int trackIndex = 0;
-
-	for (unsigned int i = 0; i < 4; ++i) {
-		addressOffsets[i] = 0xFFFFFFFF;
-		inValueOffsets[i] = 0xFFFFFFFF;
-		outValueOffsets[i] = 0xFFFFFFFF;
-		baseOffsets[i] = 0xFFFFFFFF;
-		indexOffsets[i] = 0xFFFFFFFF;
-	}
-
-	inFlagOffset = outFlagOffset = 0xFFFFFFFF;
-
-	for (int i = 3; i >= 0; --i) {
-		// if memory operand and it is constructed from non-zero addr components
-		if ((RIVER_OPTYPE(rIn.opTypes[i]) == RIVER_OPTYPE_MEM) && (0 != rIn.operands[i].asAddress->type)) {
-			addressOffsets[i] = trackIndex;
-			// for segmented addresses both segment and address are tracked
-			trackIndex += rIn.operands[i].asAddress->HasSegment() ? 2 : 1;
-
-			// increase trackIndex if base exists
-			if (rIn.operands[i].asAddress->type & RIVER_ADDR_BASE) {
-				baseOffsets[i] = trackIndex;
-				trackIndex++;
-			}
-
-			// increase trackIndex if index exists
-			if (rIn.operands[i].asAddress->type & RIVER_ADDR_INDEX) {
-				indexOffsets[i] = trackIndex;
-				trackIndex++;
-			}
-
-			/*if (0 == (rIn.specifiers & RIVER_SPEC_IGNORES_MEMORY)) {
-				valueOffsets[i] = trackIndex + 1; // look at the layout one more time
-				trackIndex += 2;
-			}*/
-		}
-	}
-
-	//if ((0 == (RIVER_SPEC_IGNORES_FLG & rIn.specifiers)) || (rIn.modFlags)) {
-	if (rIn.testFlags | rIn.modFlags) {
-		inFlagOffset = trackIndex;
-		trackIndex++;
-	}
-
-	for (int i = 3; i >= 0; --i) {
-		if (0 == (RIVER_SPEC_IGNORES_OP(i) & rIn.specifiers)) {
-			switch (RIVER_OPTYPE(rIn.opTypes[i])) {
-			case RIVER_OPTYPE_NONE:
-			case RIVER_OPTYPE_IMM:
-				break;
-			case RIVER_OPTYPE_MEM:
-				if (0 == (rIn.specifiers & RIVER_SPEC_IGNORES_MEMORY)) {
-					if (0 == rIn.operands[i].asAddress->type) {
-						inValueOffsets[i] = trackIndex;
-						trackIndex++;
-					} else {
-						inValueOffsets[i] = trackIndex + 1;
-						trackIndex += 2;
-					}
-				}
-			case RIVER_OPTYPE_REG:
-				inValueOffsets[i] = trackIndex;
-				trackIndex++;
-				break;
-			default:
-				DEBUG_BREAK;
-			}
-		}
-	}
-
-
-	if (rIn.modFlags) {
-		outFlagOffset = trackIndex;
-		trackIndex++;
-	}
-
-	for (int i = 3; i >= 0; --i) {
-		if (RIVER_SPEC_MODIFIES_OP(i) & rIn.specifiers) {
-			switch (RIVER_OPTYPE(rIn.opTypes[i])) {
-			case RIVER_OPTYPE_NONE:
-			case RIVER_OPTYPE_IMM:
-				break;
-			case RIVER_OPTYPE_MEM:
-				if (0 == (rIn.specifiers & RIVER_SPEC_IGNORES_MEMORY)) {
-					if (0 == rIn.operands[i].asAddress->type) {
-						inValueOffsets[i] = trackIndex;
-						trackIndex++;
-					}
-					else {
-						inValueOffsets[i] = trackIndex + 1;
-						trackIndex += 2;
-					}
-				}
-			case RIVER_OPTYPE_REG:
-				inValueOffsets[i] = trackIndex;
-				trackIndex++;
-				break;
-			default:
-				DEBUG_BREAK;
-			}
-		}
-	}
-}
-
 template <nodep::BYTE offset, nodep::BYTE size> void *RevSymbolicEnvironment::GetSubexpression(nodep::DWORD address) {
 	void *symExpr = (void *)TrackAddrWrapper(pEnv, address, 0);
 	if (symExpr == nullptr) {
@@ -178,11 +73,31 @@ RevSymbolicEnvironment::GetSubExpFunc RevSymbolicEnvironment::subExpsGet[4][5] =
 	{ nullptr, &RevSymbolicEnvironment::GetSubexpression<3, 1>, &RevSymbolicEnvironment::GetSubexpressionInvalid, &RevSymbolicEnvironment::GetSubexpressionInvalid, &RevSymbolicEnvironment::GetSubexpressionInvalid },
 };
 
-void *RevSymbolicEnvironment::GetExpression(nodep::DWORD address, nodep::DWORD size) {
+void *RevSymbolicEnvironment::GetExpression(nodep::DWORD address, nodep::DWORD size, nodep::DWORD concreteValue) {
 	static const nodep::DWORD sizes[3] = { 4, 2, 1 };
 	nodep::DWORD sz = sizes[RIVER_OPSIZE(size)];
+	const AddressContainer &ac = ((ExecutionEnvironment *)pEnv)->ac;
+
+	// fast path: the vast majority of accesses touch no symbolic byte
+	nodep::DWORD last = address + sz - 1;
+	if (!ac.MayBeSet(address) && !ac.MayBeSet(last)) {
+		return nullptr;
+	}
+
+	void *first = (void *)ac.Get(address);
+	void *second = (0 != ((address ^ last) & ~0x03)) ? (void *)ac.Get(last) : nullptr;
+
+	if ((nullptr == first) && (nullptr == second)) {
+		return nullptr;
+	}
+
+	if ((4 == sz) && (0 == (address & 0x03))) {
+		addRefFunc(first);
+		return first;
+	}
 	
 	void *ret = nullptr;
+	nodep::DWORD done = 0;
 
 	while (sz) {
 		nodep::DWORD fa = address & (~0x03), fo = address & 0x03;
@@ -194,6 +109,15 @@ void *RevSymbolicEnvironment::GetExpression(nodep::DWORD address, nodep::DWORD s
 
 		void *tmp = (this->*subExpsGet[fo][copy])(address);
 
+		// concrete part of a partially symbolic operand
+		if (nullptr == tmp) {
+			tmp = exec->MakeConst(
+				(concreteValue >> (done << 3)) & (((1 << ((copy << 3) - 1)) << 1) - 1),
+				copy << 3
+			);
+		}
+		done += copy;
+
 		if (nullptr == ret) {
 			ret = tmp;
 		} else {
@@ -369,13 +293,20 @@ void RevSymbolicEnvironment::SetExpression(void *exp, nodep::DWORD address, node
 void RevSymbolicEnvironment::SetReferenceCounting(AddRefFunc addRef, DecRefFunc decRef) {
 	addRefFunc = addRef;
 	decRefFunc = decRef;
+
+	// forced register marks in the tracking code release the replaced expression
+	((ExecutionEnvironment *)pEnv)->runtimeContext.releaseTaint = decRef;
 }
 
 bool RevSymbolicEnvironment::SetCurrentInstruction(RiverInstruction *rIn, void *context) {
 	opBase = (nodep::DWORD *)context;
 	current = rIn;
+	layout = ::GetOperandLayout(rIn);
 
-	GetOperandLayout(*current);
+	if (0 == (RIVER_LAYOUT_VALID & layout->flags)) {
+		DEBUG_BREAK;
+		return false;
+	}
 	return true;
 }
 
@@ -398,7 +329,7 @@ bool RevSymbolicEnvironment::GetAddressBase(struct OperandInfo &opInfo) {
 	if (opInfo.fields) {
 		fprintf(stderr, "GetAddressBase [%d] => symb [0x%08lX]\n", opInfo.opIdx, (DWORD)opInfo.symbolic);
 	}
-	opInfo.concreteBefore = opBase[-((int)baseOffsets[opInfo.opIdx])];
+	opInfo.concreteBefore = opBase[-((int)layout->baseOffsets[opInfo.opIdx])];
 	opInfo.fields |= OP_HAS_CONCRETE_BEFORE;
 	return true;
 }
@@ -420,7 +351,7 @@ bool RevSymbolicEnvironment::GetAddressScaleAndIndex(struct OperandInfo &opInfo,
 	if (opInfo.fields) {
 		fprintf(stderr, "GetAddressScaleAndIndex [%d] => symb [0x%08lX]\n", opInfo.opIdx, (DWORD)opInfo.symbolic);
 	}
-	opInfo.concreteBefore = opBase[-((int)indexOffsets[opInfo.opIdx])];
+	opInfo.concreteBefore = opBase[-((int)layout->indexOffsets[opInfo.opIdx])];
 	opInfo.fields |= OP_HAS_CONCRETE_BEFORE;
 	return true;
 }
@@ -481,13 +412,13 @@ bool RevSymbolicEnvironment::GetOperand(struct OperandInfo &opInfo) {
 			opInfo.fields |= OP_HAS_SYMBOLIC;
 		}
 		
-		if (0xFFFFFFFF != inValueOffsets[opInfo.opIdx]) {
-			opInfo.concreteBefore = opBase[-((int)inValueOffsets[opInfo.opIdx])];
+		if (RIVER_LAYOUT_NO_OFFSET != layout->inValueOffsets[opInfo.opIdx]) {
+			opInfo.concreteBefore = opBase[-((int)layout->inValueOffsets[opInfo.opIdx])];
 			opInfo.fields |= OP_HAS_CONCRETE_BEFORE;
 		}
 
-		if (0xFFFFFFFF != outValueOffsets[opInfo.opIdx]) {
-			opInfo.concreteAfter = opBase[-((int)outValueOffsets[opInfo.opIdx])];
+		if (RIVER_LAYOUT_NO_OFFSET != layout->outValueOffsets[opInfo.opIdx]) {
+			opInfo.concreteAfter = opBase[-((int)layout->outValueOffsets[opInfo.opIdx])];
 			opInfo.fields |= OP_HAS_CONCRETE_AFTER;
 		}
 
@@ -508,13 +439,13 @@ bool RevSymbolicEnvironment::GetOperand(struct OperandInfo &opInfo) {
 				opInfo.fields |= OP_HAS_SYMBOLIC;
 			}
 
-			if (0xFFFFFFFF != inValueOffsets[opInfo.opIdx]) {
-				opInfo.concreteBefore = opBase[-((int)inValueOffsets[opInfo.opIdx])];
+			if (RIVER_LAYOUT_NO_OFFSET != layout->inValueOffsets[opInfo.opIdx]) {
+				opInfo.concreteBefore = opBase[-((int)layout->inValueOffsets[opInfo.opIdx])];
 				opInfo.fields |= OP_HAS_CONCRETE_BEFORE;
 			}
 
-			if (0xFFFFFFFF != outValueOffsets[opInfo.opIdx]) {
-				opInfo.concreteAfter = opBase[-((int)outValueOffsets[opInfo.opIdx])];
+			if (RIVER_LAYOUT_NO_OFFSET != layout->outValueOffsets[opInfo.opIdx]) {
+				opInfo.concreteAfter = opBase[-((int)layout->outValueOffsets[opInfo.opIdx])];
 				opInfo.fields |= OP_HAS_CONCRETE_AFTER;
 			}
 			//printf("[%d] <= getOperand mem reg 0x%lX\n", opInfo.opIdx, (DWORD)opInfo.symbolic);
@@ -527,12 +458,14 @@ bool RevSymbolicEnvironment::GetOperand(struct OperandInfo &opInfo) {
 
 		//symExpr = get from opBase[opOffset[opInfo.opIdx]]
 
-		if (opBase[-((int)addressOffsets[opInfo.opIdx])] < 0x1000) {
+		if (opBase[-((int)layout->addressOffsets[opInfo.opIdx])] < 0x1000) {
 			DEBUG_BREAK;
 		}
 
-		symExpr = GetExpression(opBase[-((int)addressOffsets[opInfo.opIdx])],
-				RIVER_OPSIZE(current->opTypes[opInfo.opIdx])); //(void *)TrackAddrWrapper(pEnv, opBase[-(addressOffsets[opInfo.opIdx])], 0);
+		symExpr = GetExpression(opBase[-((int)layout->addressOffsets[opInfo.opIdx])],
+				RIVER_OPSIZE(current->opTypes[opInfo.opIdx]),
+				(RIVER_LAYOUT_NO_OFFSET != layout->inValueOffsets[opInfo.opIdx]) ? opBase[-((int)layout->inValueOffsets[opInfo.opIdx])] : 0
+		); //(void *)TrackAddrWrapper(pEnv, opBase[-(layout->addressOffsets[opInfo.opIdx])], 0);
 		opInfo.fields = 0;
 
 		if (symExpr) {
@@ -540,13 +473,13 @@ bool RevSymbolicEnvironment::GetOperand(struct OperandInfo &opInfo) {
 			opInfo.fields |= OP_HAS_SYMBOLIC;
 		}
 
-		if (0xFFFFFFFF != inValueOffsets[opInfo.opIdx]) {
-			opInfo.concreteBefore = opBase[-((int)inValueOffsets[opInfo.opIdx])];
+		if (RIVER_LAYOUT_NO_OFFSET != layout->inValueOffsets[opInfo.opIdx]) {
+			opInfo.concreteBefore = opBase[-((int)layout->inValueOffsets[opInfo.opIdx])];
 			opInfo.fields |= OP_HAS_CONCRETE_BEFORE;
 		}
 
-		if (0xFFFFFFFF != outValueOffsets[opInfo.opIdx]) {
-			opInfo.concreteAfter = opBase[-((int)outValueOffsets[opInfo.opIdx])];
+		if (RIVER_LAYOUT_NO_OFFSET != layout->outValueOffsets[opInfo.opIdx]) {
+			opInfo.concreteAfter = opBase[-((int)layout->outValueOffsets[opInfo.opIdx])];
 			opInfo.fields |= OP_HAS_CONCRETE_AFTER;
 		}
 		return true;
@@ -595,13 +528,13 @@ bool RevSymbolicEnvironment::GetFlgValue(struct FlagInfo &flagInfo) {
 		flagInfo.fields |= OP_HAS_SYMBOLIC;
 	}
 
-	if (0xFFFFFFFF != inFlagOffset) {
-		flagInfo.concreteBefore = (opBase[inFlagOffset] >> flagShifts[flgIdx]) & 1;
+	if (RIVER_LAYOUT_NO_OFFSET != layout->inFlagOffset) {
+		flagInfo.concreteBefore = (opBase[-((int)layout->inFlagOffset)] >> flagShifts[flgIdx]) & 1;
 		flagInfo.fields |= OP_HAS_CONCRETE_BEFORE;
 	}
 
-	if (0xFFFFFFFF != outFlagOffset) {
-		flagInfo.concreteAfter = (opBase[outFlagOffset] >> flagShifts[flgIdx]) & 1;
+	if (RIVER_LAYOUT_NO_OFFSET != layout->outFlagOffset) {
+		flagInfo.concreteAfter = (opBase[-((int)layout->outFlagOffset)] >> flagShifts[flgIdx]) & 1;
 		flagInfo.fields |= OP_HAS_CONCRETE_AFTER;
 	}
 
@@ -642,8 +575,8 @@ bool RevSymbolicEnvironment::SetOperand(nodep::BYTE opIdx, void *symbolicValue,
 			//printf("[%d] SetOperand Mem Reg <= 0x%08lX\n", opIdx, (DWORD)symbolicValue);
 		}
 		else {
-			//MarkAddrWrapper(pEnv, opBase[-(addressOffsets[opIdx])], (rev::DWORD)symbolicValue, 0);
-			SetExpression(symbolicValue, opBase[-((int)addressOffsets[opIdx])], RIVER_OPSIZE(current->opTypes[opIdx]), &opBase[-((int)outValueOffsets[opIdx])]);
+			//MarkAddrWrapper(pEnv, opBase[-(layout->addressOffsets[opIdx])], (rev::DWORD)symbolicValue, 0);
+			SetExpression(symbolicValue, opBase[-((int)layout->addressOffsets[opIdx])], RIVER_OPSIZE(current->opTypes[opIdx]), &opBase[-((int)layout->outValueOffsets[opIdx])]);
 			//printf("[%d] SetOperand Mem <= 0x%08lX\n", opIdx, (DWORD)symbolicValue);
 		}
 		return true;
@@ -2,6 +2,7 @@
 #define _REV_SYMBOLIC_ENVIRONMENT_H_
 
 #include "SymbolicEnvironment.h"
+#include "../revtracer/OperandLayout.h"
 
 class ExecutionController;
 
@@ -11,21 +12,14 @@ private :
 	ExecutionController *ctrl;
 	nodep::DWORD *opBase;
 	
-	nodep::DWORD addressOffsets[4];
-	nodep::DWORD baseOffsets[4];
-	nodep::DWORD indexOffsets[4];
-	nodep::DWORD inValueOffsets[4];
-	nodep::DWORD outValueOffsets[4];
-	nodep::DWORD inFlagOffset;
-	nodep::DWORD outFlagOffset;
+	// precomputed by the SymbopTranslator, see OperandLayout.h
+	const RiverOperandLayout *layout;
 
 	AddRefFunc addRefFunc;
 	DecRefFunc decRefFunc;
 
 	void *pEnv;
 
-	void GetOperandLayout(const RiverInstruction &rIn);
-
 	typedef void *(RevSymbolicEnvironment::*GetSubExpFunc)(nodep::DWORD address);
 	template <nodep::BYTE offset, nodep::BYTE size> void *GetSubexpression(nodep::DWORD address);
 	void *GetSubexpressionInvalid(nodep::DWORD address);
@@ -38,7 +32,7 @@ private :
 	void SetSubexpressionInvalid(void *expr, nodep::DWORD address, void *value);
 	static SetSubExpFunc subExpsSet[4][5];
 
-	void *GetExpression(nodep::DWORD address, nodep::DWORD size);
+	void *GetExpression(nodep::DWORD address, nodep::DWORD size, nodep::DWORD concreteValue);
 	void SetExpression(void *exp, nodep::DWORD address, nodep::DWORD size, nodep::DWORD *values);
 
 
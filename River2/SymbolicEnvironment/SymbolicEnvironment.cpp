@@ -97,4 +97,24 @@ namespace sym {
 		this->mCount = mCount;
 		this->mInfo = mInfo;
 	}
+
+	void SymbolicExecutor::ExecuteStream(void *records, nodep::DWORD size) {
+		nodep::BYTE *ptr = (nodep::BYTE *)records;
+		nodep::BYTE *end = ptr + size;
+
+		while (ptr < end) {
+			rev::SymbolicStreamRecord *record = (rev::SymbolicStreamRecord *)ptr;
+			nodep::DWORD *values = (nodep::DWORD *)&record[1];
+			RiverInstruction *instruction = (RiverInstruction *)record->instruction;
+
+			// values are stored lowest address first, the environment
+			// expects the tracking pointer (the last value)
+			void *context = (0 != record->valueCount) ? &values[record->valueCount - 1] : nullptr;
+			if (env->SetCurrentInstruction(instruction, context)) {
+				Execute(instruction);
+			}
+
+			ptr += sizeof(*record) + record->valueCount * sizeof(values[0]);
+		}
+	}
 };
@@ -223,6 +223,10 @@ namespace sym {
 		// The environment might be subject to change as more features are added
 		virtual void Execute(RiverInstruction *instruction) = 0;
 		void SetModuleData(int mCount, ModuleInfo *mInfo);
+
+		// Executes a batch of records produced in symbolic stream mode
+		// (see rev::SymbolicStreamRecord). Call this from the symbolic stream handler.
+		void ExecuteStream(void *records, nodep::DWORD size);
 	};
 
 }; // namespace sym
@@ -10,6 +10,7 @@ struct RiverInstruction {
 	nodep::BYTE disassFlags, modFlags, testFlags;
 
 	nodep::BYTE opTypes[4];
+	nodep::BYTE liveFlags;
 	union RiverOperand operands[4];
 
 	nodep::DWORD instructionAddress;
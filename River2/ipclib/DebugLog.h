@@ -0,0 +1,127 @@
+#ifndef _DEBUG_LOG_H_
+#define _DEBUG_LOG_H_
+
+#include "../revtracer/DebugPrintFlags.h"
+
+/* Binary debug log. The traced process does not format its messages, it
+ * stores the id of the format string and the raw arguments. Every format is
+ * written once, before its first event. The text is produced offline by
+ * debuglog.decoder. */
+
+#define DEBUG_LOG_RECORD_FORMAT		0x0001 // record, NUL terminated format string
+#define DEBUG_LOG_RECORD_EVENT		0x0002 // record, raw arguments
+#define DEBUG_LOG_RECORD_DROPPED	0x0003 // record, formatId holds the number of lost records
+
+#define DEBUG_LOG_MAX_FORMATS		0x400 // power of 2
+#define DEBUG_LOG_MAX_ARGS			0x10
+#define DEBUG_LOG_MAX_RECORD		0x200
+
+#define DEBUG_LOG_ARG_DWORD			0x01
+#define DEBUG_LOG_ARG_QWORD			0x02 // ll and I64 integers, doubles
+#define DEBUG_LOG_ARG_STRING		0x03 // copied in the record, NUL terminated and padded to a dword
+
+// runtime filter, one bit for every execution stage (PRINT_EXECUTION_MASK)
+#define DEBUG_LOG_STAGE(printMask)	(1 << (((printMask) & PRINT_EXECUTION_MASK) >> PRINT_EXECUTION_SHIFT))
+#define DEBUG_LOG_ALL_STAGES		0xFFFF
+
+namespace ipc {
+	struct DebugLogRecord {
+		unsigned short type;
+		unsigned short size; // whole record, multiple of 4
+		unsigned int formatId;
+		unsigned int printMask;
+	};
+
+	/* Finds the next conversion in [fmt, fmtEnd). Returns its '%' and sets end
+	 * past it, or returns 0. kinds receives the arguments it consumes ('*'
+	 * fields first), precision is -1 when missing. Used by both the encoder
+	 * and the decoder, they must agree on the layout. */
+	inline const char *DebugLogNextConversion(const char *fmt, const char *fmtEnd, const char *&end, unsigned char *kinds, int &kindCount, int &precision) {
+		for (; fmt < fmtEnd; ++fmt) {
+			if ('%' != *fmt) {
+				continue;
+			}
+
+			const char *p = fmt + 1;
+			if ((p < fmtEnd) && ('%' == *p)) {
+				fmt = p;
+				continue;
+			}
+
+			kindCount = 0;
+			precision = -1;
+
+			while ((p < fmtEnd) && (('-' == *p) || ('+' == *p) || (' ' == *p) || ('#' == *p) || ('0' == *p))) {
+				p++;
+			}
+
+			if ((p < fmtEnd) && ('*' == *p)) {
+				kinds[kindCount++] = DEBUG_LOG_ARG_DWORD;
+				p++;
+			} else {
+				while ((p < fmtEnd) && ('0' <= *p) && (*p <= '9')) {
+					p++;
+				}
+			}
+
+			if ((p < fmtEnd) && ('.' == *p)) {
+				p++;
+				if ((p < fmtEnd) && ('*' == *p)) {
+					kinds[kindCount++] = DEBUG_LOG_ARG_DWORD;
+					p++;
+				} else {
+					precision = 0;
+					while ((p < fmtEnd) && ('0' <= *p) && (*p <= '9')) {
+						precision = precision * 10 + (*p - '0');
+						p++;
+					}
+				}
+			}
+
+			bool wide = false, narrow = true;
+			if ((p + 1 < fmtEnd) && ('l' == p[0]) && ('l' == p[1])) {
+				wide = true;
+				p += 2;
+			} else if ((p + 2 < fmtEnd) && ('I' == p[0]) && ('6' == p[1]) && ('4' == p[2])) {
+				wide = true;
+				p += 3;
+			} else {
+				while ((p < fmtEnd) && (('h' == *p) || ('l' == *p) || ('z' == *p) || ('j' == *p) || ('t' == *p))) {
+					narrow &= ('l' != *p);
+					p++;
+				}
+			}
+
+			if (p >= fmtEnd) {
+				return 0;
+			}
+
+			switch (*p) {
+				case 's' :
+					// wide strings are kept as pointers
+					kinds[kindCount++] = narrow ? DEBUG_LOG_ARG_STRING : DEBUG_LOG_ARG_DWORD;
+					break;
+				case 'f' :
+				case 'F' :
+				case 'e' :
+				case 'E' :
+				case 'g' :
+				case 'G' :
+				case 'a' :
+				case 'A' :
+					kinds[kindCount++] = DEBUG_LOG_ARG_QWORD;
+					break;
+				default :
+					kinds[kindCount++] = wide ? DEBUG_LOG_ARG_QWORD : DEBUG_LOG_ARG_DWORD;
+					break;
+			}
+
+			end = p + 1;
+			return fmt;
+		}
+
+		return 0;
+	}
+};
+
+#endif
@@ -0,0 +1,259 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "DebugLog.h"
+
+/* Offline decoder of the binary debug log written by ipclib.
+ * usage: debuglog.decoder debug.log [out.txt] */
+
+const char messageTypes[][4] = {
+	"___",
+	"ERR",
+	"INF",
+	"DBG"
+};
+
+const char executionStages[][6] = {
+	"_____",
+	"BRHND",
+	"DIASM",
+	"TRANS",
+	"REASM",
+	"RUNTM",
+	"INSPT",
+	"CNTNR"
+};
+
+const char codeTypes[][4] = {
+	"___",
+	"NAT",
+	"RIV",
+	"TRK",
+	"SYM"
+};
+
+const char codeDirections[] = {
+	'_', 'F', 'B'
+};
+
+template <typename T, int N> const T &Name(const T (&names)[N], unsigned int idx) {
+	return names[(idx < N) ? idx : 0];
+}
+
+template <typename T> int Format(char *text, size_t size, const std::string &spec, int kindCount, const unsigned int *stars, T value) {
+	switch (kindCount) {
+		case 1 :
+			return snprintf(text, size, spec.c_str(), value);
+		case 2 :
+			return snprintf(text, size, spec.c_str(), stars[0], value);
+		default :
+			return snprintf(text, size, spec.c_str(), stars[0], stars[1], value);
+	}
+}
+
+class DebugLogDecoder {
+private:
+	FILE *out;
+	std::map<unsigned int, std::string> formats;
+	char lastChar;
+
+	void Prefix(unsigned int printMask) {
+		fprintf(out, "[%3s|%5s|%3s|%c] ",
+			Name(messageTypes, (printMask & PRINT_MESSAGE_MASK) >> PRINT_MESSAGE_SHIFT),
+			Name(executionStages, (printMask & PRINT_EXECUTION_MASK) >> PRINT_EXECUTION_SHIFT),
+			Name(codeTypes, (printMask & PRINT_CODE_TYPE_MASK) >> PRINT_CODE_TYPE_SHIFT),
+			Name(codeDirections, (printMask & PRINT_CODE_DIRECTION_MASK) >> PRINT_CODE_DIRECTION_SHIFT)
+		);
+	}
+
+	void Text(unsigned int printMask, const char *text, size_t size) {
+		for (size_t i = 0; i < size; ++i) {
+			if ('\n' == lastChar) {
+				Prefix(printMask);
+			}
+			lastChar = text[i];
+			fputc(lastChar, out);
+		}
+	}
+
+	// format text between conversions, "%%" is printed as '%'
+	void Literal(unsigned int printMask, const char *p, const char *pEnd) {
+		for (; p < pEnd; ++p) {
+			Text(printMask, p, 1);
+			if (('%' == p[0]) && (p + 1 < pEnd) && ('%' == p[1])) {
+				++p;
+			}
+		}
+	}
+
+	void Event(const ipc::DebugLogRecord *rec, const unsigned char *args, const unsigned char *argsEnd) {
+		std::map<unsigned int, std::string>::const_iterator fIt = formats.find(rec->formatId);
+		if (formats.end() == fIt) {
+			fprintf(out, "<unknown format %u>\n", rec->formatId);
+			lastChar = '\n';
+			return;
+		}
+
+		const char *fmt = fIt->second.c_str();
+		const char *fmtEnd = fmt + fIt->second.size();
+		const char *conv, *end = fmt, *last = fmt;
+		unsigned char kinds[3];
+		int kindCount, precision;
+		char text[4096];
+
+		while (0 != (conv = ipc::DebugLogNextConversion(end, fmtEnd, end, kinds, kindCount, precision))) {
+			Literal(rec->printMask, last, conv);
+			last = end;
+
+			std::string spec(conv, end);
+			unsigned int stars[2] = { 0, 0 };
+			int n = -1;
+
+			for (int k = 0; k < kindCount; ++k) {
+				if (k < kindCount - 1) {
+					// '*' width and precision
+					if (args + sizeof(unsigned int) <= argsEnd) {
+						memcpy(&stars[k], args, sizeof(unsigned int));
+					}
+					args += sizeof(unsigned int);
+					continue;
+				}
+
+				if (DEBUG_LOG_ARG_STRING == kinds[k]) {
+					const char *str = (const char *)args;
+					size_t len = (args < argsEnd) ? strnlen(str, argsEnd - args) : 0;
+
+					// the length is already limited by the encoder
+					n = snprintf(text, sizeof(text), "%.*s", (int)len, str);
+					args += (len + 4) & ~3;
+				} else if (DEBUG_LOG_ARG_QWORD == kinds[k]) {
+					unsigned long long qw = 0;
+					if (args + sizeof(qw) <= argsEnd) {
+						memcpy(&qw, args, sizeof(qw));
+					}
+					args += sizeof(qw);
+
+					if (strchr("fFeEgGaA", spec[spec.size() - 1])) {
+						double d;
+						memcpy(&d, &qw, sizeof(d));
+						n = Format(text, sizeof(text), spec, kindCount, stars, d);
+					} else {
+						size_t i64 = spec.find("I64");
+						if (std::string::npos != i64) {
+							spec.replace(i64, 3, "ll");
+						}
+						n = Format(text, sizeof(text), spec, kindCount, stars, qw);
+					}
+				} else {
+					unsigned int dw = 0;
+					if (args + sizeof(dw) <= argsEnd) {
+						memcpy(&dw, args, sizeof(dw));
+					}
+					args += sizeof(dw);
+
+					if ('s' == spec[spec.size() - 1]) {
+						// wide strings are not copied by the encoder
+						n = snprintf(text, sizeof(text), "<wstr@%08x>", dw);
+					} else {
+						n = Format(text, sizeof(text), spec, kindCount, stars, dw);
+					}
+				}
+			}
+
+			if (n > 0) {
+				Text(rec->printMask, text, ((size_t)n < sizeof(text)) ? n : sizeof(text) - 1);
+			}
+		}
+
+		Literal(rec->printMask, last, fmtEnd);
+	}
+
+public:
+	DebugLogDecoder(FILE *o) : out(o), lastChar('\n') { }
+
+	/* Decodes the records in buff, returns the number of bytes used. A
+	 * partial record at the end is left for the next call. */
+	size_t Decode(const unsigned char *buff, size_t size) {
+		size_t pos = 0;
+
+		while (pos + sizeof(ipc::DebugLogRecord) <= size) {
+			const ipc::DebugLogRecord *rec = (const ipc::DebugLogRecord *)&buff[pos];
+
+			if ((rec->size < sizeof(*rec)) || (rec->size & 3)) {
+				fprintf(stderr, "Corrupted record at offset %u\n", (unsigned int)pos);
+				return size;
+			}
+
+			if (pos + rec->size > size) {
+				break;
+			}
+
+			const unsigned char *payload = &buff[pos + sizeof(*rec)];
+			const unsigned char *payloadEnd = &buff[pos + rec->size];
+
+			switch (rec->type) {
+				case DEBUG_LOG_RECORD_FORMAT :
+					formats[rec->formatId] = std::string((const char *)payload, strnlen((const char *)payload, payloadEnd - payload));
+					break;
+				case DEBUG_LOG_RECORD_EVENT :
+					Event(rec, payload, payloadEnd);
+					break;
+				case DEBUG_LOG_RECORD_DROPPED :
+					fprintf(out, "%s<%u messages lost>\n", ('\n' == lastChar) ? "" : "\n", rec->formatId);
+					lastChar = '\n';
+					break;
+				default :
+					fprintf(stderr, "Unknown record type %u at offset %u\n", rec->type, (unsigned int)pos);
+					break;
+			}
+
+			pos += rec->size;
+		}
+
+		return pos;
+	}
+};
+
+int main(int argc, char *argv[]) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s debug.log [out.txt]\n", argv[0]);
+		return 1;
+	}
+
+	FILE *in = fopen(argv[1], "rb");
+	if (NULL == in) {
+		fprintf(stderr, "Cannot open %s\n", argv[1]);
+		return 1;
+	}
+
+	FILE *out = stdout;
+	if ((argc > 2) && (NULL == (out = fopen(argv[2], "w")))) {
+		fprintf(stderr, "Cannot open %s\n", argv[2]);
+		fclose(in);
+		return 1;
+	}
+
+	DebugLogDecoder decoder(out);
+	std::vector<unsigned char> buff;
+	unsigned char chunk[0x10000];
+	size_t rd;
+
+	while (0 != (rd = fread(chunk, 1, sizeof(chunk), in))) {
+		buff.insert(buff.end(), chunk, chunk + rd);
+		buff.erase(buff.begin(), buff.begin() + decoder.Decode(&buff[0], buff.size()));
+	}
+
+	if (!buff.empty()) {
+		fprintf(stderr, "%u trailing bytes\n", (unsigned int)buff.size());
+	}
+
+	fclose(in);
+	if (stdout != out) {
+		fclose(out);
+	}
+	return 0;
+}
@@ -1,16 +1,35 @@
 #ifndef _RING_BUFFER_H_
 #define _RING_BUFFER_H_
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#define RING_BUFFER_BARRIER() _ReadWriteBarrier()
+#else
+#define RING_BUFFER_BARRIER() __asm__ __volatile__ ("" : : : "memory")
+#endif
+
 namespace ipc {
+	/* Single producer, single consumer byte queue. The producer only moves head
+	 * and the consumer only moves tail, thus no lock is needed. Data is copied
+	 * before the index is published. Write never overwrites unread data, a
+	 * block that does not fit is rejected whole. */
 	template <int SZ> class RingBuffer {
 	private:
 		char buffer[SZ];
 		volatile int head, tail;
 
+		static void Copy(char *dst, const char *src, int size) {
+#ifdef _MSC_VER
+			// ipclib does not link the CRT on Windows
+			__movsb((unsigned char *)dst, (const unsigned char *)src, size);
+#else
+			__builtin_memcpy(dst, src, size);
+#endif
+		}
+
 	public:
 		void Init() {
 			head = tail = 0;
-			buffer[0] = 0;
 		}
 
 		bool IsEmpty() const {
@@ -24,54 +43,47 @@ namespace ipc {
 
 		void Read(char *buf, int size, int &read) {
 			int vH = head;
-			if (vH < tail) {
-				vH += SZ;
-			}
+			int vT = tail;
+			RING_BUFFER_BARRIER();
 
-			read = vH - tail;
+			read = (vH - vT + SZ) % SZ;
 			if (size < read) {
 				read = size;
 			}
 
-			int dwLast = (tail + read) % SZ;
-
-			for (int p = 0; tail != dwLast; ++p) {
-				buf[p] = buffer[tail];
-				tail++;
-				if (tail >= SZ) {
-					tail -= SZ;
-				}
+			int first = SZ - vT;
+			if (first > read) {
+				first = read;
 			}
+
+			Copy(buf, &buffer[vT], first);
+			Copy(buf + first, buffer, read - first);
+
+			RING_BUFFER_BARRIER();
+			tail = (vT + read) % SZ;
 		}
 
-		void Write(char *buf, int size) {
+		bool Write(const char *buf, int size) {
+			int vH = head;
 			int vT = tail;
 
-			if (vT <= head) {
-				vT += SZ;
+			if (size > (vT - vH - 1 + SZ) % SZ) {
+				return false;
 			}
 
-			int write = vT - head - 1;
-
-			if (size > write) {
-				tail = (head + write + 1) % SZ;
-			}
-			else if (size < write) {
-				write = size;
+			int first = SZ - vH;
+			if (first > size) {
+				first = size;
 			}
 
-			int dwLast = (head + write) % SZ;
+			Copy(&buffer[vH], buf, first);
+			Copy(buffer, buf + first, size - first);
 
-			for (int p = 0; head != dwLast; ++p) {
-				buffer[head] = buf[p];
-				head++;
-				if (head >= SZ) {
-					head -= SZ;
-				}
-			}
-			buffer[dwLast] = '\0';
+			RING_BUFFER_BARRIER();
+			head = (vH + size) % SZ;
+			return true;
 		}
 	};
 };
 
-#endif
\ No newline at end of file
+#endif
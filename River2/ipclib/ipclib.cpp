@@ -2,6 +2,7 @@
 
 #include "../revtracer/DebugPrintFlags.h"
 #include "common.h"
+#include "DebugLog.h"
 
 namespace ipc {
 	typedef char *va_list;
@@ -19,80 +20,180 @@ namespace ipc {
 	//AbstractTokenRing *ipcToken = &__ipcToken;
 	DLL_IPC_PUBLIC IpcData ipcData;
 
-	int GeneratePrefix(char *buff, int size, ...) {
-		va_list va;
+	/* Binary debug log (see DebugLog.h) */
+	struct DebugLogFormat {
+		const char *fmt;
+		unsigned int length; // the part of the format that is in the log
+		unsigned char argCount;
+		unsigned char args[DEBUG_LOG_MAX_ARGS];
+		short limits[DEBUG_LOG_MAX_ARGS]; // string precision
+		bool defined;
+	};
 
-		va_start(va, size);
-		int sz = ((_vsnprintf_sFunc)ipcImports.vsnprintf_sFunc)(
-			buff, 
-			size - 1, 
-			"[%3s|%5s|%3s|%c] ",
-			va
-		);
-		va_end(va);
+	DebugLogFormat debugFormats[DEBUG_LOG_MAX_FORMATS];
+	DWORD debugDropped = 0;
+	DLL_IPC_PUBLIC DWORD debugMask = DEBUG_LOG_ALL_STAGES;
+
+	static BYTE recordBuff[DEBUG_LOG_MAX_RECORD];
 
-		return sz;
+	/* DebugPrint may be called by several traced threads, while debugLog has a
+	 * single producer. The format table, recordBuff, debugDropped and the
+	 * writes to debugLog are all guarded by this spin lock. */
+	static volatile long debugLock = 0;
+
+	static long DebugLockExchange(volatile long *target, long value) {
+#ifdef _MSC_VER
+		return _InterlockedExchange(target, value);
+#else
+		asm volatile("xchgl %0, %1" : "+r"(value), "+m"(*target) : : "memory");
+		return value;
+#endif
 	}
 
-	char tmpBuff[512];
+	DebugLogFormat *FindFormat(const char *fmt) {
+		DWORD h = (((DWORD)fmt >> 2) * 0x9E3779B1) >> 22;
 
-	char pfxBuff[] = "[___|_____|___|_]      ";
-	static char lastChar = '\n';
+		for (DWORD i = 0; i < DEBUG_LOG_MAX_FORMATS; ++i) {
+			DebugLogFormat *format = &debugFormats[(h + i) & (DEBUG_LOG_MAX_FORMATS - 1)];
 
-	const char messageTypes[][4] = {
-		"___",
-		"ERR",
-		"INF",
-		"DBG"
-	};
+			if (fmt == format->fmt) {
+				return format;
+			}
 
-	const char executionStages[][6] = {
-		"_____",
-		"BRHND",
-		"DIASM",
-		"TRANS",
-		"REASM",
-		"RUNTM",
-		"INSPT",
-		"CNTNR"
-	};
+			if (NULL == format->fmt) {
+				// the argument layout is computed once for every format
+				unsigned int length = 0;
+				while (fmt[length] && (length < DEBUG_LOG_MAX_RECORD - sizeof(DebugLogRecord) - 1)) {
+					length++;
+				}
+
+				format->fmt = fmt;
+				format->length = length;
+				format->argCount = 0;
+				format->defined = false;
+
+				const char *end = fmt, *fmtEnd = fmt + length;
+				unsigned char kinds[3];
+				int kindCount, precision;
+				while (0 != DebugLogNextConversion(end, fmtEnd, end, kinds, kindCount, precision)) {
+					for (int k = 0; (k < kindCount) && (format->argCount < DEBUG_LOG_MAX_ARGS); ++k) {
+						format->limits[format->argCount] = (short)precision;
+						format->args[format->argCount++] = kinds[k];
+					}
+				}
+
+				return format;
+			}
+		}
 
-	const char codeTypes[][4] = {
-		"___",
-		"NAT",
-		"RIV",
-		"TRK",
-		"SYM"
-	};
+		return NULL;
+	}
 
-	const char codeDirections[] = {
-		'_', 'F', 'B'
-	};
+	bool WriteRecord(WORD type, DWORD formatId, DWORD printMask, const void *payload, DWORD size) {
+		DebugLogRecord *rec = (DebugLogRecord *)recordBuff;
+		DWORD total = (sizeof(*rec) + size + 3) & ~3;
+
+		rec->type = type;
+		rec->size = (WORD)total;
+		rec->formatId = formatId;
+		rec->printMask = printMask;
+		for (DWORD i = 0; i < total - sizeof(*rec); ++i) {
+			recordBuff[sizeof(*rec) + i] = (i < size) ? ((const BYTE *)payload)[i] : 0;
+		}
+
+		return debugLog.Write((const char *)recordBuff, total);
+	}
+
+	static void DebugPrintLocked(DWORD printMask, const char *fmt, va_list va) {
+		DebugLogFormat *format = FindFormat(fmt);
+		if (NULL == format) {
+			debugDropped++;
+			return;
+		}
+
+		DWORD formatId = format - debugFormats;
+		if (!format->defined) {
+			if (!WriteRecord(DEBUG_LOG_RECORD_FORMAT, formatId, 0, fmt, format->length)) {
+				debugDropped++;
+				return;
+			}
+			format->defined = true;
+		}
+
+		if (0 != debugDropped) {
+			if (!WriteRecord(DEBUG_LOG_RECORD_DROPPED, debugDropped, 0, NULL, 0)) {
+				debugDropped++;
+				return;
+			}
+			debugDropped = 0;
+		}
+
+		// arguments are appended after the record header
+		DebugLogRecord *rec = (DebugLogRecord *)recordBuff;
+		DWORD size = sizeof(*rec);
+
+		for (DWORD i = 0; i < format->argCount; ++i) {
+			switch (format->args[i]) {
+				case DEBUG_LOG_ARG_DWORD :
+					*(DWORD *)&recordBuff[size] = va_arg(va, DWORD);
+					size += sizeof(DWORD);
+					break;
+				case DEBUG_LOG_ARG_QWORD :
+					*(QWORD *)&recordBuff[size] = va_arg(va, QWORD);
+					size += sizeof(QWORD);
+					break;
+				case DEBUG_LOG_ARG_STRING : {
+					const char *str = va_arg(va, const char *);
+					// leave room for the terminator, the padding and the remaining arguments
+					DWORD reserved = size + 4 + (format->argCount - i - 1) * sizeof(QWORD);
+					DWORD limit = (reserved < sizeof(recordBuff)) ? sizeof(recordBuff) - reserved : 0;
+
+					if (NULL == str) {
+						str = "(null)";
+					}
+
+					if ((format->limits[i] >= 0) && ((DWORD)format->limits[i] < limit)) {
+						limit = format->limits[i];
+					}
+
+					for (DWORD j = 0; (j < limit) && str[j]; ++j) {
+						recordBuff[size++] = str[j];
+					}
+					recordBuff[size++] = 0;
+					while (size & 3) {
+						recordBuff[size++] = 0;
+					}
+					break;
+				}
+			}
+		}
+
+		rec->type = DEBUG_LOG_RECORD_EVENT;
+		rec->size = (WORD)size;
+		rec->formatId = formatId;
+		rec->printMask = printMask;
+
+		if (!debugLog.Write((const char *)recordBuff, size)) {
+			debugDropped++;
+		}
+	}
 
 	void DebugPrint(DWORD printMask, const char *fmt, ...) {
 		va_list va;
 
+		if (0 == (debugMask & DEBUG_LOG_STAGE(printMask))) {
+			return;
+		}
 
-		if ('\n' == lastChar) {
-			int sz = GeneratePrefix(
-				pfxBuff,
-				sizeof(pfxBuff),
-				messageTypes[(printMask & PRINT_MESSAGE_MASK) >> PRINT_MESSAGE_SHIFT],
-				executionStages[(printMask & PRINT_EXECUTION_MASK) >> PRINT_EXECUTION_SHIFT],
-				codeTypes[(printMask & PRINT_CODE_TYPE_MASK) >> PRINT_CODE_TYPE_SHIFT],
-				codeDirections[(printMask & PRINT_CODE_DIRECTION_MASK) >> PRINT_CODE_DIRECTION_SHIFT]
-			);
-			debugLog.Write(pfxBuff, sz);
+		while (0 != DebugLockExchange(&debugLock, 1)) {
+			RING_BUFFER_BARRIER();
 		}
 
 		va_start(va, fmt);
-		int sz = ((_vsnprintf_sFunc)ipcImports.vsnprintf_sFunc)(tmpBuff, sizeof(tmpBuff)-1, fmt, va);
+		DebugPrintLocked(printMask, fmt, va);
 		va_end(va);
 
-		if (sz) {
-			debugLog.Write(tmpBuff, sz);
-			lastChar = tmpBuff[sz - 1];
-		}
+		DebugLockExchange(&debugLock, 0);
 	}
 
 
@@ -256,7 +357,8 @@ namespace ipc {
 		Initialize,
 
 		&debugLog,
-		&ipcData
+		&ipcData,
+		&debugMask
 	};
 
 	DLL_IPC_PUBLIC IpcImports ipcImports;
@@ -205,8 +205,12 @@ namespace ipc {
 
 		InitializeFunc initialize;
 
+		/* binary records, see DebugLog.h */
 		RingBuffer<(1 << 20)> *debugLog;
 		IpcData *ipcData;
+
+		/* runtime filter, DEBUG_LOG_STAGE bits of the messages that are kept */
+		DWORD *debugMask;
 	};
 
 	extern "C" {
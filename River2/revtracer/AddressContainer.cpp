@@ -37,6 +37,10 @@ void AddressContainer::FreePage(ContainerPage *page) {
 void AddressContainer::Init() {
 	root = NULL;
 
+	for (DWORD i = 0; i < sizeof(pageBitmap) / sizeof(pageBitmap[0]); ++i) {
+		pageBitmap[i] = 0;
+	}
+
 	InitPageAllocator();
 }
 
@@ -69,6 +73,10 @@ DWORD AddressContainer::Set(DWORD dwAddress, DWORD value) {
 	DWORD aMask = 0x3FF00000;
 	BYTE aShift = 20;
 
+	if (0 != value) {
+		pageBitmap[dwAddress >> 17] |= 1 << ((dwAddress >> 12) & 0x1F);
+	}
+
 	dwAddress >>= 2;
 
 	return RecursiveSet(root, dwAddress, value, aMask, aShift);
@@ -21,6 +21,10 @@ private :
 
 	ContainerPage *root;
 
+	// one bit per 4KB of address space, set once a tracked value is stored
+	// in that page (pages are never released, so neither are the bits)
+	nodep::DWORD pageBitmap[1 << 15];
+
 	nodep::DWORD RecursiveSet(ContainerPage *&page, nodep::DWORD dwAddress, nodep::DWORD value, nodep::DWORD mask, nodep::DWORD shift);
 	void RecursivePrintAddreses(ContainerPage *page, nodep::DWORD prefix, nodep::DWORD shift) const;
 public :
@@ -30,6 +34,11 @@ public :
 	nodep::DWORD Set(nodep::DWORD dwAddress, nodep::DWORD value);
 	nodep::DWORD Get(nodep::DWORD dwAddress) const;
 
+	// cheap check, false means Get(dwAddress) is certainly 0
+	inline bool MayBeSet(nodep::DWORD dwAddress) const {
+		return 0 != (pageBitmap[dwAddress >> 17] & (1 << ((dwAddress >> 12) & 0x1F)));
+	}
+
 	void PrintAddreses() const;
 };
 
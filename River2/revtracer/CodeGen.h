@@ -20,6 +20,10 @@
 #include "SymbopSaveTranslator.h"
 #include "SymbopReverseTranslator.h"
 
+#include "RiverPeepholeOptimizer.h"
+#include "RiverFlagsLiveness.h"
+#include "RiverTranslationCache.h"
+
 #define RIVER_FORWARD_INSTRUCTIONS					1024
 #define RIVER_BACKWARD_INSTRUCTIONS					1024
 
@@ -27,10 +31,18 @@
 #define SYMBOP_TRACK_FORWARD_INSTRUCTIONS			1024
 #define SYMBOP_TRACK_BACKWARD_INSTRUCTIONS			1024
 
+#define RIVER_CODE_PAGE_SIZE						0x1000
+#define RIVER_MAX_INSTRUCTION_SIZE					16
+
 /* A resettable river code translator */
 class RiverCodeGen {
 private :
 	RiverHeap *heap;
+	nodep::BYTE *retiredStub; // lazy tracking stub replaced while it was running
+
+	// guest code is probed with revtracerImports.isReadable before being decoded
+	bool checkReadable;
+	nodep::BYTE *readableEnd;
 	
 	RiverX86Disassembler disassembler;
 	X86Assembler assembler;
@@ -46,10 +58,19 @@ private :
 	SymbopSaveTranslator symbopSaveTranslator;
 	SymbopReverseTranslator symbopReverseTranslator;
 
+	RiverPeepholeOptimizer peepholeOptimizer;
+	RiverFlagsLiveness flagsLiveness;
+	RiverTranslationCache translationCache;
+
 	nodep::DWORD TranslateBasicBlock(nodep::BYTE *px86,
 			nodep::DWORD &dwInst, nodep::BYTE *&disasm,
 			nodep::DWORD dwTranslationFlags, nodep::DWORD *disassFlags,
 			struct rev::BranchNext *next, RevtracerError *rerror);
+
+	bool SaveBackward(RiverBasicBlock *pCB, nodep::DWORD dwTranslationFlags);
+	static void LazyReverseTracking(RiverCodeGen *cg, RiverBasicBlock *pCB, nodep::DWORD trackBuffer);
+	bool AssembleBackward(RiverBasicBlock *pCB, bool fromStub);
+	bool IsCodeReadable(nodep::BYTE *px86);
 public :
 	struct RiverInstruction fwRiverInst[RIVER_FORWARD_INSTRUCTIONS];
 	struct RiverInstruction bkRiverInst[RIVER_BACKWARD_INSTRUCTIONS];
@@ -63,7 +84,7 @@ public :
 	nodep::DWORD symbopInstCount;
 
 	unsigned char *outBuffer;
-	unsigned int regVersions[8];
+	unsigned int regVersions[16]; // 8 general purpose + 8 xmm
 
 	RelocableCodeBuffer codeBuffer;
 public :
@@ -74,7 +95,11 @@ public :
 	bool Destroy();
 	void Reset();
 
+	// used for code that was never executed (see RiverSpeculativeTranslator)
+	void EnableReadableCheck();
+
 	struct RiverAddress *AllocAddr(nodep::WORD flags);
+	bool CanAllocAddr(nodep::DWORD count) const;
 	struct RiverAddress *CloneAddress(const RiverAddress &mem, nodep::WORD flags);
 
 	unsigned int GetCurrentReg(unsigned char regName) const;
@@ -83,6 +108,8 @@ public :
 	unsigned int NextReg(unsigned char regName);
 
 	bool Translate(RiverBasicBlock *pCB, nodep::DWORD dwTranslationFlags, RevtracerError *rerror);
+	bool TranslateBackward(RiverBasicBlock *pCB);
+	bool TranslateSuperblock(RiverBasicBlock *pCB, RiverBasicBlock **pChain, nodep::DWORD dwCount, nodep::DWORD dwTranslationFlags, RevtracerError *rerror);
 	bool DisassembleSingle(nodep::BYTE *&px86, RiverInstruction *rOut, nodep::DWORD &count, nodep::DWORD &dwFlags, RevtracerError *rerror);
 };
 
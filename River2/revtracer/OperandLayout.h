@@ -0,0 +1,56 @@
+#ifndef _OPERAND_LAYOUT_H_
+#define _OPERAND_LAYOUT_H_
+
+#include "river.h"
+
+#define RIVER_LAYOUT_NO_OFFSET					0xFFFFFFFF
+
+#define RIVER_LAYOUT_VALID						0x00000001
+
+/* Describes where the concrete values of an instruction are saved on the
+ * tracking stack. Offsets are in dwords, counted downwards from the tracking
+ * pointer (esi) at the time the symbolic handler is invoked.
+ * The layout is filled in once, by the SymbopTranslator, when the basic
+ * block is translated. */
+struct RiverOperandLayout {
+	nodep::DWORD flags;
+
+	nodep::DWORD addressOffsets[4];
+	nodep::DWORD baseOffsets[4];
+	nodep::DWORD indexOffsets[4];
+	nodep::DWORD inValueOffsets[4];
+	nodep::DWORD outValueOffsets[4];
+	nodep::DWORD inFlagOffset;
+	nodep::DWORD outFlagOffset;
+
+	nodep::DWORD frameSize; // number of dwords saved for this instruction
+};
+
+/* Serialized form of a disassembled instruction (as stored in pDisasmCode).
+ * The instruction pointer passed to the symbolic handler always points inside
+ * such a structure, thus the layout can be retrieved without any lookup. */
+struct RiverSerializedInstruction {
+	RiverInstruction instruction;
+	RiverOperandLayout layout;
+};
+
+inline RiverOperandLayout *GetOperandLayout(const RiverInstruction *ri) {
+	return &((RiverSerializedInstruction *)ri)->layout;
+}
+
+inline void ResetOperandLayout(RiverOperandLayout &layout) {
+	layout.flags = 0;
+
+	for (int i = 0; i < 4; ++i) {
+		layout.addressOffsets[i] = RIVER_LAYOUT_NO_OFFSET;
+		layout.baseOffsets[i] = RIVER_LAYOUT_NO_OFFSET;
+		layout.indexOffsets[i] = RIVER_LAYOUT_NO_OFFSET;
+		layout.inValueOffsets[i] = RIVER_LAYOUT_NO_OFFSET;
+		layout.outValueOffsets[i] = RIVER_LAYOUT_NO_OFFSET;
+	}
+
+	layout.inFlagOffset = layout.outFlagOffset = RIVER_LAYOUT_NO_OFFSET;
+	layout.frameSize = 0;
+}
+
+#endif
@@ -231,9 +231,10 @@ void PreTrackingAssembler::AssemblePreTrackAddr(RiverAddress *addr, nodep::BYTE
 	instrCounter++;
 }
 
-void PreTrackingAssembler::AssemblePreTrackMem(RiverAddress *addr, nodep::BYTE riverFamily, nodep::BYTE repReg, RelocableCodeBuffer &px86, nodep::DWORD &instrCounter) {
+void PreTrackingAssembler::AssemblePreTrackMem(RiverAddress *addr, nodep::BYTE riverFamily, nodep::BYTE repReg, nodep::BYTE liveFlags, RelocableCodeBuffer &px86, nodep::DWORD &instrCounter) {
 
 	const nodep::BYTE andRegVal[] = { 0x9C, 0x83, 0xE0, 0xFC, 0x9D };
+	const nodep::BYTE andRegValNoFlags[] = { 0x83, 0xE0, 0xFC };
 	const nodep::BYTE pushEax4[] = { 0xFF, 0x70, 0x04 };
 	const nodep::BYTE pushEax[] = { 0xFF, 0x30 };
 	const nodep::BYTE segmentPrefix[] = { 0x00, 0x26, 0x2E, 0x36, 0x3E, 0x64, 0x65 };
@@ -377,9 +378,17 @@ void PreTrackingAssembler::AssemblePreTrackMem(RiverAddress *addr, nodep::BYTE r
 		instrCounter++;
 	}
 
-	rev_memcpy(px86.cursor, andRegVal, sizeof(andRegVal));
-	px86.cursor[2] += cReg;
-	px86.cursor += sizeof(andRegVal);
+	// the and clobbers the arithmetic flags, preserve them only if they are still read
+	if (liveFlags & RIVER_SPEC_FLAG_OSZAPC) {
+		rev_memcpy(px86.cursor, andRegVal, sizeof(andRegVal));
+		px86.cursor[2] += cReg;
+		px86.cursor += sizeof(andRegVal);
+		instrCounter += 2;
+	} else {
+		rev_memcpy(px86.cursor, andRegValNoFlags, sizeof(andRegValNoFlags));
+		px86.cursor[1] += cReg;
+		px86.cursor += sizeof(andRegValNoFlags);
+	}
 
 	rev_memcpy(px86.cursor, pushEax4, sizeof(pushEax4));
 	px86.cursor[1] += cReg;
@@ -389,7 +398,7 @@ void PreTrackingAssembler::AssemblePreTrackMem(RiverAddress *addr, nodep::BYTE r
 	px86.cursor[1] += cReg;
 	px86.cursor += sizeof(pushEax);
 
-	instrCounter += 5;
+	instrCounter += 3;
 
 	RestoreUnusedRegister(cReg, px86, 0);
 	instrCounter++;
@@ -416,14 +425,13 @@ bool PreTrackingAssembler::Translate(const RiverInstruction &ri, RelocableCodeBu
 		case 0xFF :
 			if (6 == ri.subOpCode) {
 				ClearPrefixes(ri, px86.cursor);
-				AssemblePreTrackMem(ri.operands[0].asAddress, ri.family, repReg, px86, instrCounter);
+				AssemblePreTrackMem(ri.operands[0].asAddress, ri.family, repReg, ri.liveFlags, px86, instrCounter);
 				break;
-			} else {
-				DEBUG_BREAK;
 			}
+			return false;
 
 		default :
-			DEBUG_BREAK;
+			return false;
 	}
 
 	return true;
@@ -11,7 +11,7 @@ private :
 	void RestoreUnusedRegister(nodep::BYTE reg, RelocableCodeBuffer &px86, int idx);
 
 	void AssemblePreTrackAddr(RiverAddress *addr, nodep::BYTE riverFamily, nodep::BYTE repReg, RelocableCodeBuffer &px86, nodep::DWORD &instrCounter);
-	void AssemblePreTrackMem(RiverAddress * addr, nodep::BYTE riverFamily, nodep::BYTE repReg, RelocableCodeBuffer &px86, nodep::DWORD & instrCounter);
+	void AssemblePreTrackMem(RiverAddress * addr, nodep::BYTE riverFamily, nodep::BYTE repReg, nodep::BYTE liveFlags, RelocableCodeBuffer &px86, nodep::DWORD & instrCounter);
 public :
 	virtual bool Translate(const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::BYTE &currentFamily, nodep::BYTE &repReg, nodep::DWORD &instrCounter, nodep::BYTE outputType);
 };
@@ -14,6 +14,7 @@ void RelocableCodeBuffer::Init(nodep::BYTE *buff) {
 
 void RelocableCodeBuffer::Reset() {
 	needsRAFix = needsRepFix = false;
+	failed = false;
 	rvAddress = NULL;
 	repInitCursor = NULL;
 	cursor = buffer;
@@ -24,6 +25,14 @@ void RelocableCodeBuffer::SetRelocation(nodep::BYTE *reloc) {
 	rvAddress = reloc;
 }
 
+void RelocableCodeBuffer::MarkFailed() {
+	failed = true;
+}
+
+bool RelocableCodeBuffer::Failed() const {
+	return failed;
+}
+
 void RelocableCodeBuffer::CopyToFixed(nodep::BYTE *dst) const {
 	rev_memcpy(dst, buffer, cursor - buffer);
 	if (needsRAFix) {
@@ -9,6 +9,7 @@ private :
 	nodep::BYTE *buffer;
 	nodep::BYTE *repInitCursor;
 	bool needsRAFix, needsRepFix;
+	bool failed;
 	nodep::BYTE *rvAddress;
 public :
 	nodep::BYTE *cursor;
@@ -20,6 +21,10 @@ public :
 	void SetRelocation(nodep::BYTE *reloc);
 	void CopyToFixed(nodep::BYTE *dst) const;
 
+	// an operand could not be encoded, the buffer holds no usable code
+	void MarkFailed();
+	bool Failed() const;
+
 
 	/* ->>> loop init
 	 * repinit <=> jmp repfini
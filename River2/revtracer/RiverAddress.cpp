@@ -20,7 +20,9 @@ nodep::BYTE RiverAddress::GetUnusedRegisters() const {
 
 	if ((0 == type) || (type & RIVER_ADDR_BASE)) {
 		tmp = GetFundamentalRegister(base.name);
-		ret &= ~(1 << tmp);
+		if (tmp < 8) { // xmm operands don't use any general purpose register
+			ret &= ~(1 << tmp);
+		}
 	}
 
 	if (type & RIVER_ADDR_INDEX) {
@@ -135,7 +137,7 @@ bool RiverAddress32::DecodeFromx86(RiverCodeGen &cg, unsigned char *&px86, nodep
 #define RIVER_REG_EXP32(rg)  ((rg) & 0x07)
 
 void RiverAddress32::FixEsp() {
-	if (RIVER_REG_NONE != base.versioned) {
+	if ((RIVER_REG_NONE != base.versioned) && !RIVER_REG_IS_XMM(base.name)) {
 		if (RIVER_REG_EXP32(base.name) == RIVER_REG_xSP) {
 			base.versioned = RIVER_REG_xAX;
 			type |= RIVER_ADDR_DIRTY;
@@ -246,7 +248,6 @@ bool RiverAddress32::EncodeTox86(unsigned char *&px86, nodep::BYTE extra, nodep:
 
 	if (type & RIVER_ADDR_DIRTY) {
 		if (!CleanAddr(modifiers)) {
-			DEBUG_BREAK;
 			return false;
 		}
 	}
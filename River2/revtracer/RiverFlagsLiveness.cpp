@@ -0,0 +1,65 @@
+#include "RiverFlagsLiveness.h"
+#include "CodeGen.h"
+
+#define FLAGS_ALL				(RIVER_SPEC_FLAG_OSZAPC | RIVER_SPEC_FLAG_DF)
+
+bool RiverFlagsLiveness::Init(RiverCodeGen *cg) {
+	codegen = cg;
+	return true;
+}
+
+/* Flags that are always overwritten by the instruction. modFlags also holds
+ * flags that are only written for some operand values, those are removed. */
+nodep::BYTE RiverFlagsLiveness::GetKilledFlags(const RiverInstruction &ri) {
+	if ((RIVER_FAMILY_NATIVE != RIVER_FAMILY(ri.family)) || (RIVER_FAMILY_FLAG_METAPROCESSED & ri.family)) {
+		return 0;
+	}
+
+	if (RIVER_MODIFIER_EXT & ri.modifiers) {
+		switch (ri.opCode) {
+			case 0xA4 : // shld
+			case 0xA5 :
+			case 0xAC : // shrd
+			case 0xAD :
+				// a count of 0 leaves the flags untouched
+				return 0;
+		}
+	}
+
+	return ri.modFlags & FLAGS_ALL;
+}
+
+nodep::BYTE RiverFlagsLiveness::GetReadFlags(const RiverInstruction &ri) {
+	switch (RIVER_FAMILY(ri.family)) {
+		case RIVER_FAMILY_NATIVE :
+		case RIVER_FAMILY_PREMETA :
+		case RIVER_FAMILY_POSTMETA :
+			return ri.testFlags & FLAGS_ALL;
+
+		case RIVER_FAMILY_RIVER :
+		case RIVER_FAMILY_PRETRACK :
+			// flag saves read everything, the other saves do not touch the flags
+			return (0x9C == ri.opCode) ? FLAGS_ALL : 0;
+
+		default :
+			// rep loops jump backwards, keep everything alive across them
+			return FLAGS_ALL;
+	}
+}
+
+void RiverFlagsLiveness::Analyze(RiverInstruction *code, nodep::DWORD count) {
+	nodep::BYTE live = FLAGS_ALL;
+
+	for (nodep::DWORD i = count; i > 0; --i) {
+		RiverInstruction &ri = code[i - 1];
+
+		ri.liveFlags = live;
+
+		if (RIVER_FAMILY_FLAG_IGNORE & ri.family) {
+			continue;
+		}
+
+		live &= ~GetKilledFlags(ri);
+		live |= GetReadFlags(ri);
+	}
+}
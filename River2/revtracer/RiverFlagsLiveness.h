@@ -0,0 +1,32 @@
+#ifndef _RIVER_FLAGS_LIVENESS_H
+#define _RIVER_FLAGS_LIVENESS_H
+
+#include "revtracer.h"
+#include "river.h"
+
+using namespace rev;
+
+class RiverCodeGen;
+
+/* Backward flags liveness over the instrumented forward code of a basic
+ * block. Every instruction gets the set of flags that may still be read
+ * after it executes (RiverInstruction::liveFlags). The successors of a block
+ * are not known at translation time, thus all the flags are considered live
+ * when the block is left.
+ * The instrumentation uses the result to skip preserving flags that are
+ * overwritten by the guest before being read. The reversible flag saves are
+ * not affected: a later block that does not modify the flags relies on them.
+ */
+class RiverFlagsLiveness {
+private :
+	RiverCodeGen *codegen;
+
+	static nodep::BYTE GetKilledFlags(const RiverInstruction &ri);
+	static nodep::BYTE GetReadFlags(const RiverInstruction &ri);
+public :
+	bool Init(RiverCodeGen *cg);
+
+	void Analyze(RiverInstruction *code, nodep::DWORD count);
+};
+
+#endif
@@ -571,8 +571,8 @@ RiverMetaTranslator::TranslateOpcodeFunc RiverMetaTranslator::translateOpcodes[2
 		/* 0x25 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x26 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x27 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x28 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x29 */ &RiverMetaTranslator::TranslateUnk,
+		/* 0x28 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x29 */ &RiverMetaTranslator::TranslateDefault,
 		/* 0x2A */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x2B */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x2C */ &RiverMetaTranslator::TranslateUnk,
@@ -627,29 +627,29 @@ RiverMetaTranslator::TranslateOpcodeFunc RiverMetaTranslator::translateOpcodes[2
 		/* 0x5D */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x5E */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x5F */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x60 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x61 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x62 */ &RiverMetaTranslator::TranslateUnk,
+		/* 0x60 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x61 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x62 */ &RiverMetaTranslator::TranslateDefault,
 		/* 0x63 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x64 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x65 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x66 */ &RiverMetaTranslator::TranslateUnk,
+		/* 0x64 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x65 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x66 */ &RiverMetaTranslator::TranslateDefault,
 		/* 0x67 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x68 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x69 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x6A */ &RiverMetaTranslator::TranslateUnk,
+		/* 0x68 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x69 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x6A */ &RiverMetaTranslator::TranslateDefault,
 		/* 0x6B */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x6C */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x6D */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x6E */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x6F */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x70 */ &RiverMetaTranslator::TranslateUnk,
+		/* 0x6C */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x6D */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x6E */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x6F */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x70 */ &RiverMetaTranslator::TranslateDefault,
 		/* 0x71 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x72 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x73 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x74 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x75 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x76 */ &RiverMetaTranslator::TranslateUnk,
+		/* 0x74 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x75 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x76 */ &RiverMetaTranslator::TranslateDefault,
 		/* 0x77 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x78 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x79 */ &RiverMetaTranslator::TranslateUnk,
@@ -657,8 +657,8 @@ RiverMetaTranslator::TranslateOpcodeFunc RiverMetaTranslator::translateOpcodes[2
 		/* 0x7B */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x7C */ &RiverMetaTranslator::TranslateUnk,
 		/* 0x7D */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x7E */ &RiverMetaTranslator::TranslateUnk,
-		/* 0x7F */ &RiverMetaTranslator::TranslateUnk,
+		/* 0x7E */ &RiverMetaTranslator::TranslateDefault,
+		/* 0x7F */ &RiverMetaTranslator::TranslateDefault,
 		/* 0x80 */ &RiverMetaTranslator::TranslateDefault, 
 		/* 0x01 */ &RiverMetaTranslator::TranslateDefault, 
 		/* 0x82 */ &RiverMetaTranslator::TranslateDefault, 
@@ -743,18 +743,18 @@ RiverMetaTranslator::TranslateOpcodeFunc RiverMetaTranslator::translateOpcodes[2
 		/* 0xD1 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xD2 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xD3 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xD4 */ &RiverMetaTranslator::TranslateUnk,
+		/* 0xD4 */ &RiverMetaTranslator::TranslateDefault,
 		/* 0xD5 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xD6 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xD7 */ &RiverMetaTranslator::TranslateUnk,
+		/* 0xD7 */ &RiverMetaTranslator::TranslateDefault,
 		/* 0xD8 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xD9 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xDA */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xDB */ &RiverMetaTranslator::TranslateUnk,
+		/* 0xDA */ &RiverMetaTranslator::TranslateDefault,
+		/* 0xDB */ &RiverMetaTranslator::TranslateDefault,
 		/* 0xDC */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xDD */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xDE */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xDF */ &RiverMetaTranslator::TranslateUnk,
+		/* 0xDE */ &RiverMetaTranslator::TranslateDefault,
+		/* 0xDF */ &RiverMetaTranslator::TranslateDefault,
 		/* 0xE0 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xE1 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xE2 */ &RiverMetaTranslator::TranslateUnk,
@@ -762,15 +762,15 @@ RiverMetaTranslator::TranslateOpcodeFunc RiverMetaTranslator::translateOpcodes[2
 		/* 0xE4 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xE5 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xE6 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xE7 */ &RiverMetaTranslator::TranslateUnk,
+		/* 0xE7 */ &RiverMetaTranslator::TranslateDefault,
 		/* 0xE8 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xE9 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xEA */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xEB */ &RiverMetaTranslator::TranslateUnk,
+		/* 0xEB */ &RiverMetaTranslator::TranslateDefault,
 		/* 0xEC */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xED */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xEE */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xEF */ &RiverMetaTranslator::TranslateUnk,
+		/* 0xEF */ &RiverMetaTranslator::TranslateDefault,
 		/* 0xF0 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xF1 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xF2 */ &RiverMetaTranslator::TranslateUnk,
@@ -779,13 +779,13 @@ RiverMetaTranslator::TranslateOpcodeFunc RiverMetaTranslator::translateOpcodes[2
 		/* 0xF5 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xF6 */ &RiverMetaTranslator::TranslateUnk,
 		/* 0xF7 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xF8 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xF9 */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xFA */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xFB */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xFC */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xFD */ &RiverMetaTranslator::TranslateUnk,
-		/* 0xFE */ &RiverMetaTranslator::TranslateUnk,
+		/* 0xF8 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0xF9 */ &RiverMetaTranslator::TranslateDefault,
+		/* 0xFA */ &RiverMetaTranslator::TranslateDefault,
+		/* 0xFB */ &RiverMetaTranslator::TranslateDefault,
+		/* 0xFC */ &RiverMetaTranslator::TranslateDefault,
+		/* 0xFD */ &RiverMetaTranslator::TranslateDefault,
+		/* 0xFE */ &RiverMetaTranslator::TranslateDefault,
 		/* 0xFF */ &RiverMetaTranslator::TranslateUnk
 	}
 };
@@ -0,0 +1,162 @@
+#include "RiverPeepholeOptimizer.h"
+#include "CodeGen.h"
+#include "mm.h"
+
+#define SAVE_INDEX_NONE			0xFFFFFFFF
+#define SAVE_INDEX_FLAGS		0x10
+
+bool RiverPeepholeOptimizer::Init(RiverCodeGen *cg) {
+	codegen = cg;
+	rev_memset(&stats, 0, sizeof(stats));
+	return true;
+}
+
+const RiverPeepholeStats &RiverPeepholeOptimizer::GetStats() const {
+	return stats;
+}
+
+bool RiverPeepholeOptimizer::IsSave(const RiverInstruction &ri) {
+	if ((RIVER_FAMILY_RIVER != RIVER_FAMILY(ri.family)) || (RIVER_FAMILY_FLAG_IGNORE & ri.family)) {
+		return false;
+	}
+
+	switch (ri.opCode) {
+		case 0x50 : // push reg
+		case 0x9C : // pushf
+			return true;
+		case 0xFF : // push mem
+			return 6 == ri.subOpCode;
+		default :
+			return false;
+	}
+}
+
+// same indexing as the register versions, xSP is never coalesced
+nodep::DWORD RiverPeepholeOptimizer::GetSaveIndex(nodep::BYTE regName) {
+	if (RIVER_REG_IS_XMM(regName)) {
+		return 8 | (regName & 0x07);
+	}
+
+	if ((regName >= 0x20) || (RIVER_REG_xSP == (regName & 0x07))) {
+		return SAVE_INDEX_NONE;
+	}
+
+	return regName & 0x07;
+}
+
+nodep::DWORD RiverPeepholeOptimizer::CoalesceSaves(RiverInstruction *code, nodep::DWORD count) {
+	nodep::DWORD saved = 0;
+	bool inRep = false;
+	nodep::DWORD ret = 0;
+
+	for (nodep::DWORD i = 0; i < count; ++i) {
+		const RiverInstruction &ri = code[i];
+		bool keep = true;
+
+		if (RIVER_FAMILY_REP == RIVER_FAMILY(ri.family)) {
+			// the loop body runs several times, leave it alone
+			if (0xF2 == ri.opCode) {
+				inRep = true;
+			} else if (0xF3 == ri.opCode) {
+				inRep = false;
+			}
+			saved = 0;
+		} else if (RIVER_FAMILY_RIVER == RIVER_FAMILY(ri.family)) {
+			nodep::DWORD idx = SAVE_INDEX_NONE;
+
+			if (!IsSave(ri)) {
+				saved = 0;
+			} else if (0x50 == ri.opCode) {
+				idx = GetSaveIndex(ri.operands[0].asRegister.name);
+			} else if (0x9C == ri.opCode) {
+				idx = SAVE_INDEX_FLAGS;
+			} else {
+				// the backward code needs the current base and index to restore this location
+				const RiverAddress *addr = ri.operands[0].asAddress;
+				nodep::DWORD base = SAVE_INDEX_NONE, index = SAVE_INDEX_NONE;
+
+				if ((0 == addr->type) || (addr->type & RIVER_ADDR_BASE)) {
+					base = GetSaveIndex(addr->base.name);
+				}
+
+				if (addr->type & RIVER_ADDR_INDEX) {
+					index = GetSaveIndex(addr->index.name);
+				}
+
+				if (SAVE_INDEX_NONE != base) {
+					saved &= ~(1 << base);
+				}
+
+				if (SAVE_INDEX_NONE != index) {
+					saved &= ~(1 << index);
+				}
+			}
+
+			if ((SAVE_INDEX_NONE != idx) && !inRep && (0 == (RIVER_FAMILY_FLAG_ORIG_xSP & ri.family))) {
+				if (saved & (1 << idx)) {
+					keep = false;
+
+					if (SAVE_INDEX_FLAGS == idx) {
+						stats.coalescedFlagSaves++;
+					} else {
+						stats.coalescedRegSaves++;
+					}
+				} else {
+					saved |= 1 << idx;
+				}
+			}
+		}
+
+		if (keep) {
+			if (ret != i) {
+				rev_memcpy(&code[ret], &code[i], sizeof(code[ret]));
+			}
+			ret++;
+		}
+	}
+
+	return ret;
+}
+
+/* Pretrack instructions only read the guest state, thus a river save can be
+ * moved in front of them. The relative order of the saves is kept. */
+nodep::DWORD RiverPeepholeOptimizer::HoistSaves(RiverInstruction *code, nodep::DWORD count) {
+	for (nodep::DWORD i = 1; i < count; ++i) {
+		if (!IsSave(code[i])) {
+			continue;
+		}
+
+		nodep::DWORD k = i;
+		while ((k > 0) && (RIVER_FAMILY_PRETRACK == RIVER_FAMILY(code[k - 1].family))) {
+			k--;
+		}
+
+		if (k != i) {
+			RiverInstruction tmp;
+			rev_memcpy(&tmp, &code[i], sizeof(tmp));
+			for (nodep::DWORD j = i; j > k; --j) {
+				rev_memcpy(&code[j], &code[j - 1], sizeof(code[j]));
+			}
+			rev_memcpy(&code[k], &tmp, sizeof(code[k]));
+			stats.hoistedSaves++;
+		}
+	}
+
+	return count;
+}
+
+bool RiverPeepholeOptimizer::Optimize(RiverInstruction *code, nodep::DWORD &count, nodep::DWORD dwTranslationFlags) {
+	stats.blockCount++;
+	stats.instrIn += count;
+
+	if (TRACER_FEATURE_REVERSIBLE & dwTranslationFlags) {
+		count = CoalesceSaves(code, count);
+
+		if (TRACER_FEATURE_TRACKING & dwTranslationFlags) {
+			count = HoistSaves(code, count);
+		}
+	}
+
+	stats.instrOut += count;
+	return true;
+}
@@ -0,0 +1,51 @@
+#ifndef _RIVER_PEEPHOLE_OPTIMIZER_H
+#define _RIVER_PEEPHOLE_OPTIMIZER_H
+
+#include "revtracer.h"
+#include "river.h"
+
+using namespace rev;
+
+class RiverCodeGen;
+
+/* Statistics for the peephole passes, accumulated over all the translated
+ * basic blocks. */
+struct RiverPeepholeStats {
+	nodep::DWORD blockCount;
+	nodep::DWORD instrIn;
+	nodep::DWORD instrOut;
+
+	nodep::DWORD coalescedRegSaves;
+	nodep::DWORD coalescedFlagSaves;
+	nodep::DWORD hoistedSaves;
+};
+
+/* Peephole passes over the instrumented forward code (fwRiverInst). They run
+ * before the backward code is generated, thus the backward code is derived
+ * from the optimized forward code.
+ *  - save coalescing: the backward code restores the saved values in reverse
+ *    order, thus only the first save of a register (or of the flags) in a
+ *    block is observable. Later saves are dropped, unless a memory save in
+ *    between needs the intermediate value to compute its address.
+ *  - save hoisting: river saves are moved in front of the adjacent pretrack
+ *    instructions, so that the saves of consecutive instructions share a
+ *    single switch to the execution buffer stack.
+ */
+class RiverPeepholeOptimizer {
+private :
+	RiverCodeGen *codegen;
+	RiverPeepholeStats stats;
+
+	nodep::DWORD CoalesceSaves(RiverInstruction *code, nodep::DWORD count);
+	nodep::DWORD HoistSaves(RiverInstruction *code, nodep::DWORD count);
+
+	static bool IsSave(const RiverInstruction &ri);
+	static nodep::DWORD GetSaveIndex(nodep::BYTE regName);
+public :
+	bool Init(RiverCodeGen *cg);
+
+	bool Optimize(RiverInstruction *code, nodep::DWORD &count, nodep::DWORD dwTranslationFlags);
+	const RiverPeepholeStats &GetStats() const;
+};
+
+#endif
@@ -5,13 +5,13 @@
 
 //#include <stdio.h>
 
-extern const char PrintMnemonicTable00[][10];
-extern const char PrintMnemonicTable0F[][10];
+extern const char PrintMnemonicTable00[][12];
+extern const char PrintMnemonicTable0F[][12];
 extern const char PrintMnemonicExt[][8][10];
 
 
-extern const char RegNames[][4];
-extern const char MemSizes[][6];
+extern const char RegNames[][5];
+extern const char MemSizes[][8];
 
 void PrintPrefixes(nodep::DWORD printMask, struct RiverInstruction *ri) {
 	if (ri->family & RIVER_FAMILY_FLAG_IGNORE) {
@@ -47,7 +47,7 @@ void PrintPrefixes(nodep::DWORD printMask, struct RiverInstruction *ri) {
 }
 
 void PrintMnemonic(nodep::DWORD printMask, struct RiverInstruction *ri) {
-	const char (*mTable)[10] = PrintMnemonicTable00;
+	const char (*mTable)[12] = PrintMnemonicTable00;
 
 	if (RIVER_MODIFIER_EXT & ri->modifiers) {
 		mTable = PrintMnemonicTable0F;
@@ -61,6 +61,9 @@ void PrintMnemonic(nodep::DWORD printMask, struct RiverInstruction *ri) {
 			case 0xF3:
 				revtracerImports.dbgPrintFunc(printMask, "repfini");
 				break;
+			case RIVER_REP_BULK_OPCODE:
+				revtracerImports.dbgPrintFunc(printMask, (RIVER_REP_BULK_UNDO == ri->subOpCode) ? "repundo" : "repbulk");
+				break;
 			case 0xCC:
 				break;
 			default:
@@ -186,11 +189,11 @@ void RiverPrintInstruction(nodep::DWORD printMask, struct RiverInstruction *ri)
 	//printf("%s", )
 }
 
-const char MemSizes[][6] = {
-	"dword", "word", "byte"
+const char MemSizes[][8] = {
+	"dword", "word", "byte", "xmmword"
 };
 
-const char RegNames[][4] = {
+const char RegNames[][5] = {
 	"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
 	 "ax",  "cx",  "dx",  "bx",  "sp",  "bp",  "si",  "di",
 	 "al",  "cl",  "dl",  "bl",  "--",  "--",  "--",  "--",
@@ -198,10 +201,15 @@ const char RegNames[][4] = {
 
 	 "es",  "cs",  "ss",  "ds",  "fs",  "gs",  "--",  "--",
 	"cr0",  "--", "cr2", "cr3", "cr4",  "--",  "--",  "--",
-	"dr0", "dr1", "dr2", "dr3", "dr4", "dr5", "dr6", "dr7"
+	"dr0", "dr1", "dr2", "dr3", "dr4", "dr5", "dr6", "dr7",
+	 "--",  "--",  "--",  "--",  "--",  "--",  "--",  "--",
+
+	 "--",  "--",  "--",  "--",  "--",  "--",  "--",  "--",
+	 "--",  "--",  "--",  "--",  "--",  "--",  "--",  "--",
+	"xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7"
 };
 
-const char PrintMnemonicTable00[][10] = {
+const char PrintMnemonicTable00[][12] = {
 	/*0x00*/"add", "add", "add", "add", "add", "add", "", "", "or",  "or",  "or",  "or",  "or",  "or", "", "",
 	/*0x10*/"adc", "adc", "adc", "adc", "adc", "adc", "", "", "sbb", "sbb", "sbb", "sbb", "sbb", "sbb", "", "",
 	/*0x20*/"and", "and", "and", "and", "and", "and", "", "", "sub", "sub", "sub", "sub", "sub", "sub", "", "",
@@ -220,23 +228,23 @@ const char PrintMnemonicTable00[][10] = {
 	/*0xF0*/"", "", "", "", "", "", "\4", "\4", "", "", "", "", "cld", "std", "\6", "\3"
 };
 
-const char PrintMnemonicTable0F[][10] = {
+const char PrintMnemonicTable0F[][12] = {
 	/*0x00*/"", "", "lar", "lsl", "", "syscall", "", "", "", "", "", "", "", "", "", "",
 	/*0x10*/"", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
-	/*0x20*/"", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
+	/*0x20*/"", "", "", "", "", "", "", "", "movaps", "movaps", "", "", "", "", "", "",
 	/*0x30*/"", "rdtsc", "", "", "sysenter", "", "", "", "", "", "", "", "", "", "", "",
 	/*0x40*/"cmovo", "cmovno", "cmovc", "cmovnc", "cmovz", "cmovnz", "cmovbe", "cmovnbe", "cmovs", "cmovns", "cmovp", "cmovnp", "cmovl", "cmovnl", "cmovle", "cmovnle",
 	/*0x50*/"", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
-	/*0x60*/"", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
-	/*0x70*/"", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
+	/*0x60*/"punpcklbw", "punpcklwd", "punpckldq", "", "pcmpgtb", "pcmpgtw", "pcmpgtd", "", "punpckhbw", "punpckhwd", "punpckhdq", "", "punpcklqdq", "punpckhqdq", "movd", "movdqa",
+	/*0x70*/"pshufd", "", "", "", "pcmpeqb", "pcmpeqw", "pcmpeqd", "", "", "", "", "", "", "", "movd", "movdqa",
 	/*0x80*/"jo", "jno", "jc", "jnc", "jz", "jnz", "jbe", "jnbe", "js", "jns", "jp", "jnp", "jl", "jnl", "jle", "jnle",
 	/*0x90*/"seto", "setno", "setc", "setnc", "setz", "setnz", "setbe", "setnbe", "sets", "setns", "setp", "setnp", "setl", "setnl", "setle", "setnle",
 	/*0xA0*/"", "", "cpuid", "", "shld", "shld", "", "", "", "", "", "", "shrd", "shrd", "", "imul",
 	/*0xB0*/"cmpxchg", "cmpxchg", "", "", "", "", "movzx", "movzx", "", "", "\5", "", "bsf", "bsr", "movsx", "movsx",
 	/*0xC0*/"xadd", "xadd", "", "", "", "", "", "\7", "bswap", "bswap", "bswap", "bswap", "bswap", "bswap", "bswap", "bswap",
-	/*0xD0*/"", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
-	/*0xE0*/"", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
-	/*0xF0*/"", "", "", "", "", "", "", "", "", "", "", "", "", "", "", ""
+	/*0xD0*/"", "", "", "", "paddq", "", "", "pmovmskb", "", "", "pminub", "pand", "", "", "pmaxub", "pandn",
+	/*0xE0*/"", "", "", "", "", "", "", "movntdq", "", "", "", "por", "", "", "", "pxor",
+	/*0xF0*/"", "", "", "", "", "", "", "", "psubb", "psubw", "psubd", "psubq", "paddb", "paddw", "paddd", ""
 };
 
 const char PrintMnemonicExt[][8][10] = {
@@ -1,5 +1,7 @@
 #include "RiverRepAssembler.h"
 
+extern nodep::DWORD dwBulkRepHandler;
+
 const unsigned jmpSize = 5;
 const unsigned loopSize = 2;
 
@@ -87,6 +89,28 @@ void AssembleRepfiniInstruction(RelocableCodeBuffer &px86, nodep::DWORD &instrCo
 	AssembleFarloopInstruction(px86, instrCounter);
 }
 
+void RiverRepAssembler::AssembleBulkInstruction(const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::DWORD &instrCounter) {
+	static const nodep::BYTE bulkCode[] = {
+		0x9C,								// 0x00 - pushf
+		0x60,								// 0x01 - pusha
+		0x89, 0xE0,							// 0x02 - mov eax, esp
+		0x68, 0x00, 0x00, 0x00, 0x00,		// 0x04 - push descriptor
+		0x50,								// 0x09 - push eax ; registers
+		0xFF, 0x35, 0x00, 0x00, 0x00, 0x00,	// 0x0A - push [address_hash] ; execution environment
+		0xFF, 0x15, 0x00, 0x00, 0x00, 0x00,	// 0x10 - call [dwBulkRepHandler]
+		0x61,								// 0x16 - popa
+		0x9D								// 0x17 - popf
+	};
+
+	rev_memcpy(px86.cursor, bulkCode, sizeof(bulkCode));
+	*(nodep::DWORD *)(&px86.cursor[0x05]) = ri.specifiers | ((nodep::DWORD)ri.subOpCode << 16);
+	*(nodep::DWORD *)(&px86.cursor[0x0C]) = (nodep::DWORD)&runtime->taintedAddresses;
+	*(nodep::DWORD *)(&px86.cursor[0x12]) = (nodep::DWORD)&dwBulkRepHandler;
+
+	px86.cursor += sizeof(bulkCode);
+	instrCounter += 9;
+}
+
 /* rep prefixed instructions are translated as described in RiverRepTranslator
  * instructions repinit and repfini are used to compute the actual code size.
  * The jump offsets are fixed afterwards
@@ -102,10 +126,15 @@ bool RiverRepAssembler::Translate(const RiverInstruction &ri, RelocableCodeBuffe
 			AssembleRepfiniInstruction(px86, instrCounter);
 			px86.MarkRepFini();
 			break;
+		case RIVER_REP_BULK_OPCODE:
+			AssembleBulkInstruction(ri, px86, instrCounter);
+			break;
 		case 0xcc:
 			AssembleDebugBreak(px86, instrCounter);
 			break;
 		default:
 			DEBUG_BREAK;
 	}
+
+	return true;
 }
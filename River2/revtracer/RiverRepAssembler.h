@@ -6,6 +6,8 @@
 class RiverRepAssembler : public GenericX86Assembler {
 	public:
 		virtual bool Translate(const RiverInstruction &ri, RelocableCodeBuffer &px86,  nodep::DWORD &pFlags, nodep::BYTE &currentFamily, nodep::BYTE &repReg, nodep::DWORD &instrCounter, nodep::BYTE outputType);
+	private:
+		void AssembleBulkInstruction(const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::DWORD &instrCounter);
 };
 
 #endif
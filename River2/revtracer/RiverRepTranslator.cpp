@@ -2,8 +2,9 @@
 #include "CodeGen.h"
 #include "TranslatorUtil.h"
 
-bool RiverRepTranslator::Init(RiverCodeGen *cg) {
+bool RiverRepTranslator::Init(RiverCodeGen *cg, nodep::DWORD dwTranslationFlags) {
 	codegen = cg;
+	this->dwTranslationFlags = dwTranslationFlags;
 	return true;
 }
 
@@ -88,10 +89,75 @@ void RiverRepTranslator::TranslateCommon(const RiverInstruction &rIn, RiverInstr
 	instrCount += localInstrCount;
 }
 
+/* bulk rep translation (TRACER_FEATURE_BULK_REP)
+ *  repbulk
+ *  repinit
+ * code:
+ *	//actual code//
+ *	repfini
+ *
+ *	repbulk calls the bulk rep handler, which performs as many iterations
+ *	as it can in a single step (saving the destination range and
+ *	propagating the tracking information for the whole range). The regular
+ *	rep loop that follows only runs the remaining iterations, if any.
+ *	Symbolic tracking needs the per element operands, so it always uses
+ *	the regular loop. Reversible tracking does too, since the range's old
+ *	taint is only saved by the per element tracking code.
+ */
+bool RiverRepTranslator::CanTranslateBulk(const RiverInstruction &rIn) const {
+	if (0 == (dwTranslationFlags & TRACER_FEATURE_BULK_REP)) {
+		return false;
+	}
+
+	if (dwTranslationFlags & TRACER_FEATURE_ADVANCED_TRACKING) {
+		return false;
+	}
+
+	if ((dwTranslationFlags & TRACER_FEATURE_REVERSIBLE) && (dwTranslationFlags & TRACER_FEATURE_TRACKING)) {
+		return false;
+	}
+
+	// segment overrides and 16 bit addressing are left to the regular loop
+	if ((rIn.modifiers & 0x07) || (rIn.modifiers & RIVER_MODIFIER_A16)) {
+		return false;
+	}
+
+	switch (rIn.opCode) {
+		case 0xA4: case 0xA5: //MOVS 8/16/32
+		case 0xAA: case 0xAB: //STOS 8/16/32
+			return true;
+		default:
+			return false;
+	}
+}
+
+void RiverRepTranslator::TranslateBulk(const RiverInstruction &rIn, RiverInstruction *rOut, nodep::DWORD &instrCount) {
+	rOut->opCode = RIVER_REP_BULK_OPCODE;
+	rOut->subOpCode = RIVER_REP_BULK_FORWARD;
+	rOut->family = RIVER_FAMILY_REP;
+	rOut->modifiers = 0;
+	rOut->specifiers = rIn.opCode;
+	if (rIn.modifiers & RIVER_MODIFIER_O16) {
+		rOut->specifiers |= RIVER_REP_BULK_O16;
+	}
+
+	rOut->modFlags = rOut->testFlags = 0;
+	rOut->unusedRegisters = 0;
+
+	for (int i = 0; i < 4; ++i) {
+		rOut->opTypes[i] = RIVER_OPTYPE_NONE;
+	}
+
+	rOut->instructionAddress = rIn.instructionAddress;
+	instrCount++;
+}
+
 bool RiverRepTranslator::Translate(const RiverInstruction &rIn, RiverInstruction *rOut, nodep::DWORD &instrCount) {
+	// on the 0F page F2/F3 select an SSE instruction, nothing gets repeated
 	if (!(rIn.modifiers & RIVER_MODIFIER_REP ||
 				rIn.modifiers & RIVER_MODIFIER_REPZ ||
-				rIn.modifiers & RIVER_MODIFIER_REPNZ)) {
+				rIn.modifiers & RIVER_MODIFIER_REPNZ) ||
+			(rIn.modifiers & RIVER_MODIFIER_EXT)) {
 		TranslateDefault(rIn, rOut, instrCount);
 		return true;
 	}
@@ -106,6 +172,10 @@ bool RiverRepTranslator::Translate(const RiverInstruction &rIn, RiverInstruction
 			CopyInstruction(codegen, rInFixed, rIn);
 			rInFixed.modifiers &= ~(RIVER_MODIFIER_REPZ);
 			rInFixed.modifiers |= RIVER_MODIFIER_REP;
+			if (CanTranslateBulk(rInFixed)) {
+				TranslateBulk(rInFixed, rOut, instrCount);
+				rOut++;
+			}
 			// we need this workaround to fix the modifier
 			TranslateCommon(rInFixed, rOut, instrCount, RIVER_MODIFIER_REP);
 			return true;
@@ -7,10 +7,13 @@ class RiverCodeGen;
 
 class RiverRepTranslator {
 	public:
-		bool Init(RiverCodeGen *cg);
+		bool Init(RiverCodeGen *cg, nodep::DWORD dwTranslationFlags);
 		bool Translate(const RiverInstruction &rIn, RiverInstruction *rOut, nodep::DWORD &instrCount);
 	private:
 		RiverCodeGen *codegen;
+		nodep::DWORD dwTranslationFlags;
+		bool CanTranslateBulk(const RiverInstruction &rIn) const;
+		void TranslateBulk(const RiverInstruction &rIn, RiverInstruction *rOut, nodep::DWORD &instrCount);
 		void TranslateDefault(const RiverInstruction &rIn, RiverInstruction *rOut, nodep::DWORD &instrCount);
 		void TranslateCommon(const RiverInstruction &rIn, RiverInstruction *rOut, nodep::DWORD &instrCount, nodep::DWORD riverModifier);
 };
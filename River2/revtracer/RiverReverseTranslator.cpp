@@ -7,6 +7,13 @@ bool RiverReverseTranslator::Init(RiverCodeGen *cg) {
 }
 
 bool RiverReverseTranslator::Translate(const RiverInstruction &rIn, RiverInstruction &rOut) {
+	/* the bulk rep handler saves the destination range by itself */
+	if ((RIVER_FAMILY_REP == RIVER_FAMILY(rIn.family)) && (RIVER_REP_BULK_OPCODE == rIn.opCode)) {
+		CopyInstruction(codegen, rOut, rIn);
+		rOut.subOpCode = RIVER_REP_BULK_UNDO;
+		return true;
+	}
+
 	if (RIVER_FAMILY_RIVER != RIVER_FAMILY(rIn.family)) {
 		CopyInstruction(codegen, rOut, rIn);
 		rOut.family |= RIVER_FAMILY_FLAG_IGNORE;
@@ -14,13 +21,14 @@ bool RiverReverseTranslator::Translate(const RiverInstruction &rIn, RiverInstruc
 	}
 
 	nodep::DWORD dwTable = (RIVER_MODIFIER_EXT & rIn.modifiers) ? 1 : 0;
+	valid = true;
 	(this->*translateOpcodes[dwTable][rIn.opCode])(rOut, rIn);
 
-	return true;
+	return valid;
 }
 
 void RiverReverseTranslator::TranslateUnk(RiverInstruction &rOut, const RiverInstruction &rIn) {
-	DEBUG_BREAK;
+	valid = false;
 }
 
 void RiverReverseTranslator::TranslatePushReg(RiverInstruction &rOut, const RiverInstruction &rIn) {
@@ -82,7 +90,7 @@ void RiverReverseTranslator::Translate0x83(RiverInstruction &rOut, const RiverIn
 			rOut.operands[0].asRegister.versioned -= 0x100; // previous register version
 			break;
 		default:
-			DEBUG_BREAK;
+			valid = false;
 	}
 }
 
@@ -11,6 +11,7 @@ class RiverCodeGen;
 class RiverReverseTranslator {
 private :
 	RiverCodeGen *codegen;
+	bool valid; // cleared by the opcodes that have no reverse
 	typedef void(RiverReverseTranslator::*TranslateOpcodeFunc)(RiverInstruction &rOut, const RiverInstruction &rIn);
 
 	static TranslateOpcodeFunc translateOpcodes[2][0x100];
@@ -10,6 +10,7 @@ bool RiverSaveTranslator::Init(RiverCodeGen *cg) {
 bool RiverSaveTranslator::Translate(const RiverInstruction &rIn, RiverInstruction *rOut, nodep::DWORD &instrCount) {
 	nodep::DWORD dwTable = (RIVER_MODIFIER_EXT & rIn.modifiers) ? 1 : 0;
 
+	valid = true;
 	if (RIVER_FAMILY(rIn.family) == RIVER_FAMILY_NATIVE) {
 		(this->*translateOpcodes[dwTable][rIn.opCode])(rOut, rIn, instrCount);
 	} else {
@@ -17,7 +18,7 @@ bool RiverSaveTranslator::Translate(const RiverInstruction &rIn, RiverInstructio
 		instrCount++;
 	}
 
-	return true;
+	return valid;
 }
 
 /* =========================================== */
@@ -42,7 +43,7 @@ void RiverSaveTranslator::MakeSaveReg(RiverInstruction *rOut, const RiverRegiste
 	rOut->family = RIVER_FAMILY_RIVER | familyFlag;
 	rOut->specifiers = 0;
 
-	rOut->opTypes[0] = RIVER_OPTYPE_REG | RIVER_OPSIZE_32;
+	rOut->opTypes[0] = RIVER_OPTYPE_REG | (RIVER_REG_IS_XMM(reg.name) ? RIVER_OPSIZE_128 : RIVER_OPSIZE_32);
 	rOut->operands[0].asRegister.versioned = codegen->GetPrevReg(reg.name);
 
 	if (RIVER_REG_xSP == GetFundamentalRegister(reg.name)) {
@@ -148,7 +149,7 @@ void RiverSaveTranslator::SaveOperands(RiverInstruction *rOut, const RiverInstru
 /* Opcode translators */
 
 void RiverSaveTranslator::TranslateUnk(RiverInstruction *rOut, const RiverInstruction &rIn, nodep::DWORD &instrCount) {
-	DEBUG_BREAK;
+	valid = false;
 }
 
 void RiverSaveTranslator::TranslateDefault(RiverInstruction *rOut, const RiverInstruction &rIn, nodep::DWORD &instrCount) {
@@ -217,6 +218,26 @@ void RiverSaveTranslator::TranslateSaveCMPXCHG8B(RiverInstruction *rOut, const R
 	rOut++;
 }
 
+void RiverSaveTranslator::TranslateSaveXmm(RiverInstruction *rOut, const RiverInstruction &rIn, nodep::DWORD &instrCount) {
+	const RiverAddress *mem = rIn.operands[0].asAddress;
+
+	// xmm registers are saved whole by MakeSaveReg, only a 128 bit memory destination needs splitting
+	if ((RIVER_OPTYPE_MEM != RIVER_OPTYPE(rIn.opTypes[0])) || (RIVER_OPSIZE_128 != RIVER_OPSIZE(rIn.opTypes[0])) || (0 == mem->type)) {
+		SaveOperands(rOut, rIn, instrCount);
+		return;
+	}
+
+	for (int offset = 0; offset < 0x10; offset += 4) {
+		MakeSaveMemOffset(rOut, *mem, offset, 0, rIn);
+		instrCount++;
+		rOut++;
+	}
+
+	CopyInstruction(codegen, *rOut, rIn);
+	instrCount++;
+	rOut++;
+}
+
 /* =========================================== */
 /* Translation table                           */
 /* =========================================== */
@@ -315,7 +336,7 @@ RiverSaveTranslator::TranslateOpcodeFunc RiverSaveTranslator::translateOpcodes[2
 
 		/*0x20*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
 		/*0x24*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0x28*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
+		/*0x28*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
 		/*0x2C*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
 
 		/*0x30*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateDefault, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
@@ -333,15 +354,15 @@ RiverSaveTranslator::TranslateOpcodeFunc RiverSaveTranslator::translateOpcodes[2
 		/*0x58*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
 		/*0x5C*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
 
-		/*0x60*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0x64*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0x68*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0x6C*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
+		/*0x60*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateUnk,
+		/*0x64*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateUnk,
+		/*0x68*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateUnk,
+		/*0x6C*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm,
 
-		/*0x70*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0x74*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
+		/*0x70*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
+		/*0x74*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateUnk,
 		/*0x78*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0x7C*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
+		/*0x7C*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm,
 
 		/*0x80*/&RiverSaveTranslator::TranslateDefault, &RiverSaveTranslator::TranslateDefault, &RiverSaveTranslator::TranslateDefault, &RiverSaveTranslator::TranslateDefault,
 		/*0x84*/&RiverSaveTranslator::TranslateDefault, &RiverSaveTranslator::TranslateDefault, &RiverSaveTranslator::TranslateDefault, &RiverSaveTranslator::TranslateDefault,
@@ -369,19 +390,19 @@ RiverSaveTranslator::TranslateOpcodeFunc RiverSaveTranslator::translateOpcodes[2
 		/*0xCC*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
 
 		/*0xD0*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0xD4*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0xD8*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0xDC*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
+		/*0xD4*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateSaveXmm,
+		/*0xD8*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm,
+		/*0xDC*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm,
 
 		/*0xE0*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0xE4*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0xE8*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0xEC*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
+		/*0xE4*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateSaveXmm,
+		/*0xE8*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateSaveXmm,
+		/*0xEC*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateSaveXmm,
 
 		/*0xF0*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
 		/*0xF4*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0xF8*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk,
-		/*0xFC*/&RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk, &RiverSaveTranslator::TranslateUnk
+		/*0xF8*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm,
+		/*0xFC*/&RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateSaveXmm, &RiverSaveTranslator::TranslateUnk
 	}
 };
 
@@ -9,6 +9,7 @@ class RiverCodeGen;
 class RiverSaveTranslator {
 private :
 	RiverCodeGen *codegen;
+	bool valid; // cleared by the unknown opcodes
 
 	typedef void(RiverSaveTranslator::*TranslateOpcodeFunc)(RiverInstruction *rOut, const RiverInstruction &rIn, nodep::DWORD &instrCount);
 	
@@ -37,6 +38,7 @@ private :
 	void TranslateDefault(RiverInstruction *rOut, const RiverInstruction &rIn, nodep::DWORD &instrCount);
 	void TranslateSaveCPUID(RiverInstruction *rOut, const RiverInstruction &rIn, nodep::DWORD &instrCount);
 	void TranslateSaveCMPXCHG8B(RiverInstruction *rOut, const RiverInstruction &rIn, nodep::DWORD &instrCount);
+	void TranslateSaveXmm(RiverInstruction *rOut, const RiverInstruction &rIn, nodep::DWORD &instrCount);
 
 	template <TranslateOpcodeFunc subOp> void TranslateRep(RiverInstruction *rOut, const RiverInstruction &rIn, nodep::DWORD &instrCount) {
 		if ((rIn.modifiers & RIVER_MODIFIER_REP) || (rIn.modifiers & RIVER_MODIFIER_REPZ) || (rIn.modifiers & RIVER_MODIFIER_REPNZ)) {
@@ -0,0 +1,173 @@
+#include "RiverSpeculativeTranslator.h"
+#include "sync.h"
+
+void *RiverSpeculativeTranslator::operator new(size_t sz) {
+	void *storage = revtracerImports.memoryAllocFunc(sz);
+	if (NULL == storage) {
+		DEBUG_BREAK;
+		return NULL;
+	}
+	return storage;
+}
+
+void RiverSpeculativeTranslator::operator delete(void *ptr) {
+	revtracerImports.memoryFreeFunc((nodep::BYTE *)ptr);
+}
+
+bool RiverSpeculativeTranslator::Init(RiverBasicBlockCache *cache, RiverRuntime *rt, nodep::DWORD heapSize, nodep::DWORD outBufferSize, nodep::DWORD flags) {
+	blockCache = cache;
+	dwTranslationFlags = flags;
+	head = tail = 0;
+	running = 0;
+	stopped = 1;
+
+	if (0 == heap.Init(heapSize)) {
+		return false;
+	}
+
+	if (!codeGen.Init(&heap, rt, outBufferSize, flags)) {
+		heap.Destroy();
+		return false;
+	}
+
+	// the successors never ran, they may point to unmapped memory
+	codeGen.EnableReadableCheck();
+
+	return true;
+}
+
+bool RiverSpeculativeTranslator::Start() {
+	if ((NULL == revtracerImports.createThread) || (NULL == revtracerImports.isReadable)) {
+		return false;
+	}
+
+	running = 1;
+	stopped = 0;
+	if (!revtracerImports.createThread(ThreadProc, this)) {
+		running = 0;
+		stopped = 1;
+		return false;
+	}
+
+	return true;
+}
+
+void RiverSpeculativeTranslator::Stop() {
+	RiverAtomicExchange(&running, 0);
+
+	while (0 == stopped) {
+		if (NULL != revtracerImports.yieldExecution) {
+			revtracerImports.yieldExecution();
+		}
+	}
+}
+
+void RiverSpeculativeTranslator::Destroy() {
+	codeGen.Destroy();
+	heap.Destroy();
+}
+
+void RiverSpeculativeTranslator::Enqueue(const RiverBasicBlock *pCB) {
+	for (int i = 0; i < 2; ++i) {
+		nodep::UINT_PTR addr = pCB->pBranchNext[i].address;
+		long t = tail;
+
+		if ((0 == addr) || (t - head >= RIVER_SPECULATIVE_QUEUE_SIZE)) {
+			continue;
+		}
+
+		queue[t & (RIVER_SPECULATIVE_QUEUE_SIZE - 1)] = addr;
+		RiverAtomicExchange(&tail, t + 1);
+	}
+}
+
+void RiverSpeculativeTranslator::ThreadProc(void *param) {
+	((RiverSpeculativeTranslator *)param)->Run();
+}
+
+void RiverSpeculativeTranslator::Run() {
+	while (0 != running) {
+		long h = head;
+
+		if (h == tail) {
+			if (NULL != revtracerImports.yieldExecution) {
+				revtracerImports.yieldExecution();
+			}
+			continue;
+		}
+
+		nodep::UINT_PTR addr = queue[h & (RIVER_SPECULATIVE_QUEUE_SIZE - 1)];
+		RiverAtomicExchange(&head, h + 1);
+
+		TranslateSuccessors(addr, RIVER_SPECULATIVE_DEPTH);
+	}
+
+	RiverAtomicExchange(&stopped, 1);
+}
+
+void RiverSpeculativeTranslator::TranslateSuccessors(nodep::UINT_PTR addr, nodep::DWORD depth) {
+	if ((0 == running) || (NULL != blockCache->FindBlock(addr))) {
+		return;
+	}
+
+	RiverBasicBlock *pCB = (RiverBasicBlock *)heap.Alloc(sizeof(*pCB));
+	if (NULL == pCB) {
+		return;
+	}
+
+	rev_memset(pCB, 0, sizeof(*pCB));
+	pCB->address = addr;
+	pCB->dwFlags = RIVER_BASIC_BLOCK_SPECULATIVE;
+
+	// translation errors are left to the guest thread, it reports them if
+	// the code is ever executed
+	RevtracerError rerror;
+	if (!codeGen.Translate(pCB, dwTranslationFlags, &rerror)) {
+		FreeBlock(pCB);
+		return;
+	}
+
+	if ((TRACER_FEATURE_REVERSIBLE & dwTranslationFlags) && !codeGen.TranslateBackward(pCB)) {
+		FreeBlock(pCB);
+		return;
+	}
+
+	// the guest thread may have translated it in the meantime
+	if (NULL != blockCache->FindBlock(addr)) {
+		FreeBlock(pCB);
+		return;
+	}
+
+	blockCache->InsertBlock(pCB);
+
+	if (0 == depth) {
+		return;
+	}
+
+	for (int i = 0; i < 2; ++i) {
+		if (0 != pCB->pBranchNext[i].address) {
+			TranslateSuccessors(pCB->pBranchNext[i].address, depth - 1);
+		}
+	}
+}
+
+/* Releases a block that was not published, the heap of the worker is never
+ * trimmed otherwise. */
+void RiverSpeculativeTranslator::FreeBlock(RiverBasicBlock *pCB) {
+	unsigned char *code[] = {
+		pCB->pFwCode,
+		pCB->pBkCode,
+		pCB->pTrackCode,
+		pCB->pRevTrackCode,
+		pCB->pDisasmCode,
+		pCB->pBkIR
+	};
+
+	for (int i = 0; i < (int)(sizeof(code) / sizeof(code[0])); ++i) {
+		if (NULL != code[i]) {
+			heap.Free(code[i]);
+		}
+	}
+
+	heap.Free(pCB);
+}
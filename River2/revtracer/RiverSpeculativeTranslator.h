@@ -0,0 +1,55 @@
+#ifndef _RIVER_SPECULATIVE_TRANSLATOR_H
+#define _RIVER_SPECULATIVE_TRANSLATOR_H
+
+#include "revtracer.h"
+#include "mm.h"
+#include "cb.h"
+#include "CodeGen.h"
+
+using namespace rev;
+
+#define RIVER_SPECULATIVE_QUEUE_SIZE			0x100 // power of 2
+#define RIVER_SPECULATIVE_DEPTH					2 // successors of successors are translated as well
+
+/* Background translation of the immediate successors of the newly translated
+ * blocks (TRACER_FEATURE_SPECULATIVE). The guest thread queues the addresses,
+ * the worker translates them with its own heap and code generator and
+ * publishes the finished blocks in the block cache with a lock-free insert.
+ * Blocks found in the cache are skipped. When both threads translate the same
+ * address, the first block in the hash chain is used.
+ * The successors may be data or unmapped memory. The guest code is probed with
+ * revtracerImports.isReadable and the translation stops with an error
+ * instead of a trap on the instructions that can not be handled.
+ * The worker assembles the backward code right away, lazy translation would
+ * run its code generator on the guest thread. Its blocks are marked with
+ * RIVER_BASIC_BLOCK_SPECULATIVE and belong to its heap. */
+class RiverSpeculativeTranslator {
+private :
+	RiverHeap heap;
+	RiverCodeGen codeGen;
+	RiverBasicBlockCache *blockCache;
+	nodep::DWORD dwTranslationFlags;
+
+	// single producer (guest thread), single consumer (worker)
+	nodep::UINT_PTR queue[RIVER_SPECULATIVE_QUEUE_SIZE];
+	volatile long head, tail;
+
+	volatile long running, stopped;
+
+	static void ThreadProc(void *param);
+	void Run();
+	void TranslateSuccessors(nodep::UINT_PTR addr, nodep::DWORD depth);
+	void FreeBlock(RiverBasicBlock *pCB);
+public :
+	void *operator new(size_t);
+	void operator delete(void *);
+
+	bool Init(RiverBasicBlockCache *cache, RiverRuntime *rt, nodep::DWORD heapSize, nodep::DWORD outBufferSize, nodep::DWORD flags);
+	bool Start();
+	void Stop();
+	void Destroy();
+
+	void Enqueue(const RiverBasicBlock *pCB);
+};
+
+#endif
@@ -22,7 +22,7 @@ void RiverTrackingX86Assembler::AssemblePushReg(const RiverRegister &reg, Reloca
 	const nodep::BYTE markRegInstr[] = { 0xFF, 0x35, 0x00, 0x00, 0x00, 0x00 };
 
 	rev_memcpy(px86.cursor, markRegInstr, sizeof(markRegInstr));
-	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)&runtime->taintedRegisters[GetFundamentalRegister(reg.name)];
+	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)runtime->GetTaintedRegister(reg.name);
 	px86.cursor += sizeof(markRegInstr);
 	instrCounter++;
 }
@@ -84,7 +84,7 @@ void RiverTrackingX86Assembler::AssemblePopReg(const RiverRegister &reg, Relocab
 	const nodep::BYTE unmarkRegInstr[] = { 0x8F, 0x05, 0x00, 0x00, 0x00, 0x00 };
 
 	rev_memcpy(px86.cursor, unmarkRegInstr, sizeof(unmarkRegInstr));
-	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)&runtime->taintedRegisters[GetFundamentalRegister(reg.name)];
+	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)runtime->GetTaintedRegister(reg.name);
 	px86.cursor += sizeof(unmarkRegInstr);
 	instrCounter++;
 }
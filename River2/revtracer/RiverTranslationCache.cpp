@@ -0,0 +1,305 @@
+#include "RiverTranslationCache.h"
+#include "CodeGen.h"
+#include "mm.h"
+#include "sync.h"
+
+#define SLOT_NONE				0xFFFFFFFF
+#define FORMAT_WAIT				0x01000000
+
+// RiverAddress without the vtable pointer, same as the block dumps
+#define ADDRESS_BODY_SIZE		(sizeof(RiverAddress32) - sizeof(void *))
+
+bool RiverTranslationCache::Init(RiverCodeGen *cg, void *buffer, nodep::DWORD size) {
+	codegen = cg;
+	header = NULL;
+	slots = NULL;
+	data = NULL;
+	Reset();
+
+	nodep::DWORD dataOffset = sizeof(RiverTranslationCacheHeader) + RIVER_TRANSLATION_CACHE_SLOTS * sizeof(RiverTranslationCacheSlot);
+	if ((NULL == buffer) || (size <= dataOffset + RIVER_TRANSLATION_CACHE_RECORD_SIZE)) {
+		return true;
+	}
+
+	RiverTranslationCacheHeader *hdr = (RiverTranslationCacheHeader *)buffer;
+	long prev = RiverAtomicCompareExchange(&hdr->magic, RIVER_TRANSLATION_CACHE_FORMATTING, 0);
+
+	if (0 == prev) {
+		// new file, this instance formats it
+		hdr->version = RIVER_TRANSLATION_CACHE_VERSION;
+		hdr->instructionSize = sizeof(RiverInstruction);
+		hdr->slotCount = RIVER_TRANSLATION_CACHE_SLOTS;
+		hdr->dataOffset = dataOffset;
+		hdr->dataSize = size - dataOffset;
+		hdr->dataTop = 0;
+		hdr->reserved = 0;
+		rev_memset((nodep::BYTE *)buffer + sizeof(*hdr), 0, RIVER_TRANSLATION_CACHE_SLOTS * sizeof(RiverTranslationCacheSlot));
+		RiverAtomicExchange(&hdr->magic, RIVER_TRANSLATION_CACHE_MAGIC);
+	} else {
+		for (nodep::DWORD i = 0; (i < FORMAT_WAIT) && (RIVER_TRANSLATION_CACHE_FORMATTING == hdr->magic); ++i);
+	}
+
+	if ((RIVER_TRANSLATION_CACHE_MAGIC != hdr->magic) ||
+		(RIVER_TRANSLATION_CACHE_VERSION != hdr->version) ||
+		(sizeof(RiverInstruction) != hdr->instructionSize) ||
+		(RIVER_TRANSLATION_CACHE_SLOTS != hdr->slotCount) ||
+		(dataOffset != hdr->dataOffset) ||
+		(hdr->dataSize > size - dataOffset)) {
+		revtracerImports.dbgPrintFunc(PRINT_INFO, "Translation cache @%08x is not usable\n", (nodep::DWORD)buffer);
+		return true;
+	}
+
+	header = hdr;
+	slots = (RiverTranslationCacheSlot *)&hdr[1];
+	data = (nodep::BYTE *)buffer + dataOffset;
+	revtracerImports.dbgPrintFunc(PRINT_INFO, "Translation cache @%08x, %d bytes used\n", (nodep::DWORD)buffer, hdr->dataTop);
+	return true;
+}
+
+void RiverTranslationCache::Reset() {
+	crtSlot = SLOT_NONE;
+	replay = replayStart = replayEnd = NULL;
+	recording = false;
+	recordSize = 0;
+}
+
+nodep::DWORD RiverTranslationCache::Hash(nodep::DWORD address, nodep::DWORD flags) {
+	nodep::DWORD h = (address * 0x9E3779B1) ^ (flags * 0x85EBCA6B);
+	return (h ^ (h >> 15)) & (RIVER_TRANSLATION_CACHE_SLOTS - 1);
+}
+
+bool RiverTranslationCache::Lookup(nodep::DWORD address, nodep::DWORD flags) {
+	Reset();
+
+	if (NULL == header) {
+		return false;
+	}
+
+	recording = true;
+
+	nodep::DWORD h = Hash(address, flags);
+	for (nodep::DWORD i = 0; i < RIVER_TRANSLATION_CACHE_PROBES; ++i) {
+		nodep::DWORD idx = (h + i) & (RIVER_TRANSLATION_CACHE_SLOTS - 1);
+		long state = slots[idx].state;
+
+		if (RIVER_TRANSLATION_SLOT_EMPTY == RIVER_TRANSLATION_SLOT_KIND(state)) {
+			break;
+		}
+
+		if (RIVER_TRANSLATION_SLOT_READY != RIVER_TRANSLATION_SLOT_KIND(state)) {
+			continue;
+		}
+
+		RiverTranslationCacheSlot slot;
+		rev_memcpy(&slot, (const void *)&slots[idx], sizeof(slot));
+
+		// the slot was rewritten while being read
+		if (state != slots[idx].state) {
+			continue;
+		}
+
+		if ((slot.address != address) || (slot.flags != flags)) {
+			continue;
+		}
+
+		crtSlot = idx;
+		if ((slot.offset > header->dataSize) || (slot.length > header->dataSize - slot.offset)) {
+			return false;
+		}
+
+		replay = replayStart = data + slot.offset;
+		replayEnd = replay + slot.length;
+		return true;
+	}
+
+	return false;
+}
+
+/* The already replayed instructions are identical to what the disassembler
+ * would produce, they are kept in the new record. */
+void RiverTranslationCache::StopReplay() {
+	recordSize = replay - replayStart;
+	rev_memcpy(record, replayStart, recordSize);
+	replay = replayStart = replayEnd = NULL;
+}
+
+bool RiverTranslationCache::Replay(nodep::BYTE *&px86, RiverInstruction *rOut, nodep::DWORD &count, nodep::DWORD capacity, nodep::DWORD &dwFlags, RevtracerError *rerror) {
+	if (NULL == replay) {
+		return false;
+	}
+
+	const RiverTranslationCacheRecord *rec = (const RiverTranslationCacheRecord *)replay;
+	if (replay + sizeof(*rec) > replayEnd) {
+		StopReplay();
+		return false;
+	}
+
+	const RiverInstruction *instr = (const RiverInstruction *)&rec[1];
+	const nodep::BYTE *addr = (const nodep::BYTE *)&instr[rec->instrCount];
+	const nodep::BYTE *next = addr + rec->addrCount * ADDRESS_BODY_SIZE;
+
+	if ((next > replayEnd) || (0 == rec->x86Size) || (rec->x86Size > sizeof(rec->x86)) ||
+		(0 == rec->instrCount) || (rec->instrCount > capacity - count)) {
+		StopReplay();
+		return false;
+	}
+
+	// the file is shared, every address index must point inside this record
+	nodep::DWORD memCount = 0;
+	for (nodep::DWORD i = 0; i < rec->instrCount; ++i) {
+		for (nodep::DWORD j = 0; j < 4; ++j) {
+			if (RIVER_OPTYPE_MEM == RIVER_OPTYPE(instr[i].opTypes[j])) {
+				if ((nodep::DWORD)instr[i].operands[j].asAddress >= rec->addrCount) {
+					StopReplay();
+					return false;
+				}
+				memCount++;
+			}
+		}
+	}
+
+	if ((memCount != rec->addrCount) || (!codegen->CanAllocAddr(memCount))) {
+		StopReplay();
+		return false;
+	}
+
+	// stops at the first difference, never reads past the guest instruction
+	for (nodep::DWORD i = 0; i < rec->x86Size; ++i) {
+		if (rec->x86[i] != px86[i]) {
+			StopReplay();
+			return false;
+		}
+	}
+
+	for (nodep::DWORD i = 0; i < rec->instrCount; ++i) {
+		RiverInstruction &ri = rOut[count + i];
+		rev_memcpy(&ri, &instr[i], sizeof(ri));
+
+		for (nodep::DWORD j = 0; j < 4; ++j) {
+			if (RIVER_OPTYPE_MEM == RIVER_OPTYPE(ri.opTypes[j])) {
+				RiverAddress *mem = codegen->AllocAddr(0);
+				rev_memcpy(&mem->type, addr + (nodep::DWORD)ri.operands[j].asAddress * ADDRESS_BODY_SIZE, ADDRESS_BODY_SIZE);
+				ri.operands[j].asAddress = mem;
+			}
+		}
+	}
+
+	rev_memcpy(codegen->regVersions, rec->regVersions, sizeof(codegen->regVersions));
+
+	rerror->errorCode = RERROR_OK;
+	rerror->translatorId = RIVER_NONE_ID;
+	rerror->instructionAddress = (nodep::DWORD)px86;
+	rerror->prefix = 0x00;
+	rerror->opcode = *px86;
+
+	count += rec->instrCount;
+	dwFlags = rec->disassFlags;
+	px86 += rec->x86Size;
+	replay = next;
+	return true;
+}
+
+void RiverTranslationCache::Record(const nodep::BYTE *px86, nodep::DWORD x86Size, const RiverInstruction *ri, nodep::DWORD count, nodep::DWORD dwFlags) {
+	if (!recording || (NULL != replay)) {
+		return;
+	}
+
+	nodep::DWORD addrCount = 0;
+	for (nodep::DWORD i = 0; i < count; ++i) {
+		for (nodep::DWORD j = 0; j < 4; ++j) {
+			if (RIVER_OPTYPE_MEM == RIVER_OPTYPE(ri[i].opTypes[j])) {
+				addrCount++;
+			}
+		}
+	}
+
+	RiverTranslationCacheRecord *rec = (RiverTranslationCacheRecord *)&record[recordSize];
+	nodep::DWORD needed = sizeof(*rec) + count * sizeof(RiverInstruction) + addrCount * ADDRESS_BODY_SIZE;
+
+	if ((x86Size > sizeof(rec->x86)) || (count > 0xFF) || (addrCount > 0xFF) || (needed > sizeof(record) - recordSize)) {
+		recording = false;
+		return;
+	}
+
+	rec->x86Size = (nodep::BYTE)x86Size;
+	rec->instrCount = (nodep::BYTE)count;
+	rec->addrCount = (nodep::BYTE)addrCount;
+	rec->reserved = 0;
+	rec->disassFlags = dwFlags;
+	rev_memcpy(rec->regVersions, codegen->regVersions, sizeof(rec->regVersions));
+	rev_memset(rec->x86, 0, sizeof(rec->x86));
+	rev_memcpy(rec->x86, px86, x86Size);
+
+	RiverInstruction *instr = (RiverInstruction *)&rec[1];
+	nodep::BYTE *addr = (nodep::BYTE *)&instr[count];
+
+	addrCount = 0;
+	for (nodep::DWORD i = 0; i < count; ++i) {
+		rev_memcpy(&instr[i], &ri[i], sizeof(instr[i]));
+
+		for (nodep::DWORD j = 0; j < 4; ++j) {
+			if (RIVER_OPTYPE_MEM == RIVER_OPTYPE(ri[i].opTypes[j])) {
+				rev_memcpy(addr + addrCount * ADDRESS_BODY_SIZE, &ri[i].operands[j].asAddress->type, ADDRESS_BODY_SIZE);
+				instr[i].operands[j].asAddress = (RiverAddress *)addrCount;
+				addrCount++;
+			}
+		}
+	}
+
+	recordSize += needed;
+}
+
+bool RiverTranslationCache::Publish(nodep::DWORD slot, long state, nodep::DWORD address, nodep::DWORD flags, nodep::DWORD size) {
+	long busy = RIVER_TRANSLATION_SLOT_NEXT(state, RIVER_TRANSLATION_SLOT_BUSY);
+
+	if (state != RiverAtomicCompareExchange(&slots[slot].state, busy, state)) {
+		return false;
+	}
+
+	long offset = RiverAtomicAdd(&header->dataTop, (recordSize + 3) & ~3);
+	if (((nodep::DWORD)offset > header->dataSize) || (recordSize > header->dataSize - offset)) {
+		// the cache is full, leave the slot as it was
+		RiverAtomicExchange(&slots[slot].state, RIVER_TRANSLATION_SLOT_NEXT(busy, RIVER_TRANSLATION_SLOT_KIND(state)));
+		return true;
+	}
+
+	rev_memcpy(data + offset, record, recordSize);
+
+	slots[slot].address = address;
+	slots[slot].flags = flags;
+	slots[slot].size = size;
+	slots[slot].offset = offset;
+	slots[slot].length = recordSize;
+
+	RiverAtomicExchange(&slots[slot].state, RIVER_TRANSLATION_SLOT_NEXT(busy, RIVER_TRANSLATION_SLOT_READY));
+	return true;
+}
+
+bool RiverTranslationCache::Commit(nodep::DWORD address, nodep::DWORD flags, nodep::DWORD size) {
+	bool ret = false;
+
+	if (NULL != replay) {
+		// the whole block came from the cache
+		ret = true;
+	} else if (recording && (0 != recordSize)) {
+		// a stale entry is rewritten in place, otherwise the first free slot is claimed
+		if (SLOT_NONE != crtSlot) {
+			long state = slots[crtSlot].state;
+			ret = (RIVER_TRANSLATION_SLOT_READY == RIVER_TRANSLATION_SLOT_KIND(state)) &&
+				Publish(crtSlot, state, address, flags, size);
+		}
+
+		nodep::DWORD h = Hash(address, flags);
+		for (nodep::DWORD i = 0; !ret && (i < RIVER_TRANSLATION_CACHE_PROBES); ++i) {
+			nodep::DWORD idx = (h + i) & (RIVER_TRANSLATION_CACHE_SLOTS - 1);
+			long state = slots[idx].state;
+
+			if (RIVER_TRANSLATION_SLOT_EMPTY == RIVER_TRANSLATION_SLOT_KIND(state)) {
+				ret = Publish(idx, state, address, flags, size);
+			}
+		}
+	}
+
+	Reset();
+	return ret;
+}
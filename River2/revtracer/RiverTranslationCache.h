@@ -0,0 +1,101 @@
+#ifndef _RIVER_TRANSLATION_CACHE_H
+#define _RIVER_TRANSLATION_CACHE_H
+
+#include "revtracer.h"
+#include "river.h"
+
+using namespace rev;
+
+class RiverCodeGen;
+
+#define RIVER_TRANSLATION_CACHE_MAGIC			0x43545652 // 'RVTC'
+#define RIVER_TRANSLATION_CACHE_FORMATTING		0x54524F46 // 'FORT', another instance is formatting the file
+#define RIVER_TRANSLATION_CACHE_VERSION			0x00000001
+
+#define RIVER_TRANSLATION_CACHE_SLOTS			0x4000 // power of 2
+#define RIVER_TRANSLATION_CACHE_PROBES			0x10
+#define RIVER_TRANSLATION_CACHE_RECORD_SIZE		0x10000
+
+/* Slot state: the low bits hold the kind, the rest is a generation that is
+ * increased on every update so that readers can detect concurrent writes. */
+#define RIVER_TRANSLATION_SLOT_EMPTY			0x00
+#define RIVER_TRANSLATION_SLOT_BUSY				0x01
+#define RIVER_TRANSLATION_SLOT_READY			0x02
+#define RIVER_TRANSLATION_SLOT_KIND(s)			((s) & 0x03)
+#define RIVER_TRANSLATION_SLOT_NEXT(s, kind)	((((s) & ~0x03) + 0x04) | (kind))
+
+struct RiverTranslationCacheSlot {
+	volatile long state;
+	nodep::DWORD address;
+	nodep::DWORD flags;
+	nodep::DWORD size;
+	nodep::DWORD offset; // from the start of the data area
+	nodep::DWORD length;
+};
+
+/* The file layout is header | slots | data. Every instance maps the file at a
+ * different address, thus nothing inside it is referenced by pointer. */
+struct RiverTranslationCacheHeader {
+	volatile long magic;
+	nodep::DWORD version;
+	nodep::DWORD instructionSize; // sizeof(RiverInstruction) of the writer
+	nodep::DWORD slotCount;
+	nodep::DWORD dataOffset;
+	nodep::DWORD dataSize;
+	volatile long dataTop; // bump allocator, data is never reclaimed
+	nodep::DWORD reserved;
+};
+
+/* One x86 instruction, as produced by the disassembler, rep and meta
+ * translators. It is followed by instrCount instructions (memory operands
+ * hold an index instead of the address pointer) and by addrCount address
+ * bodies (a RiverAddress without its vtable). */
+struct RiverTranslationCacheRecord {
+	nodep::BYTE x86Size;
+	nodep::BYTE instrCount;
+	nodep::BYTE addrCount;
+	nodep::BYTE reserved;
+	nodep::DWORD disassFlags;
+	unsigned int regVersions[16];
+	nodep::BYTE x86[16];
+};
+
+/* Persistent cache of the decoded river code of the basic blocks, shared by
+ * the tracer instances that map the same file.
+ * The assembled code embeds the runtime addresses of the current instance,
+ * thus only the front end output is kept and the instrumentation and the
+ * assembly are always redone. Entries are keyed by the block address and the
+ * translation flags. The cached x86 bytes of every instruction are compared
+ * to the guest code before being used, a mismatch resumes the translation
+ * from the disassembler and the entry is rewritten.
+ * Slots are claimed with an interlocked exchange and published last, the
+ * data area is append only. */
+class RiverTranslationCache {
+private :
+	RiverCodeGen *codegen;
+
+	RiverTranslationCacheHeader *header;
+	RiverTranslationCacheSlot *slots;
+	nodep::BYTE *data;
+
+	nodep::DWORD crtSlot;
+	const nodep::BYTE *replay, *replayStart, *replayEnd;
+
+	bool recording;
+	nodep::DWORD recordSize;
+	nodep::BYTE record[RIVER_TRANSLATION_CACHE_RECORD_SIZE];
+
+	static nodep::DWORD Hash(nodep::DWORD address, nodep::DWORD flags);
+	void StopReplay();
+	bool Publish(nodep::DWORD slot, long state, nodep::DWORD address, nodep::DWORD flags, nodep::DWORD size);
+public :
+	bool Init(RiverCodeGen *cg, void *buffer, nodep::DWORD size);
+	void Reset();
+
+	bool Lookup(nodep::DWORD address, nodep::DWORD flags);
+	bool Replay(nodep::BYTE *&px86, RiverInstruction *rOut, nodep::DWORD &count, nodep::DWORD capacity, nodep::DWORD &dwFlags, RevtracerError *rerror);
+	void Record(const nodep::BYTE *px86, nodep::DWORD x86Size, const RiverInstruction *ri, nodep::DWORD count, nodep::DWORD dwFlags);
+	bool Commit(nodep::DWORD address, nodep::DWORD flags, nodep::DWORD size);
+};
+
+#endif
@@ -78,7 +78,11 @@ bool RiverX86Assembler::Translate(const RiverInstruction &ri, RelocableCodeBuffe
 		switch (ri.opCode) {
 			case 0x50:
 			case 0x58:
-				AssemblePlusRegInstr(ri, px86, pFlags, instrCounter);
+				if (RIVER_REG_IS_XMM(ri.operands[0].asRegister.name)) {
+					AssembleRiverXmmPushPopInstr(ri, px86, pFlags, instrCounter);
+				} else {
+					AssemblePlusRegInstr(ri, px86, pFlags, instrCounter);
+				}
 				AssembleNoOp(ri, px86);
 				break;
 
@@ -114,6 +118,32 @@ bool RiverX86Assembler::Translate(const RiverInstruction &ri, RelocableCodeBuffe
 }
 
 
+// there is no push xmm, the register is moved through 16 bytes of stack
+void RiverX86Assembler::AssembleRiverXmmPushPopInstr(const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
+	static const unsigned char codePush[] = {
+		0x8D, 0x64, 0x24, 0xF0,				// 0x00 - lea esp, [esp - 0x10]
+		0xF3, 0x0F, 0x7F, 0x04, 0x24		// 0x04 - movdqu [esp], xmm0
+	};
+
+	static const unsigned char codePop[] = {
+		0xF3, 0x0F, 0x6F, 0x04, 0x24,		// 0x00 - movdqu xmm0, [esp]
+		0x8D, 0x64, 0x24, 0x10				// 0x05 - lea esp, [esp + 0x10]
+	};
+
+	nodep::BYTE regName = ri.operands[0].asRegister.name & 0x07;
+
+	if (0x50 == ri.opCode) {
+		rev_memcpy(px86.cursor, codePush, sizeof(codePush));
+		px86.cursor[0x07] |= regName << 3;
+		px86.cursor += sizeof(codePush);
+	} else {
+		rev_memcpy(px86.cursor, codePop, sizeof(codePop));
+		px86.cursor[0x03] |= regName << 3;
+		px86.cursor += sizeof(codePop);
+	}
+	instrCounter += 2;
+}
+
 void RiverX86Assembler::AssembleRiverAddSubInstr(const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
 	*px86.cursor = 0x8d; // add and sub are converted to lea
 	px86.cursor++;
@@ -150,5 +180,7 @@ void RiverX86Assembler::AssembleRegModRMOp(const RiverInstruction &ri, Relocable
 }
 
 void RiverX86Assembler::AssembleModRMOp(unsigned int opIdx, const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::BYTE extra) {
-	ri.operands[opIdx].asAddress->EncodeTox86(px86.cursor, extra, ri.family, ri.modifiers);
+	if (!ri.operands[opIdx].asAddress->EncodeTox86(px86.cursor, extra, ri.family, ri.modifiers)) {
+		px86.MarkFailed();
+	}
 }
@@ -24,6 +24,7 @@ public :
 	virtual bool Translate(const RiverInstruction &ri, RelocableCodeBuffer &px86,  nodep::DWORD &pFlags, nodep::BYTE &currentFamily, nodep::BYTE &repReg,  nodep::DWORD &instrCounter, nodep::BYTE outputType);
 
 private :
+	void AssembleRiverXmmPushPopInstr(const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter);
 	void AssembleRiverAddSubInstr(const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter);
 
 	void AssembleRiverAddSubOp(const RiverInstruction &ri, RelocableCodeBuffer &px86);
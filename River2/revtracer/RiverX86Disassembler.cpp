@@ -136,6 +136,18 @@ void RiverX86Disassembler::DisassembleUnkInstr(nodep::BYTE *&px86, RiverInstruct
 	px86 = (nodep::BYTE*)INVALID_ADDRESS;
 }
 
+nodep::BYTE RiverX86Disassembler::GetSsePrefix(const RiverInstruction &ri) const {
+	if (ri.modifiers & (RIVER_MODIFIER_REP | RIVER_MODIFIER_REPNZ | RIVER_MODIFIER_LOCK)) {
+		return 0;
+	}
+
+	if (ri.modifiers & RIVER_MODIFIER_REPZ) {
+		return (ri.modifiers & RIVER_MODIFIER_O16) ? 0 : RIVER_SSE_PFX_F3;
+	}
+
+	return (ri.modifiers & RIVER_MODIFIER_O16) ? RIVER_SSE_PFX_66 : RIVER_SSE_PFX_NONE;
+}
+
 /* =========================================== */
 /* Operand helpers                             */
 /* =========================================== */
@@ -284,6 +296,26 @@ void RiverX86Disassembler::DisassembleMoffs32(nodep::BYTE opIdx, nodep::BYTE *&p
 	ri.operands[opIdx].asAddress = rAddr;
 }
 
+void RiverX86Disassembler::DisassembleXmmRegOp(nodep::BYTE opIdx, RiverInstruction &ri, nodep::BYTE reg) {
+	ri.opTypes[opIdx] = RIVER_OPTYPE_REG | RIVER_OPSIZE_128;
+	ri.operands[opIdx].asRegister.versioned = codegen->GetCurrentReg(RIVER_REG_XMM | (reg & 0x07));
+}
+
+// the operand size prefix is mandatory here, it must not shrink the operand
+void RiverX86Disassembler::DisassembleXmmModRMOp(nodep::BYTE opIdx, nodep::BYTE *&px86, RiverInstruction &ri, nodep::BYTE &extra, bool isXmm) {
+	RiverAddress *rAddr;
+
+	rAddr = codegen->AllocAddr(ri.modifiers); //new RiverAddress;
+	rAddr->DecodeFromx86(*codegen, px86, extra, ri.modifiers & ~(RIVER_MODIFIER_O8 | RIVER_MODIFIER_O16));
+
+	if (isXmm && (0 == rAddr->type)) {
+		rAddr->base.versioned = codegen->GetCurrentReg(RIVER_REG_XMM | (rAddr->base.name & 0x07));
+	}
+
+	ri.opTypes[opIdx] = RIVER_OPTYPE_MEM | (isXmm ? RIVER_OPSIZE_128 : RIVER_OPSIZE_32);
+	ri.operands[opIdx].asAddress = rAddr;
+}
+
 /* =========================================== */
 /* Operand disassemblers                       */
 /* =========================================== */
@@ -371,6 +403,45 @@ void RiverX86Disassembler::DisassembleRegModRMImm32(nodep::BYTE *&px86, RiverIns
 	DisassembleImmOp(2, px86, ri, RIVER_OPSIZE_32);
 }
 
+void RiverX86Disassembler::DisassembleXmmRegModRM(nodep::BYTE *&px86, RiverInstruction &ri) {
+	nodep::BYTE sec;
+	DisassembleXmmModRMOp(1, px86, ri, sec, true);
+	DisassembleXmmRegOp(0, ri, sec);
+}
+
+void RiverX86Disassembler::DisassembleXmmModRMReg(nodep::BYTE *&px86, RiverInstruction &ri) {
+	nodep::BYTE sec;
+	DisassembleXmmModRMOp(0, px86, ri, sec, true);
+	DisassembleXmmRegOp(1, ri, sec);
+}
+
+void RiverX86Disassembler::DisassembleXmmRegModRMImm8(nodep::BYTE *&px86, RiverInstruction &ri) {
+	nodep::BYTE sec;
+	DisassembleXmmModRMOp(1, px86, ri, sec, true);
+	DisassembleXmmRegOp(0, ri, sec);
+	DisassembleImmOp(2, px86, ri, RIVER_OPSIZE_8);
+}
+
+void RiverX86Disassembler::DisassembleXmmRegModRM32(nodep::BYTE *&px86, RiverInstruction &ri) {
+	nodep::BYTE sec;
+	DisassembleXmmModRMOp(1, px86, ri, sec, false);
+	DisassembleXmmRegOp(0, ri, sec);
+}
+
+void RiverX86Disassembler::DisassembleModRM32XmmReg(nodep::BYTE *&px86, RiverInstruction &ri) {
+	nodep::BYTE sec;
+	DisassembleXmmModRMOp(0, px86, ri, sec, false);
+	DisassembleXmmRegOp(1, ri, sec);
+}
+
+// pmovmskb r32, xmm
+void RiverX86Disassembler::DisassembleRegXmmModRM(nodep::BYTE *&px86, RiverInstruction &ri) {
+	nodep::BYTE sec;
+	DisassembleXmmModRMOp(1, px86, ri, sec, true);
+	ri.opTypes[0] = RIVER_OPTYPE_REG;
+	ri.operands[0].asRegister.versioned = codegen->GetCurrentReg(sec);
+}
+
 // 32 EAX AX
 // 16 AX AL
 nodep::BYTE LookupConvertRegSize[2][2] = {
@@ -704,8 +775,8 @@ const nodep::WORD specTbl[2][0x100] = {
 			/*0x25*/ 0xFF,
 			/*0x26*/ 0xFF,
 			/*0x27*/ 0xFF,
-			/*0x28*/ 0xFF,
-			/*0x29*/ 0xFF,
+			/*0x28*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG | RIVER_SPEC_IGNORES_OP1,
+			/*0x29*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG | RIVER_SPEC_IGNORES_OP1,
 			/*0x2A*/ 0xFF,
 			/*0x2B*/ 0xFF,
 			/*0x2C*/ 0xFF,
@@ -760,29 +831,29 @@ const nodep::WORD specTbl[2][0x100] = {
 			/*0x5D*/ 0xFF,
 			/*0x5E*/ 0xFF,
 			/*0x5F*/ 0xFF,
-			/*0x60*/ 0xFF,
-			/*0x61*/ 0xFF,
-			/*0x62*/ 0xFF,
+			/*0x60*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x61*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x62*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0x63*/ 0xFF,
-			/*0x64*/ 0xFF,
-			/*0x65*/ 0xFF,
-			/*0x66*/ 0xFF,
+			/*0x64*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x65*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x66*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0x67*/ 0xFF,
-			/*0x68*/ 0xFF,
-			/*0x69*/ 0xFF,
-			/*0x6A*/ 0xFF,
+			/*0x68*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x69*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x6A*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0x6B*/ 0xFF,
-			/*0x6C*/ 0xFF,
-			/*0x6D*/ 0xFF,
-			/*0x6E*/ 0xFF,
-			/*0x6F*/ 0xFF,
-			/*0x70*/ 0xFF,
+			/*0x6C*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x6D*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x6E*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG | RIVER_SPEC_IGNORES_OP1,
+			/*0x6F*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG | RIVER_SPEC_IGNORES_OP1,
+			/*0x70*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG | RIVER_SPEC_IGNORES_OP1,
 			/*0x71*/ 0xFF,
 			/*0x72*/ 0xFF,
 			/*0x73*/ 0xFF,
-			/*0x74*/ 0xFF,
-			/*0x75*/ 0xFF,
-			/*0x76*/ 0xFF,
+			/*0x74*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x75*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0x76*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0x77*/ 0xFF,
 			/*0x78*/ 0xFF,
 			/*0x79*/ 0xFF,
@@ -790,8 +861,8 @@ const nodep::WORD specTbl[2][0x100] = {
 			/*0x7B*/ 0xFF,
 			/*0x7C*/ 0xFF,
 			/*0x7D*/ 0xFF,
-			/*0x7E*/ 0xFF,
-			/*0x7F*/ 0xFF,
+			/*0x7E*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG | RIVER_SPEC_IGNORES_OP1,
+			/*0x7F*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG | RIVER_SPEC_IGNORES_OP1,
 			/*0x80*/ 0,
 			/*0x81*/ 0,
 			/*0x82*/ 0,
@@ -876,18 +947,18 @@ const nodep::WORD specTbl[2][0x100] = {
 			/*0xD1*/ 0xFF,
 			/*0xD2*/ 0xFF,
 			/*0xD3*/ 0xFF,
-			/*0xD4*/ 0xFF,
+			/*0xD4*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0xD5*/ 0xFF,
 			/*0xD6*/ 0xFF,
-			/*0xD7*/ 0xFF,
+			/*0xD7*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG | RIVER_SPEC_IGNORES_OP1,
 			/*0xD8*/ 0xFF,
 			/*0xD9*/ 0xFF,
-			/*0xDA*/ 0xFF,
-			/*0xDB*/ 0xFF,
+			/*0xDA*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0xDB*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0xDC*/ 0xFF,
 			/*0xDD*/ 0xFF,
-			/*0xDE*/ 0xFF,
-			/*0xDF*/ 0xFF,
+			/*0xDE*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0xDF*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0xE0*/ 0xFF,
 			/*0xE1*/ 0xFF,
 			/*0xE2*/ 0xFF,
@@ -895,15 +966,15 @@ const nodep::WORD specTbl[2][0x100] = {
 			/*0xE4*/ 0xFF,
 			/*0xE5*/ 0xFF,
 			/*0xE6*/ 0xFF,
-			/*0xE7*/ 0xFF,
+			/*0xE7*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG | RIVER_SPEC_IGNORES_OP1,
 			/*0xE8*/ 0xFF,
 			/*0xE9*/ 0xFF,
 			/*0xEA*/ 0xFF,
-			/*0xEB*/ 0xFF,
+			/*0xEB*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0xEC*/ 0xFF,
 			/*0xED*/ 0xFF,
 			/*0xEE*/ 0xFF,
-			/*0xEF*/ 0xFF,
+			/*0xEF*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0xF0*/ 0xFF,
 			/*0xF1*/ 0xFF,
 			/*0xF2*/ 0xFF,
@@ -912,13 +983,13 @@ const nodep::WORD specTbl[2][0x100] = {
 			/*0xF5*/ 0xFF,
 			/*0xF6*/ 0xFF,
 			/*0xF7*/ 0xFF,
-			/*0xF8*/ 0xFF,
-			/*0xF9*/ 0xFF,
-			/*0xFA*/ 0xFF,
-			/*0xFB*/ 0xFF,
-			/*0xFC*/ 0xFF,
-			/*0xFD*/ 0xFF,
-			/*0xFE*/ 0xFF,
+			/*0xF8*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0xF9*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0xFA*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0xFB*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0xFC*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0xFD*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
+			/*0xFE*/ RIVER_SPEC_MODIFIES_OP1 | RIVER_SPEC_IGNORES_FLG,
 			/*0xFF*/ 0xFF
 		}
 };
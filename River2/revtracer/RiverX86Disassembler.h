@@ -6,6 +6,11 @@
 
 class RiverCodeGen;
 
+/* Mandatory prefixes accepted by an SSE opcode */
+#define RIVER_SSE_PFX_NONE			0x01
+#define RIVER_SSE_PFX_66			0x02
+#define RIVER_SSE_PFX_F3			0x04
+
 nodep::WORD GetSpecifiers(RiverInstruction &ri);
 
 class RiverX86Disassembler {
@@ -55,6 +60,20 @@ private :
 	}
 
 
+	nodep::BYTE GetSsePrefix(const RiverInstruction &ri) const;
+
+	/* the 66/F3 prefixes select the instruction, they stay in ri.modifiers so that they get reassembled */
+	template <nodep::BYTE prefixes> void DisassembleSseInstr(nodep::BYTE *&px86, RiverInstruction &ri, nodep::DWORD &flags) {
+		if (0 == (prefixes & GetSsePrefix(ri))) {
+			DisassembleUnkInstr(px86, ri, flags);
+			return;
+		}
+
+		ri.opCode = *px86;
+		ri.specifiers = GetSpecifiers(ri);
+		px86++;
+	}
+
 	void DisassembleConvertOperands(nodep::BYTE opIdx, RiverInstruction &ri);
 	void DisassembleConvertxAx(nodep::BYTE *&px86, RiverInstruction &ri, nodep::DWORD &flags);
 
@@ -201,6 +220,8 @@ private :
 	void DisassembleSzModRMOp(nodep::BYTE opIdx, nodep::BYTE *&px86, RiverInstruction &ri, nodep::BYTE &extra, nodep::WORD sz);
 	void DisassembleMoffs8(nodep::BYTE opIdx, nodep::BYTE *&px86, RiverInstruction &ri);
 	void DisassembleMoffs32(nodep::BYTE opIdx, nodep::BYTE *&px86, RiverInstruction &ri);
+	void DisassembleXmmRegOp(nodep::BYTE opIdx, RiverInstruction &ri, nodep::BYTE reg);
+	void DisassembleXmmModRMOp(nodep::BYTE opIdx, nodep::BYTE *&px86, RiverInstruction &ri, nodep::BYTE &extra, bool isXmm);
 
 	/* extra disassemblers */
 	void DropExtra(nodep::BYTE extra, RiverInstruction &ri) {}
@@ -231,6 +252,13 @@ private :
 	void DisassembleRegModRMImm8(nodep::BYTE *&px86, RiverInstruction &ri);
 	void DisassembleModRMRegImm8(nodep::BYTE *&px86, RiverInstruction &ri);
 
+	void DisassembleXmmRegModRM(nodep::BYTE *&px86, RiverInstruction &ri);
+	void DisassembleXmmModRMReg(nodep::BYTE *&px86, RiverInstruction &ri);
+	void DisassembleXmmRegModRMImm8(nodep::BYTE *&px86, RiverInstruction &ri);
+	void DisassembleXmmRegModRM32(nodep::BYTE *&px86, RiverInstruction &ri);
+	void DisassembleModRM32XmmReg(nodep::BYTE *&px86, RiverInstruction &ri);
+	void DisassembleRegXmmModRM(nodep::BYTE *&px86, RiverInstruction &ri);
+
 	template <nodep::BYTE opIdx> void DisassembleMoffs8(nodep::BYTE *&px86, RiverInstruction &ri) {
 		DisassembleMoffs32(opIdx, px86, ri);
 	}
@@ -124,7 +124,7 @@ RiverX86Disassembler::DisassembleOpcodeFunc RiverX86Disassembler::disassembleOpc
 
 			/*0x20*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
 			/*0x24*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0x28*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0x28*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_NONE | RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_NONE | RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
 			/*0x2C*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
 
 			/*0x30*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleDefaultInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
@@ -142,15 +142,15 @@ RiverX86Disassembler::DisassembleOpcodeFunc RiverX86Disassembler::disassembleOpc
 			/*0x58*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
 			/*0x5C*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
 
-			/*0x60*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0x64*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0x68*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0x6C*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0x60*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0x64*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0x68*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0x6C*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66 | RIVER_SSE_PFX_F3>,
 
-			/*0x70*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0x74*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0x70*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0x74*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleUnkInstr,
 			/*0x78*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0x7C*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0x7C*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66 | RIVER_SSE_PFX_F3>,
 
 			/*0x80*/ &RiverX86Disassembler::DisassembleRelJmpInstr<5>, &RiverX86Disassembler::DisassembleRelJmpInstr<5>, &RiverX86Disassembler::DisassembleRelJmpInstr<5>, &RiverX86Disassembler::DisassembleRelJmpInstr<5>,
 			/*0x84*/ &RiverX86Disassembler::DisassembleRelJmpInstr<5>, &RiverX86Disassembler::DisassembleRelJmpInstr<5>, &RiverX86Disassembler::DisassembleRelJmpInstr<5>, &RiverX86Disassembler::DisassembleRelJmpInstr<5>,
@@ -178,19 +178,19 @@ RiverX86Disassembler::DisassembleOpcodeFunc RiverX86Disassembler::disassembleOpc
 			/*0xCC*/ &RiverX86Disassembler::DisassemblePlusRegInstr<0xC8>, &RiverX86Disassembler::DisassemblePlusRegInstr<0xC8>, &RiverX86Disassembler::DisassemblePlusRegInstr<0xC8>, &RiverX86Disassembler::DisassemblePlusRegInstr<0xC8>,
 
 			/*0xD0*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0xD4*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0xD8*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0xDC*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0xD4*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>,
+			/*0xD8*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>,
+			/*0xDC*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>,
 
 			/*0xE0*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0xE4*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0xE8*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0xEC*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
+			/*0xE4*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>,
+			/*0xE8*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>,
+			/*0xEC*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>,
 
 			/*0xF0*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
 			/*0xF4*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0xF8*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr,
-			/*0xFC*/ &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr, &RiverX86Disassembler::DisassembleUnkInstr
+			/*0xF8*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>,
+			/*0xFC*/ &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleSseInstr<RIVER_SSE_PFX_66>, &RiverX86Disassembler::DisassembleUnkInstr
 		}
 };
 
@@ -565,8 +565,8 @@ RiverX86Disassembler::DisassembleOperandsFunc RiverX86Disassembler::disassembleO
 		/*0x25*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x26*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x27*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x28*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x29*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0x28*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x29*/ &RiverX86Disassembler::DisassembleXmmModRMReg,
 		/*0x2A*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x2B*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x2C*/ &RiverX86Disassembler::DisassembleUnkOp,
@@ -625,29 +625,29 @@ RiverX86Disassembler::DisassembleOperandsFunc RiverX86Disassembler::disassembleO
 		/*0x5D*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x5E*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x5F*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x60*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x61*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x62*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0x60*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x61*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x62*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0x63*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x64*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x65*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x66*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0x64*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x65*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x66*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0x67*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x68*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x69*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x6A*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0x68*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x69*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x6A*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0x6B*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x6C*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x6D*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x6E*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x6F*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x70*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0x6C*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x6D*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x6E*/ &RiverX86Disassembler::DisassembleXmmRegModRM32,
+		/*0x6F*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x70*/ &RiverX86Disassembler::DisassembleXmmRegModRMImm8,
 		/*0x71*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x72*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x73*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x74*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x75*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x76*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0x74*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x75*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0x76*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0x77*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x78*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x79*/ &RiverX86Disassembler::DisassembleUnkOp,
@@ -655,8 +655,8 @@ RiverX86Disassembler::DisassembleOperandsFunc RiverX86Disassembler::disassembleO
 		/*0x7B*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x7C*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0x7D*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x7E*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0x7F*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0x7E*/ &RiverX86Disassembler::DisassembleModRM32XmmReg,
+		/*0x7F*/ &RiverX86Disassembler::DisassembleXmmModRMReg,
 		/*0x80*/ &RiverX86Disassembler::DisassembleImm32,
 		/*0x81*/ &RiverX86Disassembler::DisassembleImm32,
 		/*0x82*/ &RiverX86Disassembler::DisassembleImm32,
@@ -745,18 +745,18 @@ RiverX86Disassembler::DisassembleOperandsFunc RiverX86Disassembler::disassembleO
 		/*0xD1*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xD2*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xD3*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xD4*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0xD4*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0xD5*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xD6*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xD7*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0xD7*/ &RiverX86Disassembler::DisassembleRegXmmModRM,
 		/*0xD8*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xD9*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xDA*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xDB*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0xDA*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0xDB*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0xDC*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xDD*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xDE*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xDF*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0xDE*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0xDF*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0xE0*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xE1*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xE2*/ &RiverX86Disassembler::DisassembleUnkOp,
@@ -764,15 +764,15 @@ RiverX86Disassembler::DisassembleOperandsFunc RiverX86Disassembler::disassembleO
 		/*0xE4*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xE5*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xE6*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xE7*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0xE7*/ &RiverX86Disassembler::DisassembleXmmModRMReg,
 		/*0xE8*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xE9*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xEA*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xEB*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0xEB*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0xEC*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xED*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xEE*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xEF*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0xEF*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0xF0*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xF1*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xF2*/ &RiverX86Disassembler::DisassembleUnkOp,
@@ -781,13 +781,13 @@ RiverX86Disassembler::DisassembleOperandsFunc RiverX86Disassembler::disassembleO
 		/*0xF5*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xF6*/ &RiverX86Disassembler::DisassembleUnkOp,
 		/*0xF7*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xF8*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xF9*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xFA*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xFB*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xFC*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xFD*/ &RiverX86Disassembler::DisassembleUnkOp,
-		/*0xFE*/ &RiverX86Disassembler::DisassembleUnkOp,
+		/*0xF8*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0xF9*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0xFA*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0xFB*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0xFC*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0xFD*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
+		/*0xFE*/ &RiverX86Disassembler::DisassembleXmmRegModRM,
 		/*0xFF*/ &RiverX86Disassembler::DisassembleUnkOp
 	}
 };
@@ -2,9 +2,13 @@
 #define _RUNTIME_H
 
 #include "revtracer.h"
+#include "river.h"
+
+#define SYMBOLIC_STREAM_SIZE		0x10000 // in dwords
 
 /* River runtime context */
-/* TODO: make the runtime threadsafe */
+/* The translated code addresses the runtime directly, every traced thread
+ * has its own execution environment and thus its own runtime (see TraceThread) */
 struct RiverRuntime {
 	nodep::UINT_PTR virtualStack;				// + 0x00 - mandatory first member (used in vm-rm transitions)
 	nodep::UINT_PTR returnRegister;			// + 0x04 - ax/eax/rax value
@@ -21,6 +25,21 @@ struct RiverRuntime {
 	nodep::UINT_PTR trackStack;				// + 0x60
 	nodep::UINT_PTR secondaryRegister;		// + 0x64
 	nodep::DWORD firstEsp;
+
+	nodep::DWORD taintedXmmRegisters[8];
+	rev::XmmRegister xmmRegisters[8];				// saved on every branch handler call
+
+	nodep::DWORD *symbolicStream;				// symbolic records, written by the tracking code (TRACER_FEATURE_SYMBOLIC_STREAM)
+	nodep::DWORD symbolicStreamPos;			// in dwords
+
+	rev::ReleaseTaintFunc releaseTaint;		// drops a replaced taint value (expression reference under TRACER_FEATURE_ADVANCED_TRACKING)
+
+	nodep::DWORD *GetTaintedRegister(nodep::BYTE reg) {
+		if (RIVER_REG_IS_XMM(reg)) {
+			return &taintedXmmRegisters[reg & 0x07];
+		}
+		return &taintedRegisters[GetFundamentalRegister(reg)];
+	}
 };
 
 #endif
@@ -44,6 +44,9 @@ bool SymbopReverseTranslator::Translate(const RiverInstruction &rIn, RiverInstru
 		switch (rIn.opCode) {
 			case 0x8F :
 				CopyInstruction(codegen, rOut, rIn);
+				if (RIVER_TRACK_MARK_FORCED == rIn.subOpCode) {
+					rOut.family |= RIVER_FAMILY_FLAG_IGNORE;
+				}
 				break;
 			default :
 				CopyInstruction(codegen, rOut, rIn);
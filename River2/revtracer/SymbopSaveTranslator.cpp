@@ -77,7 +77,10 @@ bool SymbopSaveTranslator::Translate(const RiverInstruction &rIn, RiverInstructi
 
 	switch (rIn.opCode) {
 		case 0x8F: //markmem
-			MakePushMem(rIn, rOut, instrCount);
+			// forced unmarks have no previous taint to restore
+			if (RIVER_TRACK_MARK_FORCED != rIn.subOpCode) {
+				MakePushMem(rIn, rOut, instrCount);
+			}
 			break;
 	}
 
@@ -2,6 +2,7 @@
 
 #include "CodeGen.h"
 #include "TranslatorUtil.h"
+#include "OperandLayout.h"
 
 nodep::DWORD SymbopTranslator::GetMemRepr(const RiverAddress &mem) {
 	return 0;
@@ -13,8 +14,9 @@ bool SymbopTranslator::Init(RiverCodeGen *cg) {
 }
 
 bool SymbopTranslator::Translate(const RiverInstruction &rIn, RiverInstruction *rMainOut, nodep::DWORD &instrCount, RiverInstruction *rTrackOut, nodep::DWORD &trackCount, nodep::DWORD dwTranslationFlags) {
-	if ((RIVER_FAMILY(rIn.family) == RIVER_FAMILY_RIVER) || (RIVER_FAMILY_FLAG_METAPROCESSED & rIn.family)) {
-		/* do not track river operations */
+	if ((RIVER_FAMILY(rIn.family) == RIVER_FAMILY_RIVER) || (RIVER_FAMILY_FLAG_METAPROCESSED & rIn.family) ||
+		((RIVER_FAMILY(rIn.family) == RIVER_FAMILY_REP) && (RIVER_REP_BULK_OPCODE == rIn.opCode))) {
+		/* do not track river operations, bulk rep operations track themselves */
 		CopyInstruction(codegen, *rMainOut, rIn);
 		rMainOut++;
 		instrCount++;
@@ -22,9 +24,10 @@ bool SymbopTranslator::Translate(const RiverInstruction &rIn, RiverInstruction *
 	}
 
 	nodep::DWORD dwTable = (RIVER_MODIFIER_EXT & rIn.modifiers) ? 1 : 0;
+	valid = true;
 	(this->*translateOpcodes[dwTable][rIn.opCode])(rIn, rMainOut, instrCount, rTrackOut, trackCount, dwTranslationFlags);
 
-	return true;
+	return valid;
 }
 
 void SymbopTranslator::MakeInitTrack(const RiverInstruction &rIn, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount) {
@@ -116,6 +119,11 @@ nodep::DWORD SymbopTranslator::MakeMarkFlg(nodep::BYTE flags, nodep::DWORD offse
 /*= REGISTER =================================================================*/
 
 nodep::DWORD SymbopTranslator::SaveRegValue(const RiverRegister &reg, RiverInstruction *&rMainOut, nodep::DWORD &instrCount) {
+	if (RIVER_REG_IS_XMM(reg.name)) {
+		// xmm values do not fit the tracking stack
+		return 0xFFFFFFFF;
+	}
+
 	trackedValues += 1; 
 	
 	rMainOut->opCode = 0x50; // lea eax, [mem]
@@ -149,6 +157,7 @@ nodep::DWORD SymbopTranslator::MakeTrackReg(bool ignoresValue, const RiverRegist
 
 nodep::DWORD SymbopTranslator::MakeMarkReg(const RiverRegister &reg, RiverInstruction *&rMainOut, nodep::DWORD &instrCount, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount) {
 	rTrackOut->opCode = 0x58; // pop + r
+	rTrackOut->subOpCode = 0;
 
 	rTrackOut->opTypes[0] = RIVER_OPTYPE_REG;
 	rTrackOut->operands[0].asRegister.versioned = reg.versioned;
@@ -237,6 +246,29 @@ nodep::DWORD SymbopTranslator::MakeMarkMem(bool ignoresMemory, const RiverAddres
 	return SaveMemValue(ignoresMemory, mem, rMainOut, instrCount);
 }
 
+/* Forced taint reset of a memory destination, the address is read from the
+ * tracking stack (see SaveAddrValue) and the whole operand is cleared. */
+void SymbopTranslator::MakeUnmarkMem(const RiverAddress &mem, nodep::BYTE opType, nodep::DWORD addrOffset, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount) {
+	static const nodep::BYTE opSizes[] = { 4, 2, 1, 16 };
+
+	rTrackOut->opCode = 0x8F;
+	rTrackOut->subOpCode = RIVER_TRACK_MARK_FORCED;
+	rTrackOut->specifiers = 0;
+	rTrackOut->modifiers = 0;
+	rTrackOut->family = RIVER_FAMILY_TRACK;
+	rTrackOut->opTypes[0] = RIVER_OPTYPE_MEM;
+	rTrackOut->operands[0].asAddress = codegen->CloneAddress(mem, 0);
+	rTrackOut->opTypes[1] = RIVER_OPTYPE_IMM | RIVER_OPSIZE_8;
+	rTrackOut->operands[1].asImm8 = (nodep::BYTE)addrOffset;
+	rTrackOut->opTypes[2] = RIVER_OPTYPE_IMM | RIVER_OPSIZE_8;
+	rTrackOut->operands[2].asImm8 = opSizes[RIVER_OPSIZE(opType)];
+	rTrackOut->opTypes[3] = RIVER_OPTYPE_NONE;
+	rTrackOut->TrackEspAsParameter();
+	rTrackOut->TrackUnusedRegisters();
+	rTrackOut++;
+	trackCount++;
+}
+
 /*= ADDRESS ==================================================================*/
 
 nodep::DWORD SymbopTranslator::SaveAddrValue(const RiverAddress &mem, RiverInstruction *&rMainOut, nodep::DWORD &instrCount) {
@@ -426,6 +458,37 @@ void SymbopTranslator::MakeCallSymbolic(const RiverInstruction &rIn, RiverInstru
 	trackCount++;
 }
 
+/* Stores the tracking stack layout next to the serialized instruction, so
+ * that the symbolic environment doesn't need to decode it at runtime. */
+void SymbopTranslator::SaveOperandLayout(const RiverInstruction &rIn, const nodep::DWORD *addressOffsets, const nodep::DWORD *inValueOffsets, const nodep::DWORD *outValueOffsets, nodep::DWORD inFlagOffset, nodep::DWORD outFlagOffset) {
+	RiverOperandLayout *layout = GetOperandLayout((RiverInstruction *)rIn.instructionAddress);
+
+	for (int i = 0; i < 4; ++i) {
+		layout->addressOffsets[i] = addressOffsets[i];
+		layout->baseOffsets[i] = layout->indexOffsets[i] = RIVER_LAYOUT_NO_OFFSET;
+		layout->inValueOffsets[i] = inValueOffsets[i];
+		layout->outValueOffsets[i] = outValueOffsets[i];
+
+		if (RIVER_LAYOUT_NO_OFFSET != addressOffsets[i]) {
+			// see SaveAddrValue: address, base, index
+			nodep::DWORD offset = addressOffsets[i] + 1;
+			if (rIn.operands[i].asAddress->type & RIVER_ADDR_BASE) {
+				layout->baseOffsets[i] = offset;
+				offset++;
+			}
+
+			if (rIn.operands[i].asAddress->type & RIVER_ADDR_INDEX) {
+				layout->indexOffsets[i] = offset;
+			}
+		}
+	}
+
+	layout->inFlagOffset = inFlagOffset;
+	layout->outFlagOffset = outFlagOffset;
+	layout->frameSize = trackedValues;
+	layout->flags = RIVER_LAYOUT_VALID;
+}
+
 void SymbopTranslator::TranslateUnk(const RiverInstruction &rIn, RiverInstruction *&rMainOut, nodep::DWORD &instrCount, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount, nodep::DWORD dwTranslationFlags) {
 	static nodep::BYTE lastOpcode;
 	static nodep::DWORD lastAddr;
@@ -434,7 +497,7 @@ void SymbopTranslator::TranslateUnk(const RiverInstruction &rIn, RiverInstructio
 	lastAddr = rIn.instructionAddress;
 	revtracerImports.dbgPrintFunc(PRINT_ERROR | PRINT_DISASSEMBLY, "Translating unknown instruction %02x %02x \n", rIn.modifiers & RIVER_MODIFIER_EXT ? 0x0F : 0x00, lastOpcode);
 
-	DEBUG_BREAK;
+	valid = false;
 }
 
 void SymbopTranslator::TranslateDefault(const RiverInstruction &rIn, RiverInstruction *&rMainOut, nodep::DWORD &instrCount, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount, nodep::DWORD dwTranslationFlags) {
@@ -480,6 +543,56 @@ void SymbopTranslator::TranslateDefault(const RiverInstruction &rIn, RiverInstru
 
 	if (dwTranslationFlags & TRACER_FEATURE_ADVANCED_TRACKING) {
 		MakeCallSymbolic(rIn, rMainOut, instrCount, rTrackOut, trackCount);
+		SaveOperandLayout(rIn, addressOffsets, inValueOffsets, outValueOffsets, inFlagOffset, outFlagOffset);
+	}
+
+	MakeCleanTrack(rTrackOut, trackCount);
+}
+
+/* SSE instructions have no symbolic counterpart. Under plain tracking the
+ * taint is propagated as usual, under advanced tracking the outputs are
+ * concretized instead: edi stays 0 and the register marks are forced, while
+ * memory outputs have their taint cleared by a forced range unmark. */
+void SymbopTranslator::TranslateSse(const RiverInstruction &rIn, RiverInstruction *&rMainOut, nodep::DWORD &instrCount, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount, nodep::DWORD dwTranslationFlags) {
+	nodep::DWORD addressOffsets[4] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+
+	if (0 == (dwTranslationFlags & TRACER_FEATURE_ADVANCED_TRACKING)) {
+		TranslateDefault(rIn, rMainOut, instrCount, rTrackOut, trackCount, dwTranslationFlags);
+		return;
+	}
+
+	MakeInitTrack(rIn, rTrackOut, trackCount);
+
+	for (int i = 3; i >= 0; --i) {
+		// segment relative destinations are not supported, the saved address has no segment base
+		if ((RIVER_SPEC_MODIFIES_OP(i) & rIn.specifiers) && (RIVER_OPTYPE_MEM == RIVER_OPTYPE(rIn.opTypes[i])) &&
+			(0 != rIn.operands[i].asAddress->type) && !rIn.operands[i].asAddress->HasSegment()) {
+			addressOffsets[i] = SaveAddrValue(*rIn.operands[i].asAddress, rMainOut, instrCount);
+		}
+	}
+
+	CopyInstruction(codegen, *rMainOut, rIn);
+	rMainOut++;
+	instrCount++;
+
+	for (int i = 3; i >= 0; --i) {
+		if (0 == (RIVER_SPEC_MODIFIES_OP(i) & rIn.specifiers)) {
+			continue;
+		}
+
+		const RiverRegister *reg = NULL;
+		if (RIVER_OPTYPE_REG == RIVER_OPTYPE(rIn.opTypes[i])) {
+			reg = &rIn.operands[i].asRegister;
+		} else if ((RIVER_OPTYPE_MEM == RIVER_OPTYPE(rIn.opTypes[i])) && (0 == rIn.operands[i].asAddress->type)) {
+			reg = &rIn.operands[i].asAddress->base;
+		}
+
+		if (NULL != reg) {
+			MakeMarkReg(*reg, rMainOut, instrCount, rTrackOut, trackCount);
+			rTrackOut[-1].subOpCode = RIVER_TRACK_MARK_FORCED;
+		} else if (0xFFFFFFFF != addressOffsets[i]) {
+			MakeUnmarkMem(*rIn.operands[i].asAddress, rIn.opTypes[i], addressOffsets[i], rTrackOut, trackCount);
+		}
 	}
 
 	MakeCleanTrack(rTrackOut, trackCount);
@@ -585,7 +698,7 @@ SymbopTranslator::TranslateOpcodeFunc SymbopTranslator::translateOpcodes[2][0x10
 
 		/* 0x20 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
 		/* 0x24 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0x28 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
+		/* 0x28 */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
 		/* 0x2C */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
 
 		/* 0x30 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateDefault, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
@@ -603,15 +716,15 @@ SymbopTranslator::TranslateOpcodeFunc SymbopTranslator::translateOpcodes[2][0x10
 		/* 0x58 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
 		/* 0x5C */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
 
-		/* 0x60 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0x64 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0x68 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0x6C */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
+		/* 0x60 */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateUnk,
+		/* 0x64 */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateUnk,
+		/* 0x68 */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateUnk,
+		/* 0x6C */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse,
 
-		/* 0x70 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0x74 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
+		/* 0x70 */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
+		/* 0x74 */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateUnk,
 		/* 0x78 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0x7C */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
+		/* 0x7C */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse,
 
 		/* 0x80 */ &SymbopTranslator::TranslateDefault, &SymbopTranslator::TranslateDefault, &SymbopTranslator::TranslateDefault, &SymbopTranslator::TranslateDefault,
 		/* 0x84 */ &SymbopTranslator::TranslateDefault, &SymbopTranslator::TranslateDefault, &SymbopTranslator::TranslateDefault, &SymbopTranslator::TranslateDefault,
@@ -639,18 +752,18 @@ SymbopTranslator::TranslateOpcodeFunc SymbopTranslator::translateOpcodes[2][0x10
 		/* 0xCC */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
 
 		/* 0xD0 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0xD4 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0xD8 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0xDC */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
+		/* 0xD4 */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateSse,
+		/* 0xD8 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse,
+		/* 0xDC */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse,
 
 		/* 0xE0 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0xE4 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0xE8 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0xEC */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
+		/* 0xE4 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateSse,
+		/* 0xE8 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateSse,
+		/* 0xEC */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateSse,
 
 		/* 0xF0 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
 		/* 0xF4 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0xF8 */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk,
-		/* 0xFC */ &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk, &SymbopTranslator::TranslateUnk
+		/* 0xF8 */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse,
+		/* 0xFC */ &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateSse, &SymbopTranslator::TranslateUnk
 	}
 };
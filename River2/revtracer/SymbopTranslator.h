@@ -31,6 +31,7 @@ private :
 	nodep::BYTE trackedValues;
 
 	RiverCodeGen *codegen;
+	bool valid; // cleared by the unknown opcodes
 
 	nodep::DWORD GetMemRepr(const RiverAddress &mem);
 
@@ -59,6 +60,7 @@ private :
 	nodep::DWORD SaveMemValue(bool ignoresMemory, const RiverAddress & mem, RiverInstruction *& rMainOut, nodep::DWORD & instrCount);
 	nodep::DWORD MakeTrackMem(bool ignoresValue, bool ignoresMemory, const RiverAddress & mem, RiverInstruction *& rMainOut, nodep::DWORD & instrCount, RiverInstruction *& rTrackOut, nodep::DWORD & trackCount);
 	nodep::DWORD MakeMarkMem(bool ignoresMemory, const RiverAddress & mem, RiverInstruction *& rMainOut, nodep::DWORD & instrCount, RiverInstruction *& rTrackOut, nodep::DWORD & trackCount);
+	void MakeUnmarkMem(const RiverAddress &mem, nodep::BYTE opType, nodep::DWORD addrOffset, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount);
 
 	nodep::DWORD SaveAddrValue(const RiverAddress &mem, RiverInstruction *&rMainOut, nodep::DWORD &instrCount);
 
@@ -76,10 +78,12 @@ private :
 	nodep::DWORD MakeMarkOp(const nodep::BYTE type, nodep::WORD specifiers, const RiverOperand &op, RiverInstruction *&rMainOut, nodep::DWORD &instrCount, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount);
 
 	void MakeCallSymbolic(const RiverInstruction &rIn, RiverInstruction *&rMainOut, nodep::DWORD &instrCount, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount);
+	void SaveOperandLayout(const RiverInstruction &rIn, const nodep::DWORD *addressOffsets, const nodep::DWORD *inValueOffsets, const nodep::DWORD *outValueOffsets, nodep::DWORD inFlagOffset, nodep::DWORD outFlagOffset);
 
 	/* Translators */
 	void TranslateUnk(const RiverInstruction &rIn, RiverInstruction *&rMainOut, nodep::DWORD &instrCount, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount, nodep::DWORD dwTranslationFlags);
 	void TranslateDefault(const RiverInstruction &rIn, RiverInstruction *&rMainOut, nodep::DWORD &instrCount, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount, nodep::DWORD dwTranslationFlags);
+	void TranslateSse(const RiverInstruction &rIn, RiverInstruction *&rMainOut, nodep::DWORD &instrCount, RiverInstruction *&rTrackOut, nodep::DWORD &trackCount, nodep::DWORD dwTranslationFlags);
 };
 
 
@@ -38,4 +38,48 @@ namespace rev {
 	}
 
 #endif
+
+	// bytes until the end of the 4KB page
+	static inline nodep::DWORD PageLeft(nodep::DWORD dwAddr) {
+		return 0x1000 - (dwAddr & 0xFFF);
+	}
+
+	void MarkAddrRange(void *pEnv, nodep::DWORD dwAddr, nodep::DWORD size, nodep::DWORD value) {
+		AddressContainer &ac = ((::ExecutionEnvironment *)pEnv)->ac;
+		nodep::DWORD dwEnd = dwAddr + size;
+
+		// the container is dword granular
+		for (nodep::DWORD dw = dwAddr & ~3; dw < dwEnd; dw += 4) {
+			if ((0 == value) && !ac.MayBeSet(dw)) {
+				dw = (dw & ~0xFFF) + 0x1000 - 4;
+				continue;
+			}
+
+			MarkAddr(pEnv, dw, value, 0);
+		}
+	}
+
+	void CopyAddrRange(void *pEnv, nodep::DWORD dwDest, nodep::DWORD dwSrc, nodep::DWORD size) {
+		AddressContainer &ac = ((::ExecutionEnvironment *)pEnv)->ac;
+
+		for (nodep::DWORD off = 0; off < size; ) {
+			nodep::DWORD dwDestCrt = dwDest + off;
+			nodep::DWORD dwSrcCrt = dwSrc + off;
+
+			// nothing to propagate nor to clear in either page
+			if (!ac.MayBeSet(dwSrcCrt) && !ac.MayBeSet(dwDestCrt)) {
+				nodep::DWORD skip = PageLeft(dwDestCrt);
+				if (PageLeft(dwSrcCrt) < skip) {
+					skip = PageLeft(dwSrcCrt);
+				}
+				off += skip;
+				continue;
+			}
+
+			MarkAddr(pEnv, dwDestCrt, ac.Get(dwSrcCrt), 0);
+
+			// advance to the next destination dword
+			off += 4 - (dwDestCrt & 3);
+		}
+	}
 };
@@ -9,6 +9,10 @@ namespace rev {
 
 	nodep::DWORD __stdcall TrackAddr(void *pEnv, nodep::DWORD dwAddr, nodep::DWORD segSel);
 	nodep::DWORD __stdcall MarkAddr(void *pEnv, nodep::DWORD dwAddr, nodep::DWORD value, nodep::DWORD segSel);
+
+	/* range variants used by the bulk rep handler, the ranges must not overlap */
+	void MarkAddrRange(void *pEnv, nodep::DWORD dwAddr, nodep::DWORD size, nodep::DWORD value);
+	void CopyAddrRange(void *pEnv, nodep::DWORD dwDest, nodep::DWORD dwSrc, nodep::DWORD size);
 		
 };
 
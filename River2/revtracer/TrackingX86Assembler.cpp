@@ -2,12 +2,16 @@
 
 #include "X86AssemblerFuncs.h"
 #include "mm.h"
+#include "OperandLayout.h"
 
 using namespace rev;
 
 extern nodep::DWORD dwAddressTrackHandler;
 extern nodep::DWORD dwAddressMarkHandler;
+extern nodep::DWORD dwAddressUnmarkHandler;
+extern nodep::DWORD dwRegisterMarkHandler;
 extern nodep::DWORD dwSymbolicHandler;
+extern nodep::DWORD dwSymbolicFlushHandler;
 
 void TrackingX86Assembler::AssembleTrackFlag(nodep::DWORD testFlags, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
 	const nodep::BYTE trackFlagInstr[] = { 0x0B, 0x3D, 0x00, 0x00, 0x00, 0x00 };
@@ -43,7 +47,7 @@ void TrackingX86Assembler::AssembleTrackRegister(const RiverRegister &reg, Reloc
 	const nodep::BYTE trackRegInstr[] = { 0x0B, 0x3D, 0x00, 0x00, 0x00, 0x00 };
 
 	rev_memcpy(px86.cursor, trackRegInstr, sizeof(trackRegInstr));
-	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)&runtime->taintedRegisters[GetFundamentalRegister(reg.name)];
+	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)runtime->GetTaintedRegister(reg.name);
 	px86.cursor += sizeof(trackRegInstr);
 	instrCounter++;
 }
@@ -54,11 +58,27 @@ void TrackingX86Assembler::AssembleMarkRegister(const RiverRegister &reg, Reloca
 	const nodep::BYTE markRegInstr[] = { 0x89, 0x3D, 0x00, 0x00, 0x00, 0x00 };
 
 	rev_memcpy(px86.cursor, markRegInstr, sizeof(markRegInstr));
-	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)&runtime->taintedRegisters[GetFundamentalRegister(reg.name)];
+	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)runtime->GetTaintedRegister(reg.name);
 	px86.cursor += sizeof(markRegInstr);
 	instrCounter++;
 }
 
+void TrackingX86Assembler::AssembleForcedMarkRegister(const RiverRegister &reg, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
+	const nodep::BYTE markRegInstr[] = {
+		0x57,											// 0x00 - push edi - new value
+		0x68, 0x00, 0x00, 0x00, 0x00,					// 0x01 - push taint slot
+		0x68, 0x00, 0x00, 0x00, 0x00,					// 0x06 - push runtimeContext (or env)
+		0xFF, 0x15, 0x00, 0x00, 0x00, 0x00				// 0x0B - call [dwRegisterMarkHandler]
+	};
+
+	rev_memcpy(px86.cursor, markRegInstr, sizeof(markRegInstr));
+	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)runtime->GetTaintedRegister(reg.name);
+	*(nodep::DWORD *)(&px86.cursor[0x07]) = (nodep::DWORD)runtime;
+	*(nodep::DWORD *)(&px86.cursor[0x0D]) = (nodep::DWORD)&dwRegisterMarkHandler;
+	px86.cursor += sizeof(markRegInstr);
+	instrCounter += 4;
+}
+
 void TrackingX86Assembler::AssembleTrackMemory(const RiverAddress *addr, nodep::BYTE offset, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
 	const nodep::BYTE trackMemInstr[] = {
 		0xFF, 0x76, 0x00,								// 0x00 - push [esi + 0x00] - effective address
@@ -136,6 +156,23 @@ void TrackingX86Assembler::AssembleMarkMemory(const RiverAddress *addr, nodep::B
 	instrCounter += 4;
 }
 
+void TrackingX86Assembler::AssembleUnmarkMemory(nodep::BYTE offset, nodep::BYTE size, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
+	const nodep::BYTE unmarkMemInstr[] = {
+		0x6A, 0x00,										// 0x00 - push size
+		0xFF, 0x76, 0x00,								// 0x02 - push [esi - offset] - effective address
+		0x68, 0x00, 0x00, 0x00, 0x00,					// 0x05	- push runtimeContext (or env)
+		0xFF, 0x15, 0x00, 0x00, 0x00, 0x00				// 0x0A - call [dwAddressUnmarkHandler]
+	};
+
+	rev_memcpy(px86.cursor, unmarkMemInstr, sizeof(unmarkMemInstr));
+	*(nodep::BYTE *)(&px86.cursor[0x01]) = size;
+	*(nodep::BYTE *)(&px86.cursor[0x04]) = (nodep::BYTE)(~(offset << 2) + 1);
+	*(nodep::DWORD *)(&px86.cursor[0x06]) = (nodep::DWORD)runtime;
+	*(nodep::DWORD *)(&px86.cursor[0x0C]) = (nodep::DWORD)&dwAddressUnmarkHandler;
+	px86.cursor += sizeof(unmarkMemInstr);
+	instrCounter += 4;
+}
+
 void TrackingX86Assembler::AssembleAdjustESI(nodep::BYTE count, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
 	const nodep::BYTE adjustESI[] = {
 		0x8D, 0x76, 0x00
@@ -188,7 +225,89 @@ void TrackingX86Assembler::AssembleUnmark(RelocableCodeBuffer &px86, nodep::DWOR
 	instrCounter += 3;
 }
 
+void TrackingX86Assembler::AssembleSymbolicRecord(nodep::DWORD address, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
+	// the frame size is known at translation time (see SymbopTranslator::SaveOperandLayout)
+	nodep::DWORD count = GetOperandLayout((RiverInstruction *)address)->frameSize;
+	nodep::DWORD recordSize = sizeof(SymbolicStreamRecord) / sizeof(nodep::DWORD) + count;
+
+	// The taint is only updated when the stream is consumed. An instruction
+	// with untainted operands can be skipped only if no records are pending,
+	// otherwise its operands may be tainted by one of them.
+	const nodep::BYTE symRecord[] = {
+		0x75, 0x0D,										// 0x00 - jnz <record>
+		0x83, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,		// 0x02 - cmp [symbolicStreamPos], 0
+		0x0F, 0x84, 0x00, 0x00, 0x00, 0x00,				// 0x09 - jz <over_this_block>
+		0x8B, 0x15, 0x00, 0x00, 0x00, 0x00,				// 0x0F - mov edx, [symbolicStreamPos]
+		0x81, 0xFA, 0x00, 0x00, 0x00, 0x00,				// 0x15 - cmp edx, SYMBOLIC_STREAM_SIZE - recordSize
+		0x76, 0x0D,										// 0x1B - jbe <fits>
+		0x68, 0x00, 0x00, 0x00, 0x00,					// 0x1D	- push runtimeContext (or env)
+		0xFF, 0x15, 0x00, 0x00, 0x00, 0x00,				// 0x22 - call [dwSymbolicFlushHandler]
+		0x31, 0xD2,										// 0x28 - xor edx, edx
+		0xA1, 0x00, 0x00, 0x00, 0x00,					// 0x2A - mov eax, [symbolicStream]
+		0x8D, 0x04, 0x90,								// 0x2F - lea eax, [eax + 4 * edx]
+		0xC7, 0x00, 0x00, 0x00, 0x00, 0x00,				// 0x32 - mov [eax], instructionAddress
+		0xC7, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00		// 0x38 - mov [eax + 4], count
+	};
+
+	// the frame grows downwards from the tracking pointer, it is copied lowest address first
+	const nodep::BYTE copyValue[] = {
+		0x8B, 0x96, 0x00, 0x00, 0x00, 0x00,				// 0x00 - mov edx, [esi + value]
+		0x89, 0x90, 0x00, 0x00, 0x00, 0x00				// 0x06 - mov [eax + record], edx
+	};
+
+	const nodep::BYTE symCommit[] = {
+		0x81, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00	// 0x00 - add [symbolicStreamPos], recordSize
+	};
+
+	rev_memcpy(px86.cursor, symRecord, sizeof(symRecord));
+	*(nodep::DWORD *)(&px86.cursor[0x04]) = (nodep::DWORD)&runtime->symbolicStreamPos;
+	*(nodep::DWORD *)(&px86.cursor[0x0B]) = count * sizeof(copyValue) + sizeof(symCommit) + sizeof(symRecord) - 0x0F;
+	*(nodep::DWORD *)(&px86.cursor[0x11]) = (nodep::DWORD)&runtime->symbolicStreamPos;
+	*(nodep::DWORD *)(&px86.cursor[0x17]) = SYMBOLIC_STREAM_SIZE - recordSize;
+	*(nodep::DWORD *)(&px86.cursor[0x1E]) = (nodep::DWORD)runtime;
+	*(nodep::DWORD *)(&px86.cursor[0x24]) = (nodep::DWORD)&dwSymbolicFlushHandler;
+	*(nodep::DWORD *)(&px86.cursor[0x2B]) = (nodep::DWORD)&runtime->symbolicStream;
+	*(nodep::DWORD *)(&px86.cursor[0x34]) = address;
+	*(nodep::DWORD *)(&px86.cursor[0x3B]) = count;
+	px86.cursor += sizeof(symRecord);
+	instrCounter += 13;
+
+	for (nodep::DWORD i = 0; i < count; ++i) {
+		rev_memcpy(px86.cursor, copyValue, sizeof(copyValue));
+		*(nodep::DWORD *)(&px86.cursor[0x02]) = (i + 1 - count) * sizeof(nodep::DWORD);
+		*(nodep::DWORD *)(&px86.cursor[0x08]) = sizeof(SymbolicStreamRecord) + i * sizeof(nodep::DWORD);
+		px86.cursor += sizeof(copyValue);
+		instrCounter += 2;
+	}
+
+	rev_memcpy(px86.cursor, symCommit, sizeof(symCommit));
+	*(nodep::DWORD *)(&px86.cursor[0x02]) = (nodep::DWORD)&runtime->symbolicStreamPos;
+	*(nodep::DWORD *)(&px86.cursor[0x06]) = recordSize;
+	px86.cursor += sizeof(symCommit);
+	instrCounter += 1;
+}
+
+void TrackingX86Assembler::AssembleSymbolicFlush(RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
+	// the pending records must be replayed before the taint state is
+	// changed outside of the symbolic environment
+	const nodep::BYTE symFlush[] = {
+		0x68, 0x00, 0x00, 0x00, 0x00,					// 0x00	- push runtimeContext (or env)
+		0xFF, 0x15, 0x00, 0x00, 0x00, 0x00				// 0x05 - call [dwSymbolicFlushHandler]
+	};
+
+	rev_memcpy(px86.cursor, symFlush, sizeof(symFlush));
+	*(nodep::DWORD *)(&px86.cursor[0x01]) = (nodep::DWORD)runtime;
+	*(nodep::DWORD *)(&px86.cursor[0x07]) = (nodep::DWORD)&dwSymbolicFlushHandler;
+	px86.cursor += sizeof(symFlush);
+	instrCounter += 2;
+}
+
 void TrackingX86Assembler::AssembleSymbolicCall(nodep::DWORD address, nodep::BYTE index, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::DWORD &instrCounter) {
+	if (TRACER_FEATURE_SYMBOLIC_STREAM & dwTranslationFlags) {
+		AssembleSymbolicRecord(address, px86, pFlags, instrCounter);
+		return;
+	}
+
 	const nodep::BYTE symCall[] = {
 		0x74, 0x11,										// 0x00 - jz <over_this_block>
 		0x68, 0x00, 0x00, 0x00, 0x00,					// 0x02 - push instructionAddress
@@ -218,8 +337,15 @@ bool TrackingX86Assembler::Translate(const RiverInstruction &ri, RelocableCodeBu
 
 			case 0x58 :
 				if (0 == (TRACER_FEATURE_ADVANCED_TRACKING & dwTranslationFlags)) {
+					if (TRACER_FEATURE_SYMBOLIC_STREAM & dwTranslationFlags) {
+						AssembleSymbolicFlush(px86, pFlags, instrCounter);
+					}
 					AssembleMarkRegister(ri.operands[0].asRegister, px86, pFlags, instrCounter);
 				}
+				else if (RIVER_TRACK_MARK_FORCED == ri.subOpCode) {
+					// the slot holds an expression, the handler flushes the stream and releases it
+					AssembleForcedMarkRegister(ri.operands[0].asRegister, px86, pFlags, instrCounter);
+				}
 				break;
 
 			case 0x8D :
@@ -227,7 +353,13 @@ bool TrackingX86Assembler::Translate(const RiverInstruction &ri, RelocableCodeBu
 				break;
 
 			case 0x8F :
-				if (ASSEMBLER_DIR_BACKWARD & outputType) {
+				if (RIVER_TRACK_MARK_FORCED == ri.subOpCode) {
+					// concretization, there is no previous taint to restore
+					if (0 == (ASSEMBLER_DIR_BACKWARD & outputType)) {
+						AssembleUnmarkMemory(ri.operands[1].asImm8, ri.operands[2].asImm8, px86, pFlags, instrCounter);
+					}
+				}
+				else if (ASSEMBLER_DIR_BACKWARD & outputType) {
 					AssembleUnmark(px86, pFlags, instrCounter);
 				}
 				else {
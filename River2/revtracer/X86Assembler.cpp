@@ -154,10 +154,7 @@ bool X86Assembler::TranslateNative(const RiverInstruction &ri, RelocableCodeBuff
 		DEBUG_BREAK;
 	}
 
-	casm->Translate(*rOut, px86, pFlags, currentFamily, repReg, instrCounter, outputType);
-
-
-	return true;
+	return casm->Translate(*rOut, px86, pFlags, currentFamily, repReg, instrCounter, outputType);
 }
 
 bool X86Assembler::TranslateTracking(const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::DWORD &pFlags, nodep::BYTE &currentFamily, nodep::BYTE &repReg, nodep::DWORD &instrCounter, nodep::BYTE outputType) {
@@ -178,9 +175,7 @@ bool X86Assembler::TranslateTracking(const RiverInstruction &ri, RelocableCodeBu
 		DEBUG_BREAK;
 	}
 	
-	casm->Translate(ri, px86, pFlags, currentFamily, repReg, instrCounter, outputType);
-
-	return true;
+	return casm->Translate(ri, px86, pFlags, currentFamily, repReg, instrCounter, outputType);
 }
 
 void X86Assembler::AssembleTrackingEnter(RelocableCodeBuffer &px86, nodep::DWORD &instrCounter) {
@@ -219,6 +214,7 @@ bool X86Assembler::Assemble(RiverInstruction *pRiver, nodep::DWORD dwInstrCount,
 	nodep::BYTE currentFamily = (outputType & ASSEMBLER_CODE_TRACKING) ? RIVER_FAMILY_TRACK : RIVER_FAMILY_NATIVE;
 	nodep::BYTE repReg = 0;
 
+#ifdef ENABLE_DEBUG_TRANSLATIONS
 	static const char headers[][35] = {
 		" river to x86 (native forward) ===",
 		" river to x86 (native backward) ==",
@@ -234,6 +230,7 @@ bool X86Assembler::Assemble(RiverInstruction *pRiver, nodep::DWORD dwInstrCount,
 	};
 
 	nodep::DWORD printMask = PRINT_INFO | PRINT_ASSEMBLY | masks[outputType];
+#endif
 
 	TRANSLATE_PRINT(printMask, "=%s============================================\n", headers[outputType]);
 
@@ -258,6 +255,10 @@ bool X86Assembler::Assemble(RiverInstruction *pRiver, nodep::DWORD dwInstrCount,
 			}
 		}
 
+		if (px86.Failed()) {
+			return false;
+		}
+
 		// some instructions (repinit/repfini) are fixed after
 		// this print so the jump offsets could be 00 00 00 00
 		//  in logs.
@@ -24,7 +24,10 @@ void AssemblePlusRegInstr(const RiverInstruction &ri, RelocableCodeBuffer &px86,
 /* =========================================== */
 
 void AssembleModRMOp(unsigned int opIdx, const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::BYTE extra) {
-	ri.operands[opIdx].asAddress->EncodeTox86(px86.cursor, extra, ri.family, ri.modifiers);
+	// xmm register names keep their class in the upper bits
+	if (!ri.operands[opIdx].asAddress->EncodeTox86(px86.cursor, extra & 0x07, ri.family, ri.modifiers)) {
+		px86.MarkFailed();
+	}
 }
 
 void AssembleImmOp(unsigned int opIdx, const RiverInstruction &ri, RelocableCodeBuffer &px86, nodep::BYTE immSize) {
@@ -23,6 +23,57 @@ using namespace nodep;
 DWORD dwAddressTrackHandler = (DWORD)&rev::TrackAddr;
 DWORD dwAddressMarkHandler = (DWORD)&rev::MarkAddr;
 
+/* The records are written inline by the tracking code (see
+ * TrackingX86Assembler::AssembleSymbolicRecord) and handed over when the
+ * basic block ends. */
+void FlushSymbolicStream(ExecutionEnvironment *pEnv) {
+	if (0 == pEnv->runtimeContext.symbolicStreamPos) {
+		return;
+	}
+
+	revtracerImports.symbolicStreamHandler(pEnv, pEnv->runtimeContext.symbolicStream, pEnv->runtimeContext.symbolicStreamPos * sizeof(DWORD));
+	pEnv->runtimeContext.symbolicStreamPos = 0;
+}
+
+/* Called by the tracking code when the stream buffer is full and before it
+ * changes the taint state itself (forced register marks). The records are
+ * replayed against the live taint state, so the ones emitted before the
+ * change must be consumed first. */
+void __stdcall FlushSymbolic(void *context) {
+	FlushSymbolicStream((ExecutionEnvironment *)context);
+}
+
+DWORD dwSymbolicFlushHandler = (DWORD)&FlushSymbolic;
+
+/* Forced memory unmark, used to concretize the memory outputs of
+ * instructions that have no symbolic semantics. */
+void __stdcall UnmarkAddr(void *context, DWORD dwAddr, DWORD size) {
+	ExecutionEnvironment *pEnv = (ExecutionEnvironment *)context;
+
+	FlushSymbolicStream(pEnv);
+	rev::MarkAddrRange(pEnv, dwAddr, size, 0);
+}
+
+DWORD dwAddressUnmarkHandler = (DWORD)&UnmarkAddr;
+
+/* Forced register mark under advanced tracking. The slot holds an expression
+ * reference, the replaced one is released once the pending records that may
+ * still use it have been flushed. */
+void __stdcall MarkRegForced(void *context, DWORD *slot, DWORD value) {
+	ExecutionEnvironment *pEnv = (ExecutionEnvironment *)context;
+	DWORD old;
+
+	FlushSymbolicStream(pEnv);
+	old = *slot;
+	*slot = value;
+
+	if ((0 != old) && (old != value) && (NULL != pEnv->runtimeContext.releaseTaint)) {
+		pEnv->runtimeContext.releaseTaint((void *)old);
+	}
+}
+
+DWORD dwRegisterMarkHandler = (DWORD)&MarkRegForced;
+
 void RiverPrintInstruction(DWORD printMask, RiverInstruction *ri);
 void DirectionHandler(DWORD dwDirection, ExecutionEnvironment *pEnv, ADDR_TYPE addr);
 
@@ -50,6 +101,65 @@ extern "C" {
 		pEnv->runtimeContext.execBuff = pEnv->executionBase;
 	}
 
+	/* The branch handler calls into user code that may clobber the xmm
+	 * registers, thus they are saved on entry and restored on exit. The
+	 * saved copy is also what GetCurrentXmmRegisters reports. */
+	void SaveXmmRegisters(XmmRegister *xmm) {
+#ifdef _MSC_VER
+		__asm {
+			mov eax, xmm;
+			movdqu [eax + 0x00], xmm0;
+			movdqu [eax + 0x10], xmm1;
+			movdqu [eax + 0x20], xmm2;
+			movdqu [eax + 0x30], xmm3;
+			movdqu [eax + 0x40], xmm4;
+			movdqu [eax + 0x50], xmm5;
+			movdqu [eax + 0x60], xmm6;
+			movdqu [eax + 0x70], xmm7;
+		}
+#else
+		asm volatile(
+			"movdqu %%xmm0, 0x00(%0)\n\t"
+			"movdqu %%xmm1, 0x10(%0)\n\t"
+			"movdqu %%xmm2, 0x20(%0)\n\t"
+			"movdqu %%xmm3, 0x30(%0)\n\t"
+			"movdqu %%xmm4, 0x40(%0)\n\t"
+			"movdqu %%xmm5, 0x50(%0)\n\t"
+			"movdqu %%xmm6, 0x60(%0)\n\t"
+			"movdqu %%xmm7, 0x70(%0)\n\t"
+			: : "r" (xmm) : "memory"
+		);
+#endif
+	}
+
+	void RestoreXmmRegisters(const XmmRegister *xmm) {
+#ifdef _MSC_VER
+		__asm {
+			mov eax, xmm;
+			movdqu xmm0, [eax + 0x00];
+			movdqu xmm1, [eax + 0x10];
+			movdqu xmm2, [eax + 0x20];
+			movdqu xmm3, [eax + 0x30];
+			movdqu xmm4, [eax + 0x40];
+			movdqu xmm5, [eax + 0x50];
+			movdqu xmm6, [eax + 0x60];
+			movdqu xmm7, [eax + 0x70];
+		}
+#else
+		asm volatile(
+			"movdqu 0x00(%0), %%xmm0\n\t"
+			"movdqu 0x10(%0), %%xmm1\n\t"
+			"movdqu 0x20(%0), %%xmm2\n\t"
+			"movdqu 0x30(%0), %%xmm3\n\t"
+			"movdqu 0x40(%0), %%xmm4\n\t"
+			"movdqu 0x50(%0), %%xmm5\n\t"
+			"movdqu 0x60(%0), %%xmm6\n\t"
+			"movdqu 0x70(%0), %%xmm7\n\t"
+			: : "r" (xmm) : "memory"
+		);
+#endif
+	}
+
 	typedef DWORD (*NtTerminateProcessFunc)(
 		DWORD ProcessHandle,
 		DWORD ExitStatus
@@ -60,14 +170,20 @@ extern "C" {
 		//ExecutionRegs *currentRegs = (ExecutionRegs *)((&a) + 1);
 		pEnv->runtimeContext.registers = (UINT_PTR)((&a) + 1);
 		pEnv->runtimeContext.trackBuff = pEnv->runtimeContext.trackBase;
+		SaveXmmRegisters(pEnv->runtimeContext.xmmRegisters);
+
+		// hand over the symbolic records of the block that just ended
+		FlushSymbolicStream(pEnv);
 
 		if (pEnv->bForward) {
 			PushToExecutionBuffer(pEnv, pEnv->lastFwBlock);
 		}
 
 
+#ifdef ENABLE_DEBUG_BRANCHING
 		DWORD *stk = (DWORD *)pEnv->runtimeContext.virtualStack;
 		DWORD esp = pEnv->runtimeContext.virtualStack;
+#endif
 		BRANCHING_PRINT(PRINT_BRANCHING_DEBUG, "EIP: 0x%08x Stack addr: %p stk: %p\n", a, &(pEnv->runtimeContext.virtualStack), stk);
 		BRANCHING_PRINT(PRINT_BRANCHING_DEBUG, "0x%08x: 0x%08x 0x%08x 0x%08x 0x%08x\n", stk + 0x00, stk[0], stk[1], stk[2], stk[3]);
 		BRANCHING_PRINT(PRINT_BRANCHING_DEBUG, "EAX: 0x%08x  ECX: 0x%08x  EDX: 0x%08x  EBX: 0x%08x\n",
@@ -85,6 +201,7 @@ extern "C" {
 
 		DWORD dwDirection = revtracerImports.branchHandler(pEnv, pEnv->userContext, a);
 		DirectionHandler(dwDirection, pEnv, a);
+		RestoreXmmRegisters(pEnv->runtimeContext.xmmRegisters);
 	}
 
 	void __stdcall SysHandler(struct ExecutionEnvironment *pEnv) {
@@ -92,6 +209,174 @@ extern "C" {
 	}
 };
 
+#define BULK_REP_RESERVE				0x1000 // execution buffer space left for the regular rep loop
+
+/* Bulk rep handler (TRACER_FEATURE_BULK_REP). Performs the iterations of a
+ * rep movs/stos over the registers saved by the repbulk code. The regular
+ * rep loop that follows handles whatever is left, thus the handler may
+ * stop early (overlapping ranges, not enough room in the execution buffer).
+ * In reversible mode the overwritten range is pushed on the execution buffer
+ * together with the initial registers and restored by the repundo code. */
+void __stdcall BulkRepHandler(void *context, ExecutionRegs *regs, DWORD descriptor) {
+	ExecutionEnvironment *pEnv = (ExecutionEnvironment *)context;
+
+	if (RIVER_REP_BULK_UNDO == (descriptor >> 16)) {
+		regs->ecx = PopFromExecutionBuffer(pEnv);
+		regs->edi = PopFromExecutionBuffer(pEnv);
+		regs->esi = PopFromExecutionBuffer(pEnv);
+		DWORD size = PopFromExecutionBuffer(pEnv);
+		DWORD lo = PopFromExecutionBuffer(pEnv);
+
+		rev_memcpy((void *)lo, (void *)pEnv->runtimeContext.execBuff, size);
+		pEnv->runtimeContext.execBuff += (size + 3) & ~3;
+		return;
+	}
+
+	BYTE opCode = (BYTE)descriptor;
+	DWORD elemSize = (0 == (opCode & 1)) ? 1 : ((descriptor & RIVER_REP_BULK_O16) ? 2 : 4);
+	int step = (regs->eflags & 0x400) ? -(int)elemSize : (int)elemSize; // DF
+	DWORD count = regs->ecx;
+
+	if (TRACER_FEATURE_REVERSIBLE & pEnv->generationFlags) {
+		DWORD room = pEnv->runtimeContext.execBuff - (DWORD)pEnv->executionBuffer;
+		room = (room > BULK_REP_RESERVE) ? (room - BULK_REP_RESERVE) / elemSize : 0;
+		if (count > room) {
+			count = room;
+		}
+	}
+
+	DWORD size = count * elemSize;
+	DWORD lo = (step < 0) ? regs->edi + elemSize - size : regs->edi;
+	DWORD srcLo = (step < 0) ? regs->esi + elemSize - size : regs->esi;
+
+	// overlapping copies replicate data, leave them to the regular loop
+	if ((0xA4 == (opCode & ~1)) && (srcLo < lo + size) && (lo < srcLo + size)) {
+		count = size = 0;
+	}
+
+	if (TRACER_FEATURE_REVERSIBLE & pEnv->generationFlags) {
+		pEnv->runtimeContext.execBuff -= (size + 3) & ~3;
+		rev_memcpy((void *)pEnv->runtimeContext.execBuff, (void *)lo, size);
+
+		PushToExecutionBuffer(pEnv, lo);
+		PushToExecutionBuffer(pEnv, size);
+		PushToExecutionBuffer(pEnv, regs->esi);
+		PushToExecutionBuffer(pEnv, regs->edi);
+		PushToExecutionBuffer(pEnv, regs->ecx);
+	}
+
+	if (0 == count) {
+		return;
+	}
+
+	// the taint is changed below, replay the pending symbolic records first
+	FlushSymbolicStream(pEnv);
+
+	if (0xA4 == (opCode & ~1)) {
+		rev_memcpy((void *)lo, (void *)srcLo, size);
+
+		if (TRACER_FEATURE_TRACKING & pEnv->generationFlags) {
+			rev::CopyAddrRange(pEnv, lo, srcLo, size);
+		}
+
+		regs->esi += step * count;
+	} else {
+		switch (elemSize) {
+			case 1 :
+				rev_memset((void *)lo, (BYTE)regs->eax, size);
+				break;
+			case 2 :
+				for (DWORD i = 0; i < count; ++i) {
+					((WORD *)lo)[i] = (WORD)regs->eax;
+				}
+				break;
+			case 4 :
+				for (DWORD i = 0; i < count; ++i) {
+					((DWORD *)lo)[i] = regs->eax;
+				}
+				break;
+		}
+
+		if (TRACER_FEATURE_TRACKING & pEnv->generationFlags) {
+			rev::MarkAddrRange(pEnv, lo, size, pEnv->runtimeContext.taintedRegisters[RIVER_REG_xAX]);
+		}
+	}
+
+	regs->edi += step * count;
+	regs->ecx -= count;
+}
+
+DWORD dwBulkRepHandler = (DWORD)&BulkRepHandler;
+
+/* Superblocks (TRACER_FEATURE_SUPERBLOCK). Every block counts the transitions
+ * towards its two static successors. When a block reaches
+ * RIVER_SUPERBLOCK_THRESHOLD executions, the chain of its most frequent
+ * successors is translated as a single superblock, headed by this block. */
+void ProfileSuccessor(ExecutionEnvironment *pEnv, UINT_PTR nextInstruction) {
+	RiverBasicBlock *pLast = pEnv->lastFwProfile;
+
+	if (NULL == pLast) {
+		return;
+	}
+
+	for (int i = 0; i < 2; ++i) {
+		if (pLast->pBranchNext[i].address == nextInstruction) {
+			pLast->dwSuccPasses[i]++;
+			break;
+		}
+	}
+}
+
+void BuildSuperblock(ExecutionEnvironment *pEnv, RiverBasicBlock *pCB) {
+	RiverBasicBlock *pChain[RIVER_SUPERBLOCK_MAX_BLOCKS];
+	DWORD dwCount = 0;
+	RiverBasicBlock *pCrt = pCB;
+
+	while (dwCount < RIVER_SUPERBLOCK_MAX_BLOCKS) {
+		pChain[dwCount] = pCrt;
+		dwCount++;
+
+		if ((RIVER_JUMP_TYPE_IMM != pCrt->dwBranchType) ||
+			((RIVER_JUMP_INSTR_JMP != pCrt->dwBranchInstruction) && (RIVER_JUMP_INSTR_JXX != pCrt->dwBranchInstruction))) {
+			break;
+		}
+
+		// follow the successor that got at least half of the executions
+		int succ = (pCrt->dwSuccPasses[1] > pCrt->dwSuccPasses[0]) ? 1 : 0;
+		if ((0 == pCrt->pBranchNext[succ].address) || ((pCrt->dwSuccPasses[succ] << 1) < pCrt->dwFwPasses)) {
+			break;
+		}
+
+		RiverBasicBlock *pNext = pEnv->blockCache.FindBlock(pCrt->pBranchNext[succ].address);
+		if ((NULL == pNext) || (RIVER_BASIC_BLOCK_DETOUR & pNext->dwFlags)) {
+			break;
+		}
+
+		bool bLoop = false;
+		for (DWORD i = 0; i < dwCount; ++i) {
+			bLoop |= (pChain[i] == pNext);
+		}
+
+		if (bLoop) {
+			break;
+		}
+
+		pCrt = pNext;
+	}
+
+	if (dwCount < 2) {
+		return;
+	}
+
+	RevtracerError rerror;
+	if (!pEnv->codeGen.TranslateSuperblock(pCB, pChain, dwCount, pEnv->generationFlags, &rerror)) {
+		pEnv->blockCache.DropSuperblock(pCB);
+		return;
+	}
+
+	TRANSLATE_PRINT(PRINT_BRANCHING_INFO, "Superblock %08X, %d blocks\n", pCB->address, pCB->dwSbCount);
+}
+
 template<DWORD Direction>
 bool ProcessDirection(ExecutionEnvironment *pEnv, ADDR_TYPE nextInstruction);
 
@@ -109,20 +394,21 @@ bool ProcessDirection<EXECUTION_TERMINATE>(ExecutionEnvironment *pEnv, ADDR_TYPE
 
 template<>
 bool ProcessDirection<EXECUTION_RESTART>(ExecutionEnvironment *pEnv, ADDR_TYPE nextInstruction) {
-	BRANCHING_PRINT(PRINT_BRANCHING_INFO, "RESTART Requested\n", revtracerConfig.entryPoint);
+	BRANCHING_PRINT(PRINT_BRANCHING_INFO, "RESTART Requested\n", pEnv->entryPoint);
 	pEnv->lastFwBlock = 0;
+	pEnv->lastFwProfile = NULL;
 	ClearExecutionBuffer(pEnv);
 
 	pEnv->runtimeContext.registers = (UINT_PTR)((&nextInstruction) + 1);
 
 	// need to push the return address again
-	DWORD nextDirection = revtracerImports.branchHandler(pEnv, pEnv->userContext, revtracerConfig.entryPoint);
+	DWORD nextDirection = revtracerImports.branchHandler(pEnv, pEnv->userContext, pEnv->entryPoint);
 	if (nextDirection == EXECUTION_ADVANCE) {
 		pEnv->runtimeContext.virtualStack -= 4;
 		*((ADDR_TYPE *)pEnv->runtimeContext.virtualStack) = nextInstruction;
-		pEnv->lastFwBlock = (UINT_PTR)revtracerConfig.entryPoint;
+		pEnv->lastFwBlock = (UINT_PTR)pEnv->entryPoint;
 		pEnv->bForward = 1;
-		DirectionHandler(nextDirection, pEnv, revtracerConfig.entryPoint);
+		DirectionHandler(nextDirection, pEnv, pEnv->entryPoint);
 	} else {
 		pEnv->runtimeContext.jumpBuff = (UINT_PTR)revtracerImports.lowLevel.ntTerminateProcess;
 	}
@@ -170,12 +456,35 @@ bool ProcessDirection<EXECUTION_ADVANCE>(ExecutionEnvironment *pEnv, ADDR_TYPE n
 			}
 			TRANSLATE_PRINT(PRINT_BRANCHING_INFO, "===============================================================================\n");
 		}
+
+		if (NULL != pEnv->speculative) {
+			pEnv->speculative->Enqueue(pCB);
+		}
 	}
 	pCB->MarkForward();
 	pEnv->lastFwBlock = pCB->address;
 	pEnv->bForward = 1;
 
 	pEnv->runtimeContext.jumpBuff = (DWORD)pCB->pFwCode;
+
+	if (TRACER_FEATURE_SUPERBLOCK & pEnv->generationFlags) {
+		ProfileSuccessor(pEnv, (UINT_PTR)nextInstruction);
+		pEnv->lastFwProfile = pCB;
+
+		if ((NULL == pCB->pSbCode) && (RIVER_SUPERBLOCK_THRESHOLD == pCB->dwFwPasses)) {
+			BuildSuperblock(pEnv, pCB);
+		}
+
+		if (NULL != pCB->pSbCode) {
+			if (pEnv->blockCache.CheckSuperblock(pCB)) {
+				// the exit of a superblock says nothing about the successors of its head
+				pEnv->lastFwProfile = NULL;
+				pEnv->runtimeContext.jumpBuff = (DWORD)pCB->pSbCode;
+			} else {
+				pEnv->blockCache.DropSuperblock(pCB);
+			}
+		}
+	}
 	return true;
 }
 
@@ -194,6 +503,11 @@ bool ProcessDirection<EXECUTION_BACKTRACK>(ExecutionEnvironment *pEnv, ADDR_TYPE
 		pCB->MarkBackward();
 		//pEnv->posHist -= 1;
 
+		if (!pEnv->codeGen.TranslateBackward(pCB)) {
+			revtracerImports.dbgPrintFunc(PRINT_BRANCHING_ERROR, "No reverse code for block %08X!", addr);
+			return false;
+		}
+
 		pEnv->bForward = 0;
 		pEnv->runtimeContext.jumpBuff = (DWORD)pCB->pBkCode;
 	}
@@ -48,16 +48,19 @@ RiverBasicBlock *RiverBasicBlockCache::NewBlock(nodep::UINT_PTR a) {
 	rev_memset(pNew, 0, sizeof(*pNew));
 	pNew->address = a;
 
-	//cbLock.Lock();
-
-	nodep::DWORD dwHash = HashFunc(logHashSize, pNew->address); // & 0xFFFF;
-
-	pNew->pNext = hashTable[dwHash];
-	hashTable[dwHash] = pNew;
+	InsertBlock(pNew);
+	return pNew;
+}
 
-	//cbLock.Unlock();
+void RiverBasicBlockCache::InsertBlock(RiverBasicBlock *pBlock) {
+	nodep::DWORD dwHash = HashFunc(logHashSize, pBlock->address); // & 0xFFFF;
+	RiverBasicBlock *pHead;
 
-	return pNew;
+	// readers walk the chains without locking, the block is linked in last
+	do {
+		pHead = hashTable[dwHash];
+		pBlock->pNext = pHead;
+	} while ((long)pHead != RiverAtomicCompareExchange((volatile long *)&hashTable[dwHash], (long)pBlock, (long)pHead));
 }
 
 bool RiverBasicBlockCache::Init(RiverHeap *hp, nodep::DWORD logHSize, nodep::DWORD histSize) {
@@ -108,10 +111,30 @@ bool RiverBasicBlockCache::Destroy() {
 			pAdd = pWalk;
 			pWalk = pWalk->pNext;
 
+			if (RIVER_BASIC_BLOCK_SPECULATIVE & pAdd->dwFlags) {
+				// the block belongs to the heap of the speculative translator
+				if (NULL != pAdd->pSbCode) {
+					heap->Free(pAdd->pSbCode);
+				}
+				continue;
+			}
+
 			if (pAdd->address != (nodep::UINT_PTR)pAdd->pCode) {
 				heap->Free(pAdd->pCode);
 			}
 
+			if (NULL != pAdd->pSbCode) {
+				heap->Free(pAdd->pSbCode);
+			}
+
+			if (NULL != pAdd->pBkIR) {
+				// never backtracked into, pRevTrackCode is still the lazy stub
+				if (NULL != pAdd->pRevTrackCode) {
+					heap->Free(pAdd->pRevTrackCode);
+				}
+				heap->Free(pAdd->pBkIR);
+			}
+
 			heap->Free(pAdd);
 		}
 	}
@@ -128,6 +151,16 @@ bool RiverBasicBlockCache::Destroy() {
 	return true;
 }
 
+void RiverBasicBlockCache::DropSuperblock(RiverBasicBlock *pCB) {
+	if (NULL != pCB->pSbCode) {
+		heap->Free(pCB->pSbCode);
+	}
+
+	pCB->pSbCode = NULL;
+	pCB->dwSbOpCount = 0;
+	pCB->dwSbCount = 0;
+}
+
 #endif
 
 RiverBasicBlock *RiverBasicBlockCache::FindBlock(nodep::UINT_PTR a) {
@@ -176,6 +209,21 @@ RiverBasicBlock *RiverBasicBlockCache::FindBlock(nodep::UINT_PTR a) {
 	return NULL;
 }
 
+/* The head is checked by FindBlock, only the following blocks are left. */
+bool RiverBasicBlockCache::CheckSuperblock(RiverBasicBlock *pCB) {
+#ifndef BLOCK_CACHE_READ_ONLY
+	for (nodep::DWORD i = 1; i < pCB->dwSbCount; ++i) {
+		RiverBasicBlock *pBlock = pCB->pSbBlocks[i];
+
+		if (pBlock->dwCRC != (unsigned long)crc32(0xEDB88320, (nodep::BYTE *)pBlock->address, pBlock->dwSize)) {
+			return false;
+		}
+	}
+#endif
+
+	return true;
+}
+
 void RiverBasicBlockCache::ForEachBlock(void *ctx, BlockCallback cb) {
 	for (int i = 0; i < (1 << logHashSize); ++i) {
 		RiverBasicBlock *pWalk = hashTable[i];
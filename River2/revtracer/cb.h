@@ -6,6 +6,10 @@
 #include "sync.h"
 
 #define RIVER_BASIC_BLOCK_DETOUR				0x80000000
+#define RIVER_BASIC_BLOCK_SPECULATIVE			0x40000000 // translated in the background, see RiverSpeculativeTranslator
+
+#define RIVER_SUPERBLOCK_THRESHOLD				0x100 // executions before a block heads a superblock
+#define RIVER_SUPERBLOCK_MAX_BLOCKS				8
 
 class RiverBasicBlock {
 public :
@@ -25,6 +29,7 @@ public :
 	/* statistical runtime information */
 	nodep::DWORD				dwFwPasses; // number of block executions
 	nodep::DWORD				dwBkPasses; // number of reverse block executions
+	nodep::DWORD				dwSuccPasses[2]; // number of transitions to pBranchNext[0], [1]
 
 	/* actual code information */
 	unsigned char		*pCode; // deprecated
@@ -33,6 +38,7 @@ public :
 	unsigned char		*pTrackCode; // tracking code
 	unsigned char		*pRevTrackCode; // reverse tracking code
 	unsigned char       *pDisasmCode; // disassembled code
+	unsigned char		*pBkIR; // backward river code, until pBkCode and pRevTrackCode are assembled
 
 	/* control flow data */
 	nodep::DWORD				dwBranchType;
@@ -45,6 +51,14 @@ public :
 	/* branching cache, in order to speed up lookup */
 	RiverBasicBlock		*pBranchCache[2];
 
+	/* superblock headed by this block (TRACER_FEATURE_SUPERBLOCK) */
+	unsigned char		*pSbCode;
+	nodep::DWORD				dwSbOpCount;
+	nodep::DWORD				dwSbCount;
+	RiverBasicBlock		*pSbBlocks[RIVER_SUPERBLOCK_MAX_BLOCKS];
+	nodep::DWORD				dwRiverInstCount; // river instructions of the forward translation
+	nodep::DWORD				dwRiverAddrCount; // river addresses of the forward translation
+
 	void MarkForward();
 	void MarkBackward();
 };
@@ -64,8 +78,14 @@ public :
 	bool Destroy();
 
 	RiverBasicBlock *NewBlock(nodep::UINT_PTR addr);
+	// lock-free, the block may come from another thread
+	void InsertBlock(RiverBasicBlock *pBlock);
 	RiverBasicBlock *FindBlock(nodep::UINT_PTR addr);
 
+	// checks that none of the blocks in the superblock was modified
+	bool CheckSuperblock(RiverBasicBlock *pCB);
+	void DropSuperblock(RiverBasicBlock *pCB);
+
 	typedef void(*BlockCallback)(void *, RiverBasicBlock *);
 	void ForEachBlock(void *ctx, BlockCallback cb);
 };
@@ -12,6 +12,7 @@
 #include "RiverX86Disassembler.h"
 #include "RiverReverseTranslator.h"
 #include "RiverSaveTranslator.h"
+#include "OperandLayout.h"
 
 RiverCodeGen::RiverCodeGen() {
 	outBufferSize = 0;
@@ -27,6 +28,9 @@ RiverCodeGen::~RiverCodeGen() {
 
 bool RiverCodeGen::Init(RiverHeap *hp, RiverRuntime *rt, nodep::DWORD buffSz, nodep::DWORD dwTranslationFlags) {
 	heap = hp;
+	retiredStub = NULL;
+	checkReadable = false;
+	readableEnd = NULL;
 	if (NULL == (outBuffer = (unsigned char *)revtracerImports.memoryAllocFunc(buffSz))) {
 		return false;
 	}
@@ -37,7 +41,7 @@ bool RiverCodeGen::Init(RiverHeap *hp, RiverRuntime *rt, nodep::DWORD buffSz, no
 
 	metaTranslator.Init(this);
 
-	repTranslator.Init(this);
+	repTranslator.Init(this, dwTranslationFlags);
 
 	revTranslator.Init(this);
 	saveTranslator.Init(this);
@@ -46,10 +50,19 @@ bool RiverCodeGen::Init(RiverHeap *hp, RiverRuntime *rt, nodep::DWORD buffSz, no
 	symbopSaveTranslator.Init(this);
 	symbopReverseTranslator.Init(this);
 
+	peepholeOptimizer.Init(this);
+	flagsLiveness.Init(this);
+	translationCache.Init(this, revtracerConfig.translationCache, revtracerConfig.translationCacheSize);
+
 	return assembler.Init(rt, dwTranslationFlags);
 }
 
 bool RiverCodeGen::Destroy() {
+	if (NULL != retiredStub) {
+		heap->Free(retiredStub);
+		retiredStub = NULL;
+	}
+
 	revtracerImports.memoryFreeFunc(outBuffer);
 	outBuffer = NULL;
 	outBufferSize = 0;
@@ -61,10 +74,38 @@ void RiverCodeGen::Reset() {
 	addrCount = trInstCount = fwInstCount = bkInstCount = 0;
 	symbopInstCount = 0;
 	rev_memset(regVersions, 0, sizeof(regVersions));
+	translationCache.Reset();
+	readableEnd = NULL;
+}
+
+void RiverCodeGen::EnableReadableCheck() {
+	checkReadable = true;
+}
+
+/* Checks that the longest instruction at px86 can be read. The pages are
+ * probed once per block, up to the end of the last page that was checked. */
+bool RiverCodeGen::IsCodeReadable(nodep::BYTE *px86) {
+	if (!checkReadable || (px86 + RIVER_MAX_INSTRUCTION_SIZE <= readableEnd)) {
+		return true;
+	}
+
+	nodep::BYTE *start = (px86 < readableEnd) ? readableEnd : px86;
+	nodep::BYTE *end = (nodep::BYTE *)(((nodep::UINT_PTR)px86 + RIVER_MAX_INSTRUCTION_SIZE + RIVER_CODE_PAGE_SIZE - 1) & ~(RIVER_CODE_PAGE_SIZE - 1));
+
+	if (!revtracerImports.isReadable((ADDR_TYPE)start, end - start)) {
+		return false;
+	}
+
+	readableEnd = end;
+	return true;
 }
 
 
 static int callCount = 0;
+bool RiverCodeGen::CanAllocAddr(nodep::DWORD count) const {
+	return count <= sizeof(trRiverAddr) / sizeof(trRiverAddr[0]) - addrCount;
+}
+
 struct RiverAddress *RiverCodeGen::AllocAddr(nodep::WORD flags) {
 	struct RiverAddress *ret = &trRiverAddr[addrCount];
 	callCount++;
@@ -79,21 +120,26 @@ RiverAddress *RiverCodeGen::CloneAddress(const RiverAddress &mem, nodep::WORD fl
 }
 
 
+// xmm registers are versioned separately, after the general purpose ones
+static inline nodep::BYTE RegVersionIndex(unsigned char regName) {
+	return RIVER_REG_IS_XMM(regName) ? (8 | (regName & 0x07)) : (regName & 0x07);
+}
+
 unsigned int RiverCodeGen::GetCurrentReg(unsigned char regName) const {
 	if (RIVER_REG_NONE == (regName)) return regName;
-	nodep::BYTE rTmp = regName & 0x07;
+	nodep::BYTE rTmp = RegVersionIndex(regName);
 	return regVersions[rTmp] | regName;
 }
 
 unsigned int RiverCodeGen::GetPrevReg(unsigned char regName) const {
 	if (RIVER_REG_NONE == (regName)) return regName;
-	nodep::BYTE rTmp = regName & 0x07;
+	nodep::BYTE rTmp = RegVersionIndex(regName);
 	return (regVersions[rTmp] - 0x100) | regName;
 }
 
 unsigned int RiverCodeGen::NextReg(unsigned char regName) {
-	if (regName > 0x20) DEBUG_BREAK;
-	regVersions[regName & 0x07] += 0x100;
+	if ((regName > 0x20) && !RIVER_REG_IS_XMM(regName)) DEBUG_BREAK;
+	regVersions[RegVersionIndex(regName)] += 0x100;
 	return GetCurrentReg(regName);
 }
 
@@ -231,7 +277,20 @@ nodep::DWORD RiverCodeGen::TranslateBasicBlock(nodep::BYTE *px86,
 		//metaTranslator.Translate(dis, instrBuffers[currentBuffer], instrCounts[currentBuffer]);
 
 		RiverInstruction *ri = instrBuffers[currentBuffer];
-		DisassembleSingle(pTmp, ri, instrCounts[currentBuffer], pFlags, rerror);
+		if (!IsCodeReadable(pTmp)) {
+			rerror->errorCode = RERROR_UNREADABLE_CODE;
+			rerror->translatorId = RIVER_DISASSEMBLER_ID;
+			rerror->instructionAddress = (nodep::DWORD)pTmp;
+			return 0;
+		}
+
+		if (!translationCache.Replay(pTmp, ri, instrCounts[currentBuffer], sizeof(instrBuffers[0]) / sizeof(instrBuffers[0][0]), pFlags, rerror)) {
+			DisassembleSingle(pTmp, ri, instrCounts[currentBuffer], pFlags, rerror);
+
+			if (RERROR_OK == rerror->errorCode) {
+				translationCache.Record(pAux, pTmp - pAux, ri, instrCounts[currentBuffer], pFlags);
+			}
+		}
 
 		// set disassemble flags when branch instruction is found
 		if (pFlags & RIVER_FLAG_BRANCH) {
@@ -285,21 +344,24 @@ nodep::DWORD RiverCodeGen::TranslateBasicBlock(nodep::BYTE *px86,
 			}
 		}
 		RiverAddress *serialAddress = nullptr;
-		RiverInstruction *serialInstr = (RiverInstruction *)heap->Alloc(
+		RiverSerializedInstruction *serialInstr = (RiverSerializedInstruction *)heap->Alloc(
 			instrCounts[currentBuffer] * sizeof(serialInstr[0])
 			+ addrCount * sizeof(serialAddress[0])
 		); // put head of buffer here
 		serialAddress = (RiverAddress *)&serialInstr[instrCounts[currentBuffer]];
 
 		addrCount = 0;
-		rev_memcpy(serialInstr, instrBuffers[currentBuffer], instrCounts[currentBuffer] * sizeof(serialInstr[0]));
 		for (nodep::DWORD i = 0; i < instrCounts[currentBuffer]; ++i) {
+			rev_memcpy(&serialInstr[i].instruction, &instrBuffers[currentBuffer][i], sizeof(serialInstr[i].instruction));
+			// the layout is filled in by the symbop translator
+			ResetOperandLayout(serialInstr[i].layout);
+
 			for (nodep::DWORD j = 0; j < 4; ++j) {
 				instrBuffers[currentBuffer][i].instructionAddress = (nodep::DWORD)&serialInstr[i];
 
-				if (RIVER_OPTYPE(serialInstr[i].opTypes[j]) == RIVER_OPTYPE_MEM) {
-					rev_memcpy(&serialAddress[addrCount], serialInstr[i].operands[j].asAddress, sizeof(serialAddress[0]));
-					serialInstr[i].operands[j].asAddress = &serialAddress[addrCount];
+				if (RIVER_OPTYPE(serialInstr[i].instruction.opTypes[j]) == RIVER_OPTYPE_MEM) {
+					rev_memcpy(&serialAddress[addrCount], serialInstr[i].instruction.operands[j].asAddress, sizeof(serialAddress[0]));
+					serialInstr[i].instruction.operands[j].asAddress = &serialAddress[addrCount];
 					addrCount++;
 				}
 			}
@@ -375,6 +437,15 @@ nodep::DWORD RiverCodeGen::TranslateBasicBlock(nodep::BYTE *px86,
 	return pTmp - px86;
 }
 
+// direct jumps and jccs can continue inside a superblock (not jecxz, it has no inverse)
+static bool IsChainableBranch(const RiverInstruction &ri) {
+	if (RIVER_MODIFIER_EXT & ri.modifiers) {
+		return 0x80 == (ri.opCode & 0xF0);
+	}
+
+	return (0x70 == (ri.opCode & 0xF0)) || (0xE9 == ri.opCode) || (0xEB == ri.opCode);
+}
+
 void GetSerializableInstruction(const RiverInstruction &rI, RiverInstruction &rO) {
 	rev_memcpy(&rO, &rI, sizeof(rI));
 
@@ -459,6 +530,15 @@ void SetBranchInfo(RiverBasicBlock *pCB, nodep::DWORD disassFlags) {
 	}
 }
 
+// the assembler does not tell which instruction failed, the block is reported
+static void SetAssemblerError(RiverBasicBlock *pCB, RevtracerError *rerror) {
+	rerror->prefix = 0x00;
+	rerror->opcode = *((nodep::BYTE *)pCB->address);
+	rerror->translatorId = RIVER_ASSEMBLER_ID;
+	rerror->instructionAddress = pCB->address;
+	rerror->errorCode = RERROR_UNK_INSTRUCTION;
+}
+
 bool RiverCodeGen::Translate(RiverBasicBlock *pCB, nodep::DWORD dwTranslationFlags, RevtracerError *rerror) {
 	bool ret;
 
@@ -475,6 +555,7 @@ bool RiverCodeGen::Translate(RiverBasicBlock *pCB, nodep::DWORD dwTranslationFla
 	} else {
 
 		Reset();
+		translationCache.Lookup(pCB->address, dwTranslationFlags);
 
 		nodep::DWORD disassFlags;
 		pCB->dwOrigOpCount = 0;
@@ -488,11 +569,36 @@ bool RiverCodeGen::Translate(RiverBasicBlock *pCB, nodep::DWORD dwTranslationFla
 			return false;
 		}
 
+		// used to tell whether the block still fits in a superblock
+		pCB->dwRiverInstCount = fwInstCount;
+		pCB->dwRiverAddrCount = addrCount;
+
 		trInstCount += pCB->dwOrigOpCount;
 		pCB->dwCRC = (nodep::DWORD)crc32(0xEDB88320, (nodep::BYTE *)pCB->address, pCB->dwSize);
+		translationCache.Commit(pCB->address, dwTranslationFlags, pCB->dwSize);
 
 		revtracerImports.dbgPrintFunc(PRINT_DEBUG, "## this: %08x\n", (nodep::DWORD)this);
 
+		if (dwTranslationFlags & TRACER_FEATURE_PEEPHOLE) {
+			peepholeOptimizer.Optimize(fwRiverInst, fwInstCount, dwTranslationFlags);
+
+#ifdef ENABLE_DEBUG_TRANSLATIONS
+			const RiverPeepholeStats &stats = peepholeOptimizer.GetStats();
+			TRANSLATE_PRINT(PRINT_INFO | PRINT_TRANSLATION, "= Peephole ===================================================================\n");
+			for (nodep::DWORD i = 0; i < fwInstCount; ++i) {
+				TRANSLATE_PRINT_INSTRUCTION(PRINT_INFO | PRINT_TRANSLATION, &fwRiverInst[i]);
+			}
+			TRANSLATE_PRINT(PRINT_INFO | PRINT_TRANSLATION, "blocks: %d, instructions: %d -> %d, register saves: -%d, flag saves: -%d, hoisted saves: %d\n",
+				stats.blockCount, stats.instrIn, stats.instrOut, stats.coalescedRegSaves, stats.coalescedFlagSaves, stats.hoistedSaves);
+			TRANSLATE_PRINT(PRINT_INFO | PRINT_TRANSLATION, "===============================================================================\n");
+#endif
+		}
+
+		if (dwTranslationFlags & TRACER_FEATURE_TRACKING) {
+			// the pretrack code only preserves the flags that are still live
+			flagsLiveness.Analyze(fwRiverInst, fwInstCount);
+		}
+
 		if (dwTranslationFlags & TRACER_FEATURE_REVERSIBLE) {
 			// generate the reverse basic block representations
 			revtracerImports.dbgPrintFunc(PRINT_DEBUG, "##Rev: %08x %d instructions\n", fwRiverInst, fwInstCount);
@@ -574,7 +680,10 @@ bool RiverCodeGen::Translate(RiverBasicBlock *pCB, nodep::DWORD dwTranslationFla
 
 		//outBufferSize = rivertox86(this, rt, fwRiverInst, fwInstCount, outBuffer, 0x01);
 		codeBuffer.Reset();
-		assembler.Assemble(fwRiverInst, fwInstCount, codeBuffer, 0x10, pCB->dwFwOpCount, outBufferSize, ASSEMBLER_CODE_NATIVE | ASSEMBLER_DIR_FORWARD);
+		if (!assembler.Assemble(fwRiverInst, fwInstCount, codeBuffer, 0x10, pCB->dwFwOpCount, outBufferSize, ASSEMBLER_CODE_NATIVE | ASSEMBLER_DIR_FORWARD)) {
+			SetAssemblerError(pCB, rerror);
+			return false;
+		}
 		pCB->pFwCode = DuplicateBuffer(heap, outBuffer, outBufferSize);
 		//assembler.CopyFix(pCB->pFwCode, outBuffer);
 		codeBuffer.CopyToFixed(pCB->pFwCode);
@@ -582,11 +691,10 @@ bool RiverCodeGen::Translate(RiverBasicBlock *pCB, nodep::DWORD dwTranslationFla
 		//outBufferSize = rivertox86(this, rt, bkRiverInst, bkInstCount, outBuffer, 0x00);
 
 		if (dwTranslationFlags & TRACER_FEATURE_REVERSIBLE) {
-			codeBuffer.Reset();
-			assembler.Assemble(bkRiverInst, bkInstCount, codeBuffer, 0x00, pCB->dwBkOpCount, outBufferSize, ASSEMBLER_CODE_NATIVE | ASSEMBLER_DIR_BACKWARD);
-			pCB->pBkCode = DuplicateBuffer(heap, outBuffer, outBufferSize);
-			//assembler.CopyFix(pCB->pBkCode, outBuffer);
-			codeBuffer.CopyToFixed(pCB->pBkCode);
+			// assembled on the first backtrack into this block, see TranslateBackward
+			if (!SaveBackward(pCB, dwTranslationFlags)) {
+				return false;
+			}
 		}
 
 		if (dwTranslationFlags & TRACER_FEATURE_TRACKING) {
@@ -599,18 +707,245 @@ bool RiverCodeGen::Translate(RiverBasicBlock *pCB, nodep::DWORD dwTranslationFla
 			}
 
 			codeBuffer.Reset();
-			assembler.Assemble(fwTrace, fwTraceCount, codeBuffer, 0x10, pCB->dwTrOpCount, outBufferSize, ASSEMBLER_CODE_TRACKING | ASSEMBLER_DIR_FORWARD);
+			if (!assembler.Assemble(fwTrace, fwTraceCount, codeBuffer, 0x10, pCB->dwTrOpCount, outBufferSize, ASSEMBLER_CODE_TRACKING | ASSEMBLER_DIR_FORWARD)) {
+				SetAssemblerError(pCB, rerror);
+				return false;
+			}
 			pCB->pTrackCode = DuplicateBuffer(heap, outBuffer, outBufferSize);
 			codeBuffer.CopyToFixed(pCB->pTrackCode);
+		}
 
-			if (dwTranslationFlags & TRACER_FEATURE_REVERSIBLE) {
-				codeBuffer.Reset();
-				assembler.Assemble(symbopBkRiverInst, sbInstCount, codeBuffer, 0x00, pCB->dwRtOpCount, outBufferSize, ASSEMBLER_CODE_TRACKING | ASSEMBLER_DIR_BACKWARD);
-				pCB->pRevTrackCode = DuplicateBuffer(heap, outBuffer, outBufferSize);
-				codeBuffer.CopyToFixed(pCB->pRevTrackCode);
+		return true;
+	}
+}
+
+/* Backward code of a block that was not assembled yet. It is followed by the
+ * native instructions, the tracking instructions and the addresses they
+ * point to. */
+struct RiverBackwardCode {
+	nodep::DWORD dwTranslationFlags;
+	nodep::DWORD dwBkInstCount;
+	nodep::DWORD dwRtInstCount;
+	nodep::DWORD dwAddrCount;
+};
+
+static nodep::DWORD CountAddresses(const RiverInstruction *code, nodep::DWORD count) {
+	nodep::DWORD ret = 0;
+	for (nodep::DWORD i = 0; i < count; ++i) {
+		for (nodep::DWORD j = 0; j < 4; ++j) {
+			if (RIVER_OPTYPE_MEM == RIVER_OPTYPE(code[i].opTypes[j])) {
+				ret++;
 			}
 		}
+	}
+	return ret;
+}
 
-		return true;
+static void CopyInstructions(RiverInstruction *dst, const RiverInstruction *src, nodep::DWORD count, RiverAddress32 *addr, nodep::DWORD &addrCount) {
+	for (nodep::DWORD i = 0; i < count; ++i) {
+		rev_memcpy(&dst[i], &src[i], sizeof(dst[i]));
+		for (nodep::DWORD j = 0; j < 4; ++j) {
+			if (RIVER_OPTYPE_MEM == RIVER_OPTYPE(src[i].opTypes[j])) {
+				rev_memcpy(&addr[addrCount], src[i].operands[j].asAddress, sizeof(addr[addrCount]));
+				dst[i].operands[j].asAddress = &addr[addrCount];
+				addrCount++;
+			}
+		}
+	}
+}
+
+/* The tracking code of a block is run by the branch handler of the client,
+ * before the tracer sees the backtrack. Until the block is backtracked into,
+ * pRevTrackCode points to a stub that calls LazyReverseTracking. The stub is
+ * freed once the real code is installed, or by the block cache teardown. */
+static const nodep::BYTE lazyStub[] = {
+	0xFF, 0x74, 0x24, 0x04,			// push dword ptr [esp + 4]
+	0x68, 0x00, 0x00, 0x00, 0x00,	// push pCB
+	0x68, 0x00, 0x00, 0x00, 0x00,	// push this
+	0xE8, 0x00, 0x00, 0x00, 0x00,	// call LazyReverseTracking
+	0x83, 0xC4, 0x0C,				// add esp, 0x0C
+	0xC3							// ret
+};
+
+bool RiverCodeGen::SaveBackward(RiverBasicBlock *pCB, nodep::DWORD dwTranslationFlags) {
+	nodep::DWORD rtInstCount = (dwTranslationFlags & TRACER_FEATURE_TRACKING) ? sbInstCount : 0;
+	nodep::DWORD addrTotal = CountAddresses(bkRiverInst, bkInstCount) + CountAddresses(symbopBkRiverInst, rtInstCount);
+
+	RiverBackwardCode *bk = (RiverBackwardCode *)heap->Alloc(
+		sizeof(*bk) +
+		(bkInstCount + rtInstCount) * sizeof(RiverInstruction) +
+		addrTotal * sizeof(RiverAddress32)
+	);
+
+	if (NULL == bk) {
+		return false;
+	}
+
+	RiverInstruction *code = (RiverInstruction *)&bk[1];
+	RiverAddress32 *addr = (RiverAddress32 *)&code[bkInstCount + rtInstCount];
+
+	bk->dwTranslationFlags = dwTranslationFlags;
+	bk->dwBkInstCount = bkInstCount;
+	bk->dwRtInstCount = rtInstCount;
+	bk->dwAddrCount = 0;
+	CopyInstructions(code, bkRiverInst, bkInstCount, addr, bk->dwAddrCount);
+	CopyInstructions(&code[bkInstCount], symbopBkRiverInst, rtInstCount, addr, bk->dwAddrCount);
+
+	pCB->pBkIR = (unsigned char *)bk;
+	pCB->pBkCode = NULL;
+
+	if (dwTranslationFlags & TRACER_FEATURE_TRACKING) {
+		nodep::BYTE *stub = (nodep::BYTE *)heap->Alloc(sizeof(lazyStub));
+		if (NULL == stub) {
+			return false;
+		}
+
+		rev_memcpy(stub, lazyStub, sizeof(lazyStub));
+		*(nodep::DWORD *)&stub[0x05] = (nodep::DWORD)pCB;
+		*(nodep::DWORD *)&stub[0x0A] = (nodep::DWORD)this;
+		*(nodep::DWORD *)&stub[0x0F] = (nodep::DWORD)&RiverCodeGen::LazyReverseTracking - (nodep::DWORD)&stub[0x13];
+		pCB->pRevTrackCode = stub;
+	}
+
+	return true;
+}
+
+void RiverCodeGen::LazyReverseTracking(RiverCodeGen *cg, RiverBasicBlock *pCB, nodep::DWORD trackBuffer) {
+	if (!cg->AssembleBackward(pCB, true)) {
+		// the stub would call itself again
+		DEBUG_BREAK;
+		return;
+	}
+	((void (*)(nodep::DWORD))pCB->pRevTrackCode)(trackBuffer);
+}
+
+bool RiverCodeGen::TranslateBackward(RiverBasicBlock *pCB) {
+	return AssembleBackward(pCB, false);
+}
+
+bool RiverCodeGen::AssembleBackward(RiverBasicBlock *pCB, bool fromStub) {
+	RiverBackwardCode *bk = (RiverBackwardCode *)pCB->pBkIR;
+
+	if (NULL == bk) {
+		return NULL != pCB->pBkCode;
+	}
+
+	RiverInstruction *code = (RiverInstruction *)&bk[1];
+
+	codeBuffer.Reset();
+	if (!assembler.Assemble(code, bk->dwBkInstCount, codeBuffer, 0x00, pCB->dwBkOpCount, outBufferSize, ASSEMBLER_CODE_NATIVE | ASSEMBLER_DIR_BACKWARD)) {
+		return false;
+	}
+	pCB->pBkCode = DuplicateBuffer(heap, outBuffer, outBufferSize);
+	//assembler.CopyFix(pCB->pBkCode, outBuffer);
+	codeBuffer.CopyToFixed(pCB->pBkCode);
+
+	if (bk->dwTranslationFlags & TRACER_FEATURE_TRACKING) {
+		nodep::BYTE *stub = pCB->pRevTrackCode;
+
+		codeBuffer.Reset();
+		if (!assembler.Assemble(&code[bk->dwBkInstCount], bk->dwRtInstCount, codeBuffer, 0x00, pCB->dwRtOpCount, outBufferSize, ASSEMBLER_CODE_TRACKING | ASSEMBLER_DIR_BACKWARD)) {
+			heap->Free(pCB->pBkCode);
+			pCB->pBkCode = NULL;
+			return false;
+		}
+		pCB->pRevTrackCode = DuplicateBuffer(heap, outBuffer, outBufferSize);
+		codeBuffer.CopyToFixed(pCB->pRevTrackCode);
+
+		// a stub that is still running is freed on the next call
+		if (NULL != retiredStub) {
+			heap->Free(retiredStub);
+			retiredStub = NULL;
+		}
+
+		if (fromStub) {
+			retiredStub = stub;
+		} else if (NULL != stub) {
+			heap->Free(stub);
+		}
 	}
+
+	heap->Free(bk);
+	pCB->pBkIR = NULL;
+	return true;
+}
+
+/* Translates the chain of blocks pChain[0] (== pCB) ... pChain[dwCount - 1] as
+ * a single entry, multiple exit superblock. The branch that ends each block
+ * continues with the next block of the chain, every other path exits to the
+ * branch handler. The chain is cut at the first block that does not end in a
+ * direct jump towards its successor. Only the forward code is generated. */
+bool RiverCodeGen::TranslateSuperblock(RiverBasicBlock *pCB, RiverBasicBlock **pChain, nodep::DWORD dwCount, nodep::DWORD dwTranslationFlags, RevtracerError *rerror) {
+	if (dwTranslationFlags & (TRACER_FEATURE_REVERSIBLE | TRACER_FEATURE_TRACKING)) {
+		return false;
+	}
+
+	Reset();
+
+	TRANSLATE_PRINT(PRINT_INFO | PRINT_TRANSLATION, "= Superblock %08x ==========================================================\n", pCB->address);
+
+	nodep::DWORD dwUsed = 0;
+	while (dwUsed < dwCount) {
+		nodep::DWORD dwInst = 0, disassFlags = 0;
+		nodep::BYTE *disasm = NULL;
+		struct rev::BranchNext next[2];
+
+		nodep::DWORD dwSize = TranslateBasicBlock((nodep::BYTE *)pChain[dwUsed]->address,
+				dwInst, disasm, dwTranslationFlags,
+				&disassFlags, next, rerror);
+
+		if ((0 == dwSize) || (RERROR_OK != rerror->errorCode)) {
+			return false;
+		}
+
+		dwUsed++;
+		if (dwUsed == dwCount) {
+			break;
+		}
+
+		// the next block is translated straight into the shared buffers, stop
+		// unless its earlier translation fits in what is left of them
+		const RiverBasicBlock *pNext = pChain[dwUsed];
+		if ((0 == pNext->dwRiverInstCount) ||
+			(pNext->dwRiverInstCount > RIVER_FORWARD_INSTRUCTIONS - fwInstCount) ||
+			(pNext->dwRiverAddrCount > sizeof(trRiverAddr) / sizeof(trRiverAddr[0]) - addrCount)) {
+			break;
+		}
+
+		RiverInstruction *pBranch = &fwRiverInst[fwInstCount - 1];
+		nodep::UINT_PTR nextAddr = pNext->address;
+
+		if (!IsChainableBranch(*pBranch)) {
+			break;
+		}
+
+		if (next[0].address == nextAddr) {
+			pBranch->subOpCode = RIVER_BRANCH_STAY_TAKEN;
+		} else if ((disassFlags & RIVER_BRANCH_INSTR_JXX) && (next[1].address == nextAddr)) {
+			pBranch->subOpCode = RIVER_BRANCH_STAY_FALLTHROUGH;
+		} else {
+			break;
+		}
+	}
+
+	if (dwUsed < 2) {
+		return false;
+	}
+
+	for (nodep::DWORD i = 0; i < dwUsed; ++i) {
+		pCB->pSbBlocks[i] = pChain[i];
+		TRANSLATE_PRINT(PRINT_INFO | PRINT_TRANSLATION, "  block %08x\n", pChain[i]->address);
+	}
+	pCB->dwSbCount = dwUsed;
+
+	codeBuffer.Reset();
+	if (!assembler.Assemble(fwRiverInst, fwInstCount, codeBuffer, 0x10, pCB->dwSbOpCount, outBufferSize, ASSEMBLER_CODE_NATIVE | ASSEMBLER_DIR_FORWARD)) {
+		SetAssemblerError(pCB, rerror);
+		return false;
+	}
+	pCB->pSbCode = DuplicateBuffer(heap, outBuffer, outBufferSize);
+	codeBuffer.CopyToFixed(pCB->pSbCode);
+
+	TRANSLATE_PRINT(PRINT_INFO | PRINT_TRANSLATION, "===============================================================================\n");
+	return true;
 }
@@ -8,26 +8,27 @@
 #endif
 
 
+/* Disabled prints expand to nothing, their arguments are not evaluated */
 #ifdef ENABLE_DEBUG_TRANSLATIONS
-#define TRANSLATE_PRINT revtracerImports.dbgPrintFunc
-#define TRANSLATE_PRINT_INSTRUCTION RiverPrintInstruction
+#define TRANSLATE_PRINT(...) revtracerImports.dbgPrintFunc(__VA_ARGS__)
+#define TRANSLATE_PRINT_INSTRUCTION(...) RiverPrintInstruction(__VA_ARGS__)
 #else
-#define TRANSLATE_PRINT
-#define TRANSLATE_PRINT_INSTRUCTION
+#define TRANSLATE_PRINT(...) ((void)0)
+#define TRANSLATE_PRINT_INSTRUCTION(...) ((void)0)
 #endif
 
 #ifdef ENABLE_DEBUG_TRACKING
-#define TRACKING_PRINT revtracerImports.dbgPrintFunc
-#define LIB_TRACKING_PRINT exec->DebugPrintf
+#define TRACKING_PRINT(...) revtracerImports.dbgPrintFunc(__VA_ARGS__)
+#define LIB_TRACKING_PRINT(...) exec->DebugPrintf(__VA_ARGS__)
 #else
-#define TRACKING_PRINT
-#define LIB_TRACKING_PRINT
+#define TRACKING_PRINT(...) ((void)0)
+#define LIB_TRACKING_PRINT(...) ((void)0)
 #endif
 
 #ifdef ENABLE_DEBUG_BRANCHING
-#define BRANCHING_PRINT revtracerImports.dbgPrintFunc
+#define BRANCHING_PRINT(...) revtracerImports.dbgPrintFunc(__VA_ARGS__)
 #else
-#define BRANCHING_PRINT
+#define BRANCHING_PRINT(...) ((void)0)
 #endif
 
 #include <assert.h>
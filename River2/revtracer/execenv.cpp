@@ -21,6 +21,7 @@ ExecutionEnvironment::ExecutionEnvironment(nodep::DWORD flags, unsigned int heap
 	bValid = false;
 	generationFlags = flags;
 	exitAddr = 0xFFFFCAFE;
+	entryPoint = NULL;
 	if (0 == heap.Init(heapSize)) {
 		return;
 	}
@@ -55,6 +56,36 @@ ExecutionEnvironment::ExecutionEnvironment(nodep::DWORD flags, unsigned int heap
 
 	rev_memset(pStack, 0, 0x100000);
 
+	lastFwProfile = NULL;
+
+	runtimeContext.releaseTaint = NULL;
+	runtimeContext.symbolicStream = NULL;
+	runtimeContext.symbolicStreamPos = 0;
+	if (TRACER_FEATURE_SYMBOLIC_STREAM & generationFlags) {
+		if (NULL == (runtimeContext.symbolicStream = (nodep::DWORD *)revtracerImports.memoryAllocFunc(SYMBOLIC_STREAM_SIZE * sizeof(runtimeContext.symbolicStream[0])))) {
+			revtracerImports.memoryFreeFunc(pStack);
+			codeGen.Destroy();
+			revtracerImports.memoryFreeFunc(executionBuffer);
+			blockCache.Destroy();
+			heap.Destroy();
+			return;
+		}
+	}
+
+	// the tracer runs without background translation when the worker can not be created
+	speculative = NULL;
+	if ((TRACER_FEATURE_SPECULATIVE & generationFlags) && (NULL != revtracerImports.createThread) && (NULL != revtracerImports.isReadable)) {
+		speculative = new RiverSpeculativeTranslator();
+		if ((NULL != speculative) && !speculative->Init(&blockCache, &runtimeContext, heapSize, outBufferSize, generationFlags)) {
+			delete speculative;
+			speculative = NULL;
+		} else if ((NULL != speculative) && !speculative->Start()) {
+			speculative->Destroy();
+			delete speculative;
+			speculative = NULL;
+		}
+	}
+
 	runtimeContext.execBuff = (nodep::DWORD)executionBuffer + executionSize - 4; //TODO: make independant track buffer 
 	executionBase = runtimeContext.execBuff;
 
@@ -89,13 +120,29 @@ ExecutionEnvironment::ExecutionEnvironment(nodep::DWORD flags, unsigned int heap
 }*/
 
 ExecutionEnvironment::~ExecutionEnvironment() {
+	// the worker inserts blocks and the cache frees them, stop it first
+	if (NULL != speculative) {
+		speculative->Stop();
+	}
+
 	blockCache.Destroy(); 
+
+	if (NULL != speculative) {
+		speculative->Destroy();
+		delete speculative;
+		speculative = NULL;
+	}
 	heap.Destroy();
 
 	revtracerImports.memoryFreeFunc((nodep::BYTE *)executionBuffer);
 
 	revtracerImports.memoryFreeFunc((nodep::BYTE *)pStack);
 	pStack = NULL;
+
+	if (NULL != runtimeContext.symbolicStream) {
+		revtracerImports.memoryFreeFunc((nodep::BYTE *)runtimeContext.symbolicStream);
+		runtimeContext.symbolicStream = NULL;
+	}
 }
 
 /*void SetUserContext(struct ExecutionEnvironment *pEnv, void *ptr) {
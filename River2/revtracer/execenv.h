@@ -9,6 +9,7 @@
 #include "CodeGen.h"
 #include "Runtime.h"
 #include "AddressContainer.h"
+#include "RiverSpeculativeTranslator.h"
 
 struct ExecutionEnvironment {
 	RiverRuntime runtimeContext;
@@ -26,6 +27,7 @@ struct ExecutionEnvironment {
 	RiverBasicBlockCache blockCache;
 
 	nodep::UINT_PTR lastFwBlock;
+	RiverBasicBlock *lastFwProfile; // last block executed on its own, its successors are profiled (superblocks)
 	//UINT_PTR *history;
 	//unsigned long posHist, totHist; // = 0;
 
@@ -45,6 +47,12 @@ struct ExecutionEnvironment {
 	AddressContainer ac;
 
 	nodep::DWORD generationFlags;
+
+	/* first block of the traced thread, used on restarts */
+	rev::ADDR_TYPE entryPoint;
+
+	/* background translation (only for TRACER_FEATURE_SPECULATIVE) */
+	RiverSpeculativeTranslator *speculative;
 public :
 	void* operator new(size_t);
 	void operator delete(void*);
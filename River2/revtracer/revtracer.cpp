@@ -144,6 +144,10 @@ namespace rev {
 		return;
 	}
 
+	void DefaultSymbolicStreamHandler(void *context, void *records, nodep::DWORD size) {
+		return;
+	}
+
 	/* Execution context callbacks ********************************************************/
 	void GetFirstEsp(void *ctx, nodep::DWORD &esp) {
 		struct ExecutionEnvironment *pCtx = (struct ExecutionEnvironment *)ctx;
@@ -156,6 +160,11 @@ namespace rev {
 		regs->esp = pCtx->runtimeContext.virtualStack;
 	}
 
+	void GetCurrentXmmRegisters(void *ctx, XmmRegister *xmm) {
+		struct ExecutionEnvironment *pCtx = (struct ExecutionEnvironment *)ctx;
+		rev_memcpy(xmm, pCtx->runtimeContext.xmmRegisters, sizeof(pCtx->runtimeContext.xmmRegisters));
+	}
+
 	void *GetMemoryInfo(void *ctx, ADDR_TYPE addr) {
 		struct ExecutionEnvironment *pEnv = (struct ExecutionEnvironment *)ctx;
 		nodep::DWORD ret = pEnv->ac.Get((nodep::DWORD)addr/* + revtracerConfig.segmentOffsets[segSel & 0xFFFF]*/);
@@ -205,6 +214,11 @@ namespace rev {
 		DefaultMarkCallback,
 
 		DefaultSymbolicHandler,
+		DefaultSymbolicStreamHandler,
+
+		NULL,
+		NULL,
+		NULL,
 
 		{
 			(ADDR_TYPE)DefaultNtQueryInformationThread,
@@ -227,12 +241,12 @@ namespace rev {
 
 	struct ExecutionEnvironment *pEnv = NULL;
 
-	void CreateHook(ADDR_TYPE orig, ADDR_TYPE det) {
+	void CreateHook(struct ExecutionEnvironment *pEnv, ADDR_TYPE orig, ADDR_TYPE det) {
 		RevtracerError rerror;
 		RiverBasicBlock *pBlock = pEnv->blockCache.NewBlock((nodep::UINT_PTR)orig);
 
 		pBlock->address = (nodep::DWORD)det;
-		pEnv->codeGen.Translate(pBlock, revtracerConfig.featureFlags, &rerror);
+		pEnv->codeGen.Translate(pBlock, pEnv->generationFlags, &rerror);
 		pBlock->address = (nodep::DWORD)orig;
 		pBlock->dwFlags |= RIVER_BASIC_BLOCK_DETOUR;
 
@@ -259,7 +273,7 @@ namespace rev {
 			RiverBasicBlock *pBlock = pEnv->blockCache.NewBlock((nodep::UINT_PTR)revtracerConfig.entryPoint);
 			RevtracerError rerror;
 			pBlock->address = (nodep::DWORD)revtracerConfig.entryPoint;
-			pEnv->codeGen.Translate(pBlock, revtracerConfig.featureFlags, &rerror);
+			pEnv->codeGen.Translate(pBlock, pEnv->generationFlags, &rerror);
 
 			revtracerImports.dbgPrintFunc(PRINT_INFO | PRINT_CONTAINER, "New entry point @%08x\n", (nodep::DWORD)pBlock->pFwCode);
 
@@ -274,7 +288,7 @@ namespace rev {
 			case EXECUTION_ADVANCE:
 				revtracerImports.dbgPrintFunc(PRINT_INFO | PRINT_CONTAINER, "%d detours needed.\n", revtracerConfig.hookCount);
 				for (nodep::DWORD i = 0; i < revtracerConfig.hookCount; ++i) {
-					CreateHook(revtracerConfig.hooks[i].originalAddr, revtracerConfig.hooks[i].detourAddr);
+					CreateHook(pEnv, revtracerConfig.hooks[i].originalAddr, revtracerConfig.hooks[i].detourAddr);
 				}
 				pEnv->lastFwBlock = (nodep::UINT_PTR)revtracerConfig.entryPoint;
 				pEnv->bForward = 1;
@@ -349,6 +363,7 @@ namespace rev {
 
 		pEnv = new ExecutionEnvironment(revtracerConfig.featureFlags, 0x1000000, 0x10000, 0x4000000, 0x4000000, 16, 0x10000);
 		pEnv->userContext = revtracerConfig.context; //AllocUserContext(pEnv, revtracerConfig.contextSize);
+		pEnv->entryPoint = revtracerConfig.entryPoint;
 
 		revtracerConfig.pRuntime = &pEnv->runtimeContext;
 	}
@@ -360,10 +375,10 @@ namespace rev {
 		pEnv->runtimeContext.registers = (nodep::UINT_PTR)&regs;
 		if (EXECUTION_ADVANCE == revtracerImports.branchHandler(pEnv, pEnv->userContext, revtracerConfig.entryPoint)) {
 			for (nodep::DWORD i = 0; i < revtracerConfig.hookCount; ++i) {
-				CreateHook(revtracerConfig.hooks[i].originalAddr, revtracerConfig.hooks[i].detourAddr);
+				CreateHook(pEnv, revtracerConfig.hooks[i].originalAddr, revtracerConfig.hooks[i].detourAddr);
 			}
 			for (nodep::DWORD i = 0; i < revtracerConfig.hookCount; ++i) {
-				CreateHook(revtracerConfig.hooks[i].originalAddr, revtracerConfig.hooks[i].detourAddr);
+				CreateHook(pEnv, revtracerConfig.hooks[i].originalAddr, revtracerConfig.hooks[i].detourAddr);
 			}
 			// TODO save state
 			nodep::DWORD ret = call_cdecl_0(pEnv, (_fn_cdecl_0)revtracerConfig.entryPoint);
@@ -372,6 +387,44 @@ namespace rev {
 		}
 	}
 
+	nodep::DWORD TraceThread(ADDR_TYPE threadProc, void *param) {
+		nodep::DWORD ret = 0;
+		struct ExecutionRegs regs;
+
+		// the address container is per environment, tracking is not supported
+		nodep::DWORD featureFlags = revtracerConfig.featureFlags & ~(TRACER_FEATURE_SYMBOLIC | TRACER_FEATURE_SYMBOLIC_STREAM);
+		if (featureFlags != revtracerConfig.featureFlags) {
+			revtracerImports.dbgPrintFunc(PRINT_ERROR | PRINT_CONTAINER, "Tracking is not supported in traced threads, thread routine %08x runs without it\n", (nodep::DWORD)threadProc);
+		}
+
+		// smaller buffers than the main thread, a process may trace many threads
+		struct ExecutionEnvironment *pThreadEnv = new ExecutionEnvironment(featureFlags, 0x400000, 0x10000, 0x1000000, 0x1000000, 16, 0x10000);
+		if ((NULL == pThreadEnv) || !pThreadEnv->bValid) {
+			DEBUG_BREAK;
+			return 0;
+		}
+
+		pThreadEnv->userContext = revtracerConfig.context;
+		pThreadEnv->entryPoint = threadProc;
+		pThreadEnv->runtimeContext.registers = (nodep::UINT_PTR)&regs;
+
+		revtracerImports.dbgPrintFunc(PRINT_INFO | PRINT_CONTAINER, "Tracing thread routine %08x\n", (nodep::DWORD)threadProc);
+		if (EXECUTION_ADVANCE == revtracerImports.branchHandler(pThreadEnv, pThreadEnv->userContext, threadProc)) {
+			for (nodep::DWORD i = 0; i < revtracerConfig.hookCount; ++i) {
+				CreateHook(pThreadEnv, revtracerConfig.hooks[i].originalAddr, revtracerConfig.hooks[i].detourAddr);
+			}
+#ifdef _WIN32
+			ret = call_stdcall_1(pThreadEnv, (_fn_stdcall_1)threadProc, param);
+#else
+			ret = call_cdecl_1(pThreadEnv, (_fn_cdecl_1)threadProc, param);
+#endif
+			revtracerImports.dbgPrintFunc(PRINT_INFO | PRINT_CONTAINER, "Thread routine %08x done. ret = %d\n", (nodep::DWORD)threadProc, ret);
+		}
+
+		delete pThreadEnv;
+		return ret;
+	}
+
 };
 
 extern "C" {
@@ -401,6 +454,10 @@ namespace rev {
 		GetLastBasicBlockInfo,
 		MarkMemoryValue,
 
-		::RevtracerPerform
+		::RevtracerPerform,
+
+		TraceThread,
+
+		GetCurrentXmmRegisters
 	};
 };
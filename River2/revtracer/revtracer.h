@@ -9,6 +9,11 @@
 #define TRACER_FEATURE_TRACKING					0x00000002
 #define TRACER_FEATURE_ADVANCED_TRACKING		0x00000004 // never use this flag --- use _SYMBOLIC instead
 #define TRACER_FEATURE_SYMBOLIC					(TRACER_FEATURE_TRACKING | TRACER_FEATURE_ADVANCED_TRACKING)
+#define TRACER_FEATURE_SYMBOLIC_STREAM			0x00000008 // use together with _SYMBOLIC; batches symbolic handler calls per basic block
+#define TRACER_FEATURE_BULK_REP					0x00000010 // rep movs/stos are handled in a single step (not with _SYMBOLIC or _REVERSIBLE + _TRACKING)
+#define TRACER_FEATURE_PEEPHOLE					0x00000020 // peephole passes over the instrumented code (see RiverPeepholeOptimizer)
+#define TRACER_FEATURE_SUPERBLOCK				0x00000040 // hot block chains run as superblocks (not with _REVERSIBLE or _TRACKING)
+#define TRACER_FEATURE_SPECULATIVE				0x00000080 // successors are translated by a background thread (needs createThread and isReadable)
 
 namespace rev {
 
@@ -64,10 +69,27 @@ namespace rev {
 	typedef void(*SyscallControlFunc)(void *context, void *userContext);
 	typedef void(*IpcLibInitFunc)();
 
+	typedef void(*ThreadProcFunc)(void *param);
+	typedef bool(*CreateThreadFunc)(ThreadProcFunc proc, void *param);
+	typedef void(*YieldExecutionFunc)();
+	typedef bool(*IsReadableFunc)(ADDR_TYPE addr, nodep::DWORD size);
+
 	typedef void(*TrackCallbackFunc)(nodep::DWORD value, nodep::DWORD address, nodep::DWORD segment);
 	typedef void(*MarkCallbackFunc)(nodep::DWORD oldValue, nodep::DWORD newValue, nodep::DWORD address, nodep::DWORD segment);
+	typedef void(*ReleaseTaintFunc)(void *value);
 
 	typedef void(__stdcall *SymbolicHandlerFunc)(void *context, void *offset, void *instr);
+	typedef void(*SymbolicStreamHandlerFunc)(void *context, void *records, nodep::DWORD size);
+
+	/* Symbolic stream record. In TRACER_FEATURE_SYMBOLIC_STREAM mode the
+	 * concrete operand values are copied in a per-environment buffer and handed
+	 * to the symbolicStreamHandler when the basic block ends.
+	 * Each record is followed by valueCount dwords, the tracking stack frame of
+	 * the instruction, lowest address first. */
+	struct SymbolicStreamRecord {
+		nodep::DWORD instruction;
+		nodep::DWORD valueCount;
+	};
 
 	//Revtracer Wrapper API functions type
 	typedef bool (*WriteFileCall)(void *handle, int fd, void *buffer, size_t size, unsigned long *written);
@@ -111,6 +133,12 @@ namespace rev {
 
 		/* Symbolic synchronization function */
 		SymbolicHandlerFunc symbolicHandler;
+		SymbolicStreamHandlerFunc symbolicStreamHandler;
+
+		/* Background translation threads (TRACER_FEATURE_SPECULATIVE) */
+		CreateThreadFunc createThread;
+		YieldExecutionFunc yieldExecution;
+		IsReadableFunc isReadable; // the background thread only reads guest code that passes this check
 
 		LowLevelRevtracerAPI lowLevel;
 	};
@@ -139,10 +167,17 @@ namespace rev {
 
 		nodep::DWORD hookCount;
 		CodeHooks hooks[0x100];
+
+		/* Translation cache shared between runs (see RiverTranslationCache).
+		 * A zero filled (or previously used) shared mapping of a file, NULL
+		 * disables the cache. */
+		void *translationCache;
+		nodep::DWORD translationCacheSize;
 	};
 
 #define RERROR_OK              0x00000000
 #define RERROR_UNK_INSTRUCTION 0x00000001
+#define RERROR_UNREADABLE_CODE 0x00000002
 
 #define RIVER_NONE_ID                        0x00000000
 #define RIVER_DISASSEMBLER_ID                0x00000001
@@ -153,6 +188,7 @@ namespace rev {
 #define RIVER_SYMBOP_REVERSE_TRANSLATOR_ID   0x00000006
 #define RIVER_REVERSE_TRANSLATOR_ID          0x00000007
 #define RIVER_REP_TRANSLATOR_ID              0x00000008
+#define RIVER_ASSEMBLER_ID                   0x00000009
 
 #define INVALID_ADDRESS			0xFFFFFFFF
 
@@ -166,6 +202,10 @@ namespace rev {
 	};
 
 
+	struct XmmRegister {
+		nodep::DWORD dw[4];
+	};
+
 	struct ExecutionRegs {
 		nodep::DWORD edi;
 		nodep::DWORD esi;
@@ -195,10 +235,12 @@ namespace rev {
 
 	typedef void (*GetFirstEspFunc)(void *ctx, nodep::DWORD &esp);
 	typedef void (*GetCurrentRegistersFunc)(void *ctx, ExecutionRegs *regs);
+	typedef void (*GetCurrentXmmRegistersFunc)(void *ctx, XmmRegister *xmm);
 	typedef void *(*GetMemoryInfoFunc)(void *ctx, ADDR_TYPE addr);
 	typedef bool (*GetLastBasicBlockInfoFunc)(void *ctx, BasicBlockInfo *info);
 	typedef void (*MarkMemoryValueFunc)(void *ctx, ADDR_TYPE addr, nodep::DWORD value);
 	typedef void (*RevtracerPerformFunc)();
+	typedef nodep::DWORD (*TraceThreadFunc)(ADDR_TYPE threadProc, void *param);
 
 	struct RevtracerVersion {
 		nodep::BYTE major;
@@ -215,6 +257,14 @@ namespace rev {
 
 		/* Can be used as an EP for in process execution  */
 		RevtracerPerformFunc revtracerPerform;
+
+		/* Runs a thread routine of the traced process, see TraceThread */
+		TraceThreadFunc traceThread;
+
+		/* Copies xmm0-7 as saved on entry in the branch handler, xmm must
+		 * hold 8 registers. Kept apart from getCurrentRegisters so that
+		 * ExecutionRegs keeps its layout. */
+		GetCurrentXmmRegistersFunc getCurrentXmmRegisters;
 	};
 
 	extern "C" {
@@ -239,6 +289,19 @@ namespace rev {
 
 		DLL_REVTRACER_PUBLIC void Initialize();
 		DLL_REVTRACER_PUBLIC void Execute(int argc, char *argv[]);
+
+		/* Traces threadProc(param) on the calling thread. Every traced thread
+		 * gets its own execution environment (runtime, execution buffers,
+		 * stack and code cache), the decoded code is shared through the
+		 * translation cache. The callbacks receive the environment of the
+		 * thread as context and must be thread safe. Returns the value
+		 * returned by threadProc.
+		 * Tracking is refused: the tracked values live in the address
+		 * container of each environment and are not shared between threads.
+		 * The thread runs without TRACER_FEATURE_TRACKING, _SYMBOLIC and
+		 * _SYMBOLIC_STREAM, the memory it writes keeps its previous mark in
+		 * the main thread. */
+		DLL_REVTRACER_PUBLIC nodep::DWORD TraceThread(ADDR_TYPE threadProc, void *param);
 	};
 
 };
@@ -39,6 +39,24 @@
 #define RIVER_FAMILY_RIVER_TRACK		0x06
 #define RIVER_FAMILY_REP                0x07
 
+/* Bulk rep pseudo-instruction (RIVER_FAMILY_REP). The low byte of the
+ * specifiers holds the original string opcode. */
+#define RIVER_REP_BULK_OPCODE			0xF1
+#define RIVER_REP_BULK_FORWARD			0x00 // subOpCode
+#define RIVER_REP_BULK_UNDO				0x01 // subOpCode
+#define RIVER_REP_BULK_O16				0x0100 // specifiers
+
+/* Tracking mark (RIVER_FAMILY_TRACK) that is emitted even under advanced
+ * tracking, used to concretize the outputs of instructions that have no
+ * symbolic semantics. */
+#define RIVER_TRACK_MARK_FORCED			0x01 // subOpCode
+
+/* Branch inside a superblock (native jmp/jcc). Execution continues with the
+ * next block of the superblock on the marked path, only the other path exits
+ * to the branch handler. */
+#define RIVER_BRANCH_STAY_TAKEN			0x01 // subOpCode
+#define RIVER_BRANCH_STAY_FALLTHROUGH	0x02 // subOpCode
+
 #define RIVER_FAMILY_FLAG_METAPROCESSED	0x20
 #define RIVER_FAMILY_FLAG_ORIG_xSP		0x40
 #define RIVER_FAMILY_FLAG_IGNORE		0x80
@@ -113,7 +131,20 @@
 
 nodep::BYTE GetFundamentalRegister(nodep::BYTE reg);
 
-/* TODO: add MM0-7 and XMM0-7 */
+/* River xmm registers (SSE2 integer/move subset only) */
+#define RIVER_REG_XMM				0x50
+#define RIVER_REG_XMM0				0x50
+#define RIVER_REG_XMM1				0x51
+#define RIVER_REG_XMM2				0x52
+#define RIVER_REG_XMM3				0x53
+#define RIVER_REG_XMM4				0x54
+#define RIVER_REG_XMM5				0x55
+#define RIVER_REG_XMM6				0x56
+#define RIVER_REG_XMM7				0x57
+
+#define RIVER_REG_IS_XMM(reg) (RIVER_REG_XMM == ((reg) & 0xF8))
+
+/* TODO: add MM0-7 */
 
 /* River void virtual register */
 #define RIVER_REG_NONE				0x20
@@ -155,6 +186,7 @@ union RiverRegister {
 #define RIVER_OPSIZE_32				0x00
 #define RIVER_OPSIZE_16				0x01
 #define RIVER_OPSIZE_8				0x02
+#define RIVER_OPSIZE_128			0x03
 
 /* River operand flags */
 #define RIVER_OPFLAG_IMPLICIT		0x80
@@ -237,6 +269,7 @@ struct RiverInstruction {
 	nodep::BYTE disassFlags, modFlags, testFlags;
 
 	nodep::BYTE opTypes[4];
+	nodep::BYTE liveFlags; // flags that may still be read after this instruction (see RiverFlagsLiveness)
 	union RiverOperand operands[4];
 
 	nodep::DWORD instructionAddress; // relevant only for native and meta instructions
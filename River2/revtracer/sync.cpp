@@ -6,8 +6,12 @@
 #ifdef _MSC_VER
 #include <intrin.h>
 #define LOCK_XCHG(target, value) _InterlockedExchange(target, value)
+#define LOCK_CMPXCHG(target, exchange, comparand) _InterlockedCompareExchange(target, exchange, comparand)
+#define LOCK_XADD(target, value) _InterlockedExchangeAdd(target, value)
 #else
 #define LOCK_XCHG(target, value) ({ asm volatile("xchgl %0, %1" : "+m"(*target) : "r"(value) : "memory"); value; })
+#define LOCK_CMPXCHG(target, exchange, comparand) ({ long __prev = (comparand); asm volatile("lock cmpxchgl %2, %1" : "+a"(__prev), "+m"(*target) : "r"(exchange) : "memory"); __prev; })
+#define LOCK_XADD(target, value) ({ long __prev = (value); asm volatile("lock xaddl %0, %1" : "+r"(__prev), "+m"(*target) : : "memory"); __prev; })
 #endif
 
 RiverMutex::RiverMutex() {
@@ -31,3 +35,21 @@ void RiverMutex::Unlock() {
 	//DbgPrint("UNLOCK %08x\n", mutex);
 	LOCK_XCHG(&mtx, 0);
 }
+
+long RiverAtomicExchange(volatile long *target, long value) {
+#ifdef _MSC_VER
+	return LOCK_XCHG(target, value);
+#else
+	// LOCK_XCHG does not give back the previous value
+	asm volatile("xchgl %0, %1" : "+r"(value), "+m"(*target) : : "memory");
+	return value;
+#endif
+}
+
+long RiverAtomicCompareExchange(volatile long *target, long exchange, long comparand) {
+	return LOCK_CMPXCHG(target, exchange, comparand);
+}
+
+long RiverAtomicAdd(volatile long *target, long value) {
+	return LOCK_XADD(target, value);
+}
@@ -12,4 +12,9 @@ public :
 	void Unlock();
 };
 
+/* Interlocked primitives, they return the previous value of the target */
+long RiverAtomicExchange(volatile long *target, long value);
+long RiverAtomicCompareExchange(volatile long *target, long exchange, long comparand);
+long RiverAtomicAdd(volatile long *target, long value);
+
 #endif
@@ -544,6 +544,9 @@ namespace triton {
 
 
   void API::removeEngines(void) {
+    /* Snapshots refer to the engines */
+    this->snapshots.clear();
+
     if (this->isArchitectureValid()) {
       delete this->irBuilder;
       delete this->solver;
@@ -583,6 +586,96 @@ namespace triton {
   }
 
 
+  triton::arch::RunResult API::run(triton::uint64 pc, const triton::arch::StopConditions& conditions) {
+    this->checkArchitecture();
+    this->checkIrBuilder();
+
+    const triton::arch::Register& pcReg = this->arch.getProgramCounter();
+    triton::arch::RunResult result;
+
+    this->arch.setConcreteRegisterValue(pcReg, pc);
+    result.blocks.push_back(pc);
+
+    while (true) {
+      if (conditions.endAddress && pc == conditions.endAddress) {
+        result.reason = triton::arch::STOP_END_ADDRESS;
+        break;
+      }
+
+      if (pc < conditions.regionBegin || pc > conditions.regionEnd) {
+        result.reason = triton::arch::STOP_REGION_EXIT;
+        break;
+      }
+
+      if (conditions.budget && result.count >= conditions.budget) {
+        result.reason = triton::arch::STOP_BUDGET;
+        break;
+      }
+
+      /* The semantics are built on a copy, the cached instruction stays as disassembled */
+      triton::arch::Instruction inst = this->arch.decode(pc);
+      if (!this->irBuilder->buildSemantics(inst)) {
+        result.reason = triton::arch::STOP_UNSUPPORTED;
+        break;
+      }
+      result.count++;
+
+      pc = this->arch.getConcreteRegisterValue(pcReg).convert_to<triton::uint64>();
+      if (inst.isControlFlow())
+        result.blocks.push_back(pc);
+    }
+
+    result.pc = pc;
+    return result;
+  }
+
+
+
+  /* Snapshot API ================================================================================== */
+
+  triton::usize API::takeSnapshot(void) {
+    this->checkArchitecture();
+    this->checkSymbolic();
+    this->checkTaint();
+
+    Snapshot& snapshot = this->snapshots[this->uniqueSnapshotId];
+
+    /* Memory pages are shared with the snapshot until written */
+    snapshot.cpu = this->arch.copyCpuState();
+
+    snapshot.symbolic.reset(new(std::nothrow) triton::engines::symbolic::SymbolicEngine(*this->symbolic));
+    snapshot.taint.reset(new(std::nothrow) triton::engines::taint::TaintEngine(*this->taint));
+    if (snapshot.symbolic == nullptr || snapshot.taint == nullptr) {
+      this->snapshots.erase(this->uniqueSnapshotId);
+      throw triton::exceptions::API("API::takeSnapshot(): Not enough memory.");
+    }
+
+    return this->uniqueSnapshotId++;
+  }
+
+
+  void API::restoreSnapshot(triton::usize id) {
+    auto it = this->snapshots.find(id);
+    if (it == this->snapshots.end())
+      throw triton::exceptions::API("API::restoreSnapshot(): Snapshot not found.");
+
+    this->arch.restoreCpuState(*it->second.cpu);
+    this->symbolic->restore(*it->second.symbolic);
+    *this->taint = *it->second.taint;
+  }
+
+
+  void API::removeSnapshot(triton::usize id) {
+    if (this->snapshots.erase(id) == 0)
+      throw triton::exceptions::API("API::removeSnapshot(): Snapshot not found.");
+  }
+
+
+  bool API::isSnapshotValid(triton::usize id) const {
+    return (this->snapshots.find(id) != this->snapshots.end());
+  }
+
+
 
   /* IR builder API ================================================================================= */
 
@@ -1033,6 +1126,30 @@ namespace triton {
   }
 
 
+  void API::collectGarbage(void) {
+    this->checkSymbolic();
+    this->symbolic->collectGarbage(true);
+  }
+
+
+  void API::setHistoryLimit(triton::usize limit) {
+    this->checkSymbolic();
+    this->symbolic->setHistoryLimit(limit);
+  }
+
+
+  triton::usize API::getHistoryLimit(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getHistoryLimit();
+  }
+
+
+  triton::engines::symbolic::SymbolicStatistics API::getSymbolicStatistics(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getStatistics();
+  }
+
+
   std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> API::sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
     this->checkSymbolic();
     return this->symbolic->sliceExpressions(expr);
@@ -1142,6 +1259,116 @@ namespace triton {
   }
 
 
+  void API::beginSolverSession(void) {
+    this->checkSolver();
+    this->solver->beginSession();
+  }
+
+
+  void API::endSolverSession(void) {
+    this->checkSolver();
+    this->solver->endSession();
+  }
+
+
+  bool API::isSolverSessionActive(void) const {
+    this->checkSolver();
+    return this->solver->isSessionActive();
+  }
+
+
+  void API::pushSolverScope(void) {
+    this->checkSolver();
+    this->solver->push();
+  }
+
+
+  void API::popSolverScope(void) {
+    this->checkSolver();
+    this->solver->pop();
+  }
+
+
+  void API::assertSolverConstraint(const triton::ast::SharedAbstractNode& node) {
+    this->checkSolver();
+    this->solver->assertConstraint(node);
+  }
+
+
+  std::unordered_map<triton::usize, triton::engines::solver::SolverModel> API::checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status) {
+    this->checkSolver();
+    return this->solver->checkWithAssumptions(assumptions, status);
+  }
+
+
+  std::vector<triton::engines::solver::BranchFlip> API::solveBranchFlips(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::usize startIndex, triton::usize limit, triton::uint32 timeout) {
+    std::vector<triton::engines::solver::BranchFlip> ret;
+
+    this->checkSolver();
+
+    /* A session started by the user is kept as is */
+    bool owned = !this->solver->isSessionActive();
+    triton::uint32 previous = this->solver->getTimeout();
+
+    auto restore = [&](void) {
+      if (owned)
+        this->solver->endSession();
+      else
+        this->solver->pop();
+      if (timeout)
+        this->solver->setTimeout(previous);
+    };
+
+    if (owned)
+      this->solver->beginSession();
+    else
+      this->solver->push();
+
+    try {
+      if (timeout)
+        this->solver->setTimeout(timeout);
+
+      for (triton::usize pcIndex = 0; pcIndex < pathConstraints.size(); pcIndex++) {
+        const auto& pc = pathConstraints[pcIndex];
+
+        if (pcIndex >= startIndex && pc.isMultipleBranches()) {
+          const auto& branches = pc.getBranchConstraints();
+
+          for (triton::usize branchIndex = 0; branchIndex < branches.size(); branchIndex++) {
+            if (std::get<0>(branches[branchIndex]))
+              continue;
+
+            if (limit && ret.size() >= limit)
+              break;
+
+            triton::engines::solver::BranchFlip flip;
+            flip.pcIndex     = pcIndex;
+            flip.branchIndex = branchIndex;
+            flip.srcAddr     = std::get<1>(branches[branchIndex]);
+            flip.dstAddr     = std::get<2>(branches[branchIndex]);
+            flip.model       = this->solver->checkWithAssumptions({std::get<3>(branches[branchIndex])}, &flip.status);
+            ret.push_back(std::move(flip));
+          }
+        }
+
+        if (limit && ret.size() >= limit)
+          break;
+
+        /* The next queries keep the branch taken */
+        this->solver->assertConstraint(pc.getTakenPredicate());
+      }
+    }
+    catch (...) {
+      restore();
+      throw;
+    }
+
+    restore();
+
+    return ret;
+  }
+
+
 
   /* Taint engine API ============================================================================== */
 
@@ -1151,7 +1378,7 @@ namespace triton {
   }
 
 
-  const std::unordered_set<triton::uint64>& API::getTaintedMemory(void) const {
+  std::unordered_set<triton::uint64> API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
@@ -5,11 +5,13 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <cstring>
 #include <new>
 
 #include <triton/aarch64Cpu.hpp>
 #include <triton/architecture.hpp>
 #include <triton/arm32Cpu.hpp>
+#include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/x8664Cpu.hpp>
 #include <triton/x86Cpu.hpp>
@@ -82,6 +84,7 @@ namespace triton {
 
       /* Setup global variables */
       this->arch = arch;
+      this->decodeCache.clear();
     }
 
 
@@ -89,6 +92,65 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::clearArchitecture(): You must define an architecture.");
       this->cpu->clear();
+      this->decodeCache.clear();
+    }
+
+
+    std::unique_ptr<triton::arch::CpuInterface> Architecture::copyCpuState(void) const {
+      std::unique_ptr<triton::arch::CpuInterface> state;
+
+      switch (this->arch) {
+        case triton::arch::ARCH_X86_64:
+          state.reset(new(std::nothrow) triton::arch::x86::x8664Cpu(*static_cast<triton::arch::x86::x8664Cpu*>(this->cpu.get())));
+          break;
+
+        case triton::arch::ARCH_X86:
+          state.reset(new(std::nothrow) triton::arch::x86::x86Cpu(*static_cast<triton::arch::x86::x86Cpu*>(this->cpu.get())));
+          break;
+
+        case triton::arch::ARCH_AARCH64:
+          state.reset(new(std::nothrow) triton::arch::arm::aarch64::AArch64Cpu(*static_cast<triton::arch::arm::aarch64::AArch64Cpu*>(this->cpu.get())));
+          break;
+
+        case triton::arch::ARCH_ARM32:
+          state.reset(new(std::nothrow) triton::arch::arm::arm32::Arm32Cpu(*static_cast<triton::arch::arm::arm32::Arm32Cpu*>(this->cpu.get())));
+          break;
+
+        default:
+          throw triton::exceptions::Architecture("Architecture::copyCpuState(): You must define an architecture.");
+      }
+
+      if (state == nullptr)
+        throw triton::exceptions::Architecture("Architecture::copyCpuState(): Not enough memory.");
+
+      return state;
+    }
+
+
+    void Architecture::restoreCpuState(const triton::arch::CpuInterface& state) {
+      switch (this->arch) {
+        case triton::arch::ARCH_X86_64:
+          *static_cast<triton::arch::x86::x8664Cpu*>(this->cpu.get()) = static_cast<const triton::arch::x86::x8664Cpu&>(state);
+          break;
+
+        case triton::arch::ARCH_X86:
+          *static_cast<triton::arch::x86::x86Cpu*>(this->cpu.get()) = static_cast<const triton::arch::x86::x86Cpu&>(state);
+          break;
+
+        case triton::arch::ARCH_AARCH64:
+          *static_cast<triton::arch::arm::aarch64::AArch64Cpu*>(this->cpu.get()) = static_cast<const triton::arch::arm::aarch64::AArch64Cpu&>(state);
+          break;
+
+        case triton::arch::ARCH_ARM32:
+          *static_cast<triton::arch::arm::arm32::Arm32Cpu*>(this->cpu.get()) = static_cast<const triton::arch::arm::arm32::Arm32Cpu&>(state);
+          break;
+
+        default:
+          throw triton::exceptions::Architecture("Architecture::restoreCpuState(): You must define an architecture.");
+      }
+
+      /* The cached instructions are checked against the restored memory on their next use */
+      this->decodeCache.age();
     }
 
 
@@ -233,6 +295,38 @@ namespace triton {
     }
 
 
+    const triton::arch::Instruction& Architecture::decode(triton::uint64 addr) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::decode(): You must define an architecture.");
+
+      bool stale = false;
+      const triton::arch::Instruction* inst = this->decodeCache.find(addr, stale);
+
+      /* The memory may have changed behind the cache, compare the opcodes once */
+      if (inst != nullptr && stale) {
+        std::vector<triton::uint8> opcodes = this->cpu->getConcreteMemoryAreaValue(addr, inst->getSize(), false);
+        if (std::memcmp(opcodes.data(), inst->getOpcode(), inst->getSize()) == 0)
+          this->decodeCache.refresh(addr);
+        else
+          inst = nullptr;
+      }
+
+      if (inst == nullptr) {
+        std::vector<triton::uint8> opcodes = this->cpu->getConcreteMemoryAreaValue(addr, triton::size::dqword);
+        triton::arch::Instruction tmp(addr, opcodes.data(), static_cast<triton::uint32>(opcodes.size()));
+        this->cpu->disassembly(tmp);
+        inst = &this->decodeCache.insert(tmp);
+      }
+
+      return *inst;
+    }
+
+
+    void Architecture::clearDecodeCache(void) {
+      this->decodeCache.clear();
+    }
+
+
     triton::uint8 Architecture::getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteMemoryValue(): You must define an architecture.");
@@ -265,6 +359,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
       this->cpu->setConcreteMemoryValue(addr, value);
+      this->decodeCache.invalidate(addr, triton::size::byte);
     }
 
 
@@ -272,6 +367,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
       this->cpu->setConcreteMemoryValue(mem, value);
+      this->decodeCache.invalidate(mem.getAddress(), mem.getSize());
     }
 
 
@@ -279,6 +375,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
       this->cpu->setConcreteMemoryAreaValue(baseAddr, values);
+      this->decodeCache.invalidate(baseAddr, values.size());
     }
 
 
@@ -286,6 +383,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
       this->cpu->setConcreteMemoryAreaValue(baseAddr, area, size);
+      this->decodeCache.invalidate(baseAddr, size);
     }
 
 
@@ -314,6 +412,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::clearConcreteMemoryValue(): You must define an architecture.");
       this->cpu->clearConcreteMemoryValue(mem);
+      this->decodeCache.invalidate(mem.getAddress(), mem.getSize());
     }
 
 
@@ -321,6 +420,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::clearConcreteMemoryValue(): You must define an architecture.");
       this->cpu->clearConcreteMemoryValue(baseAddr, size);
+      this->decodeCache.invalidate(baseAddr, size);
     }
 
   }; /* arch namespace */
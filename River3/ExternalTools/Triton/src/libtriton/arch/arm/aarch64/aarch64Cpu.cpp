@@ -32,7 +32,10 @@ namespace triton {
 
 
         AArch64Cpu::AArch64Cpu(const AArch64Cpu& other) : AArch64Specifications(ARCH_AARCH64) {
+          this->handle = 0;
+
           this->copy(other);
+          this->disassInit();
         }
 
 
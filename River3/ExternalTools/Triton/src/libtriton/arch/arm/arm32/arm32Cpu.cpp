@@ -35,7 +35,11 @@ namespace triton {
 
 
         Arm32Cpu::Arm32Cpu(const Arm32Cpu& other) : Arm32Specifications(ARCH_ARM32) {
+          this->handle_arm   = 0;
+          this->handle_thumb = 0;
+
           this->copy(other);
+          this->disassInit();
         }
 
 
@@ -79,6 +83,7 @@ namespace triton {
         void Arm32Cpu::copy(const Arm32Cpu& other) {
           this->callbacks = other.callbacks;
           this->memory    = other.memory;
+          this->thumb     = other.thumb;
 
           std::memcpy(this->r0,   other.r0,   sizeof(this->r0));
           std::memcpy(this->r1,   other.r1,   sizeof(this->r1));
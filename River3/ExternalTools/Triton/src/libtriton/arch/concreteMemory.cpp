@@ -0,0 +1,227 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include <triton/concreteMemory.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    ConcreteMemory::Page::Page() {
+      std::memset(this->data, 0x00, sizeof(this->data));
+      std::memset(this->defined, 0x00, sizeof(this->defined));
+      this->count = 0;
+    }
+
+
+    ConcreteMemory::ConcreteMemory() {
+      this->count = 0;
+      this->invalidate();
+    }
+
+
+    ConcreteMemory::ConcreteMemory(const ConcreteMemory& other) {
+      this->pages = other.pages;
+      this->count = other.count;
+      this->invalidate();
+      /* The pages of other are shared from now on */
+      other.lastWritable = false;
+    }
+
+
+    ConcreteMemory& ConcreteMemory::operator=(const ConcreteMemory& other) {
+      if (this != &other) {
+        this->pages = other.pages;
+        this->count = other.count;
+        this->invalidate();
+        other.lastWritable = false;
+      }
+      return *this;
+    }
+
+
+    void ConcreteMemory::invalidate(void) const {
+      this->lastIndex    = 0;
+      this->lastPage     = nullptr;
+      this->lastWritable = false;
+    }
+
+
+    void ConcreteMemory::clear(void) {
+      this->pages.clear();
+      this->count = 0;
+      this->invalidate();
+    }
+
+
+    const ConcreteMemory::Page* ConcreteMemory::getPage(triton::uint64 index) const {
+      if (this->lastPage && this->lastIndex == index)
+        return this->lastPage;
+
+      auto it = this->pages.find(index);
+      if (it == this->pages.end())
+        return nullptr;
+
+      this->lastIndex    = index;
+      this->lastPage     = it->second.get();
+      this->lastWritable = false;
+
+      return this->lastPage;
+    }
+
+
+    ConcreteMemory::Page* ConcreteMemory::getWritablePage(triton::uint64 index) {
+      if (this->lastPage && this->lastWritable && this->lastIndex == index)
+        return this->lastPage;
+
+      std::shared_ptr<Page>& page = this->pages[index];
+      if (page == nullptr)
+        page = std::make_shared<Page>();
+
+      /* Copy-on-write */
+      else if (page.use_count() > 1)
+        page = std::make_shared<Page>(*page);
+
+      this->lastIndex    = index;
+      this->lastPage     = page.get();
+      this->lastWritable = true;
+
+      return this->lastPage;
+    }
+
+
+    triton::uint8 ConcreteMemory::getByte(triton::uint64 addr) const {
+      const Page* page = this->getPage(addr / CONCRETE_PAGE_SIZE);
+
+      if (page == nullptr)
+        return 0x00;
+
+      return page->data[addr % CONCRETE_PAGE_SIZE];
+    }
+
+
+    void ConcreteMemory::setByte(triton::uint64 addr, triton::uint8 value) {
+      this->setArea(addr, &value, 1);
+    }
+
+
+    void ConcreteMemory::getArea(triton::uint64 baseAddr, triton::uint8* area, triton::usize size) const {
+      while (size) {
+        triton::usize offset = baseAddr % CONCRETE_PAGE_SIZE;
+        triton::usize chunk  = std::min<triton::usize>(size, CONCRETE_PAGE_SIZE - offset);
+        const Page* page     = this->getPage(baseAddr / CONCRETE_PAGE_SIZE);
+
+        /* The bytes that are not defined are 0 in a page */
+        if (page == nullptr)
+          std::memset(area, 0x00, chunk);
+        else
+          std::memcpy(area, page->data + offset, chunk);
+
+        baseAddr += chunk;
+        area     += chunk;
+        size     -= chunk;
+      }
+    }
+
+
+    void ConcreteMemory::setArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+      while (size) {
+        triton::usize offset = baseAddr % CONCRETE_PAGE_SIZE;
+        triton::usize chunk  = std::min<triton::usize>(size, CONCRETE_PAGE_SIZE - offset);
+        Page* page           = this->getWritablePage(baseAddr / CONCRETE_PAGE_SIZE);
+
+        std::memcpy(page->data + offset, area, chunk);
+
+        if (page->count != CONCRETE_PAGE_SIZE) {
+          for (triton::usize i = offset; i < offset + chunk; i++) {
+            triton::uint64 bit = (1ULL << (i % 64));
+            if ((page->defined[i / 64] & bit) == 0) {
+              page->defined[i / 64] |= bit;
+              page->count++;
+              this->count++;
+            }
+          }
+        }
+
+        baseAddr += chunk;
+        area     += chunk;
+        size     -= chunk;
+      }
+    }
+
+
+    bool ConcreteMemory::isDefined(triton::uint64 baseAddr, triton::usize size) const {
+      while (size) {
+        triton::usize offset = baseAddr % CONCRETE_PAGE_SIZE;
+        triton::usize chunk  = std::min<triton::usize>(size, CONCRETE_PAGE_SIZE - offset);
+        const Page* page     = this->getPage(baseAddr / CONCRETE_PAGE_SIZE);
+
+        if (page == nullptr)
+          return false;
+
+        if (page->count != CONCRETE_PAGE_SIZE) {
+          for (triton::usize i = offset; i < offset + chunk; i++) {
+            if ((page->defined[i / 64] & (1ULL << (i % 64))) == 0)
+              return false;
+          }
+        }
+
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+
+      return true;
+    }
+
+
+    void ConcreteMemory::clearArea(triton::uint64 baseAddr, triton::usize size) {
+      while (size) {
+        triton::usize offset = baseAddr % CONCRETE_PAGE_SIZE;
+        triton::usize chunk  = std::min<triton::usize>(size, CONCRETE_PAGE_SIZE - offset);
+        triton::uint64 index = baseAddr / CONCRETE_PAGE_SIZE;
+
+        if (this->getPage(index) != nullptr) {
+          Page* page = this->getWritablePage(index);
+
+          for (triton::usize i = offset; i < offset + chunk; i++) {
+            triton::uint64 bit = (1ULL << (i % 64));
+            if (page->defined[i / 64] & bit) {
+              page->defined[i / 64] &= ~bit;
+              page->data[i] = 0x00;
+              page->count--;
+              this->count--;
+            }
+          }
+
+          /* Pages without defined bytes are released */
+          if (page->count == 0) {
+            this->pages.erase(index);
+            this->invalidate();
+          }
+        }
+
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+    }
+
+
+    triton::usize ConcreteMemory::size(void) const {
+      return this->count;
+    }
+
+
+    triton::usize ConcreteMemory::getPageCount(void) const {
+      return this->pages.size();
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -0,0 +1,128 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/decodeCache.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    DecodeCache::DecodeCache() {
+      this->epoch = 0;
+    }
+
+
+    const triton::arch::Instruction* DecodeCache::find(triton::uint64 addr, bool& stale) const {
+      auto it = this->instructions.find(addr);
+      if (it == this->instructions.end())
+        return nullptr;
+
+      stale = (it->second.epoch != this->epoch);
+      return &it->second.inst;
+    }
+
+
+    const triton::arch::Instruction& DecodeCache::insert(const triton::arch::Instruction& inst) {
+      triton::uint64 addr = inst.getAddress();
+
+      /* An older instruction at the same address is replaced */
+      this->remove(addr, DECODE_NO_PAGE);
+
+      Entry& entry = this->instructions[addr];
+      entry.inst   = inst;
+      entry.epoch  = this->epoch;
+
+      /* An instruction may lie on two pages */
+      for (triton::uint64 page = this->firstPage(entry.inst); page <= this->lastPage(entry.inst); page++)
+        this->pages[page].push_back(addr);
+
+      return entry.inst;
+    }
+
+
+    void DecodeCache::refresh(triton::uint64 addr) {
+      auto it = this->instructions.find(addr);
+      if (it != this->instructions.end())
+        it->second.epoch = this->epoch;
+    }
+
+
+    void DecodeCache::remove(triton::uint64 addr, triton::uint64 skipPage) {
+      auto it = this->instructions.find(addr);
+      if (it == this->instructions.end())
+        return;
+
+      for (triton::uint64 page = this->firstPage(it->second.inst); page <= this->lastPage(it->second.inst); page++) {
+        if (page == skipPage)
+          continue;
+
+        auto pit = this->pages.find(page);
+        if (pit == this->pages.end())
+          continue;
+
+        pit->second.erase(std::remove(pit->second.begin(), pit->second.end(), addr), pit->second.end());
+        if (pit->second.empty())
+          this->pages.erase(pit);
+      }
+
+      this->instructions.erase(it);
+    }
+
+
+    triton::uint64 DecodeCache::firstPage(const triton::arch::Instruction& inst) const {
+      return inst.getAddress() / DECODE_PAGE_SIZE;
+    }
+
+
+    triton::uint64 DecodeCache::lastPage(const triton::arch::Instruction& inst) const {
+      return (inst.getAddress() + std::max<triton::uint32>(inst.getSize(), 1) - 1) / DECODE_PAGE_SIZE;
+    }
+
+
+    void DecodeCache::invalidate(triton::uint64 baseAddr, triton::usize size) {
+      /* Most writes are done while no code is cached */
+      if (this->pages.empty() || size == 0)
+        return;
+
+      triton::uint64 first = baseAddr / DECODE_PAGE_SIZE;
+      triton::uint64 last  = (baseAddr + size - 1) / DECODE_PAGE_SIZE;
+
+      for (triton::uint64 page = first; page <= last; page++) {
+        auto it = this->pages.find(page);
+        if (it == this->pages.end())
+          continue;
+
+        /* The whole page goes, only the neighbour page of an overlapping instruction is updated */
+        std::vector<triton::uint64> addrs = std::move(it->second);
+        this->pages.erase(it);
+
+        for (triton::uint64 addr : addrs)
+          this->remove(addr, page);
+      }
+    }
+
+
+    void DecodeCache::age(void) {
+      this->epoch++;
+    }
+
+
+    void DecodeCache::clear(void) {
+      this->instructions.clear();
+      this->pages.clear();
+    }
+
+
+    triton::usize DecodeCache::size(void) const {
+      return this->instructions.size();
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
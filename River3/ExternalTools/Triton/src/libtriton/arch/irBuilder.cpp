@@ -15,6 +15,7 @@
 #include <triton/memoryAccess.hpp>
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
 #include <triton/x86Semantics.hpp>
 
 
@@ -45,8 +46,9 @@ namespace triton {
       this->aarch64Isa                = new(std::nothrow) triton::arch::arm::aarch64::AArch64Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
       this->arm32Isa                  = new(std::nothrow) triton::arch::arm::arm32::Arm32Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
       this->x86Isa                    = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine, modes, astCtxt);
+      this->x86ConcreteIsa            = new(std::nothrow) triton::arch::x86::x86ConcreteSemantics(architecture, symbolicEngine, taintEngine);
 
-      if (this->x86Isa == nullptr || this->aarch64Isa == nullptr || this->backupSymbolicEngine == nullptr)
+      if (this->x86Isa == nullptr || this->x86ConcreteIsa == nullptr || this->aarch64Isa == nullptr || this->backupSymbolicEngine == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
 
@@ -56,6 +58,7 @@ namespace triton {
       delete this->aarch64Isa;
       delete this->arm32Isa;
       delete this->x86Isa;
+      delete this->x86ConcreteIsa;
     }
 
 
@@ -66,6 +69,12 @@ namespace triton {
       if (arch == triton::arch::ARCH_INVALID)
         throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): You must define an architecture.");
 
+      /* Concrete execution of the instructions handled without AST */
+      if (this->modes->isModeEnabled(triton::modes::CONCRETE_ONLY)) {
+        if ((arch == triton::arch::ARCH_X86 || arch == triton::arch::ARCH_X86_64) && this->x86ConcreteIsa->buildSemantics(inst))
+          return true;
+      }
+
       /* Initialize the target address of memory operands */
       for (auto& operand : inst.operands) {
         if (operand.getType() == triton::arch::OP_MEM) {
@@ -231,6 +240,9 @@ namespace triton {
       }
 
       this->astCtxt->garbage();
+
+      /* Applies the history limit of the symbolic engine */
+      this->symbolicEngine->collectGarbage();
     }
 
 
@@ -0,0 +1,826 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <bitset>
+
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
+#include <triton/x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      /* Returns the mask of the `bits` lowest bits */
+      static inline triton::uint64 bitMask(triton::uint32 bits) {
+        return (bits >= triton::bitsize::qword) ? ~static_cast<triton::uint64>(0) : ((static_cast<triton::uint64>(1) << bits) - 1);
+      }
+
+
+      /* Returns the most significant bit of a `bits` value */
+      static inline bool msb(triton::uint64 value, triton::uint32 bits) {
+        return (value >> (bits - 1)) & 1;
+      }
+
+
+      /* Sign extends a `bits` value to 64 bits */
+      static inline triton::uint64 signExtend(triton::uint64 value, triton::uint32 bits) {
+        value &= bitMask(bits);
+        if (bits < triton::bitsize::qword && msb(value, bits))
+          value |= ~bitMask(bits);
+        return value;
+      }
+
+
+      x86ConcreteSemantics::x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                                 triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                                 triton::engines::taint::TaintEngine* taintEngine) {
+
+        this->architecture    = architecture;
+        this->symbolicEngine  = symbolicEngine;
+        this->taintEngine     = taintEngine;
+
+        if (architecture == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The architecture API must be defined.");
+
+        if (this->symbolicEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The symbolic engine API must be defined.");
+
+        if (this->taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The taint engines API must be defined.");
+      }
+
+
+      bool x86ConcreteSemantics::buildSemantics(triton::arch::Instruction& inst) {
+        if (!this->isSupported(inst))
+          return false;
+
+        /* Clear previous semantics, nothing is recorded by the concrete execution */
+        inst.symbolicExpressions.clear();
+        inst.getLoadAccess().clear();
+        inst.getReadRegisters().clear();
+        inst.getReadImmediates().clear();
+        inst.getStoreAccess().clear();
+        inst.getWrittenRegisters().clear();
+
+        /* Update instruction address if undefined */
+        if (!inst.getAddress())
+          inst.setAddress(this->read(this->architecture->getProgramCounter()));
+
+        /* Initialize the target address of memory operands */
+        if (inst.getType() != ID_INS_LEA && inst.getType() != ID_INS_NOP) {
+          for (auto& operand : inst.operands) {
+            if (operand.getType() == triton::arch::OP_MEM)
+              this->initAddress(operand.getMemory());
+          }
+        }
+
+        switch (inst.getType()) {
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_CMP:
+          case ID_INS_OR:
+          case ID_INS_SUB:
+          case ID_INS_TEST:
+          case ID_INS_XOR:
+            this->binary_c(inst);
+            break;
+
+          case ID_INS_CALL:
+            this->call_c(inst);
+            break;
+
+          case ID_INS_CMOVA:
+          case ID_INS_CMOVAE:
+          case ID_INS_CMOVB:
+          case ID_INS_CMOVBE:
+          case ID_INS_CMOVE:
+          case ID_INS_CMOVG:
+          case ID_INS_CMOVGE:
+          case ID_INS_CMOVL:
+          case ID_INS_CMOVLE:
+          case ID_INS_CMOVNE:
+          case ID_INS_CMOVNO:
+          case ID_INS_CMOVNP:
+          case ID_INS_CMOVNS:
+          case ID_INS_CMOVO:
+          case ID_INS_CMOVP:
+          case ID_INS_CMOVS:
+            this->cmov_c(inst);
+            break;
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+            this->incDec_c(inst);
+            break;
+
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+            this->jcc_c(inst);
+            break;
+
+          case ID_INS_JMP:
+            this->jmp_c(inst);
+            break;
+
+          case ID_INS_LEA:
+            this->lea_c(inst);
+            break;
+
+          case ID_INS_LEAVE:
+            this->leave_c(inst);
+            break;
+
+          case ID_INS_MOV:
+          case ID_INS_MOVABS:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+            this->mov_c(inst);
+            break;
+
+          case ID_INS_NEG:
+            this->neg_c(inst);
+            break;
+
+          case ID_INS_NOP:
+            this->setPc(inst.getNextAddress());
+            break;
+
+          case ID_INS_NOT:
+            this->not_c(inst);
+            break;
+
+          case ID_INS_POP:
+            this->pop_c(inst);
+            break;
+
+          case ID_INS_PUSH:
+            this->push_c(inst);
+            break;
+
+          case ID_INS_RET:
+            this->ret_c(inst);
+            break;
+
+          case ID_INS_SETA:
+          case ID_INS_SETAE:
+          case ID_INS_SETB:
+          case ID_INS_SETBE:
+          case ID_INS_SETE:
+          case ID_INS_SETG:
+          case ID_INS_SETGE:
+          case ID_INS_SETL:
+          case ID_INS_SETLE:
+          case ID_INS_SETNE:
+          case ID_INS_SETNO:
+          case ID_INS_SETNP:
+          case ID_INS_SETNS:
+          case ID_INS_SETO:
+          case ID_INS_SETP:
+          case ID_INS_SETS:
+            this->set_c(inst);
+            break;
+
+          case ID_INS_SAL:
+          case ID_INS_SAR:
+          case ID_INS_SHL:
+          case ID_INS_SHR:
+            this->shift_c(inst);
+            break;
+
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::buildSemantics(): Unexpected instruction.");
+        }
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::isSupported(const triton::arch::Instruction& inst) const {
+        const auto& operands = inst.operands;
+        triton::usize count  = operands.size();
+
+        /* REP prefixes change the control flow */
+        if (inst.getPrefix() != ID_PREFIX_INVALID)
+          return false;
+
+        switch (inst.getType()) {
+          /* The operands of a NOP are never accessed */
+          case ID_INS_NOP:
+          case ID_INS_LEAVE:
+            return true;
+
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_CMP:
+          case ID_INS_OR:
+          case ID_INS_SUB:
+          case ID_INS_TEST:
+          case ID_INS_XOR:
+          case ID_INS_CMOVA:
+          case ID_INS_CMOVAE:
+          case ID_INS_CMOVB:
+          case ID_INS_CMOVBE:
+          case ID_INS_CMOVE:
+          case ID_INS_CMOVG:
+          case ID_INS_CMOVGE:
+          case ID_INS_CMOVL:
+          case ID_INS_CMOVLE:
+          case ID_INS_CMOVNE:
+          case ID_INS_CMOVNO:
+          case ID_INS_CMOVNP:
+          case ID_INS_CMOVNS:
+          case ID_INS_CMOVO:
+          case ID_INS_CMOVP:
+          case ID_INS_CMOVS:
+          case ID_INS_MOV:
+          case ID_INS_MOVABS:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+          case ID_INS_SAL:
+          case ID_INS_SAR:
+          case ID_INS_SHL:
+          case ID_INS_SHR:
+            return count == 2 && operands[0].getType() != triton::arch::OP_IMM && this->isSupported(operands[0]) && this->isSupported(operands[1]);
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+          case ID_INS_NEG:
+          case ID_INS_NOT:
+          case ID_INS_SETA:
+          case ID_INS_SETAE:
+          case ID_INS_SETB:
+          case ID_INS_SETBE:
+          case ID_INS_SETE:
+          case ID_INS_SETG:
+          case ID_INS_SETGE:
+          case ID_INS_SETL:
+          case ID_INS_SETLE:
+          case ID_INS_SETNE:
+          case ID_INS_SETNO:
+          case ID_INS_SETNP:
+          case ID_INS_SETNS:
+          case ID_INS_SETO:
+          case ID_INS_SETP:
+          case ID_INS_SETS:
+            return count == 1 && operands[0].getType() != triton::arch::OP_IMM && this->isSupported(operands[0]);
+
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+            return count == 1 && operands[0].getType() == triton::arch::OP_IMM;
+
+          case ID_INS_CALL:
+          case ID_INS_JMP:
+          case ID_INS_PUSH:
+            return count == 1 && this->isSupported(operands[0]);
+
+          /* The address of a memory destination depends on the new stack pointer */
+          case ID_INS_POP:
+            return count == 1 && operands[0].getType() == triton::arch::OP_REG && this->isSupported(operands[0]);
+
+          case ID_INS_RET:
+            return count == 0 || (count == 1 && operands[0].getType() == triton::arch::OP_IMM);
+
+          case ID_INS_LEA:
+            return count == 2 && operands[0].getType() == triton::arch::OP_REG && this->isSupported(operands[0]) && operands[1].getType() == triton::arch::OP_MEM;
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::isSupported(const triton::arch::OperandWrapper& op) const {
+        if (op.getBitSize() > triton::bitsize::qword)
+          return false;
+
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            return true;
+
+          case triton::arch::OP_REG:
+            return this->isGPR(op.getConstRegister());
+
+          case triton::arch::OP_MEM:
+            return op.getBitSize() >= triton::bitsize::byte;
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::isGPR(const triton::arch::Register& reg) const {
+        triton::arch::register_e id = reg.getId();
+        return id >= ID_REG_X86_RAX && id < ID_REG_X86_EFLAGS && this->architecture->isRegisterValid(id);
+      }
+
+
+      void x86ConcreteSemantics::initAddress(triton::arch::MemoryAccess& mem) const {
+        /* Initialize the address only if it is not already defined */
+        if (mem.getAddress())
+          return;
+
+        const triton::arch::Register& base  = mem.getConstBaseRegister();
+        const triton::arch::Register& index = mem.getConstIndexRegister();
+        const triton::arch::Register& seg   = mem.getConstSegmentRegister();
+        triton::uint64 segmentValue         = (this->architecture->isRegisterValid(seg) ? this->read(seg) : 0);
+        triton::uint32 bitSize              = (this->architecture->isRegisterValid(base) ? base.getBitSize() :
+                                                (this->architecture->isRegisterValid(index) ? index.getBitSize() :
+                                                  (mem.getConstDisplacement().getBitSize() ? mem.getConstDisplacement().getBitSize() :
+                                                    this->architecture->gprBitSize()
+                                                  )
+                                                )
+                                              );
+
+        /* (pc + base) + (index * scale) + disp */
+        triton::uint64 address = mem.getPcRelative() ? mem.getPcRelative() : (this->architecture->isRegisterValid(base) ? this->read(base) : 0);
+        triton::uint64 scaled  = (this->architecture->isRegisterValid(index) ? this->read(index) : 0) * mem.getConstScale().getValue();
+
+        address = index.isSubtracted() ? address - scaled : address + scaled;
+        address = (address + mem.getConstDisplacement().getValue()) & bitMask(bitSize);
+
+        /* Use segments as base address instead of selector into the GDT. */
+        if (segmentValue)
+          address = (segmentValue + signExtend(address, bitSize)) & bitMask(seg.getBitSize());
+
+        mem.setAddress(address);
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::read(const triton::arch::OperandWrapper& op) const {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM: return op.getConstImmediate().getValue();
+          case triton::arch::OP_MEM: return this->architecture->getConcreteMemoryValue(op.getConstMemory()).convert_to<triton::uint64>();
+          case triton::arch::OP_REG: return this->read(op.getConstRegister());
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::read(): Invalid operand.");
+        }
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::read(const triton::arch::Register& reg) const {
+        return this->architecture->getConcreteRegisterValue(reg).convert_to<triton::uint64>();
+      }
+
+
+      void x86ConcreteSemantics::write(const triton::arch::OperandWrapper& op, triton::uint64 value) {
+        switch (op.getType()) {
+          case triton::arch::OP_MEM: this->write(op.getConstMemory(), value);   break;
+          case triton::arch::OP_REG: this->write(op.getConstRegister(), value); break;
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::write(): Invalid operand.");
+        }
+      }
+
+
+      void x86ConcreteSemantics::write(const triton::arch::Register& reg, triton::uint64 value) {
+        const triton::arch::Register& parent = this->architecture->getParentRegister(reg);
+
+        if (!parent.isMutable())
+          return;
+
+        /* As the symbolic semantics, a 32-bit register is zero extended into its parent */
+        if (reg.getSize() == triton::size::dword)
+          this->architecture->setConcreteRegisterValue(parent, value & bitMask(triton::bitsize::dword));
+        else
+          this->architecture->setConcreteRegisterValue(reg, value & bitMask(reg.getBitSize()));
+
+        this->symbolicEngine->concretizeRegister(reg);
+        this->taintEngine->untaintRegister(reg);
+      }
+
+
+      void x86ConcreteSemantics::write(const triton::arch::MemoryAccess& mem, triton::uint64 value) {
+        this->architecture->setConcreteMemoryValue(mem, value & bitMask(mem.getBitSize()));
+        this->symbolicEngine->concretizeMemory(mem);
+        this->taintEngine->untaintMemory(mem);
+      }
+
+
+      bool x86ConcreteSemantics::getFlag(triton::arch::register_e flag) const {
+        return this->read(this->architecture->getRegister(flag)) != 0;
+      }
+
+
+      void x86ConcreteSemantics::setFlag(triton::arch::register_e flag, bool value) {
+        const triton::arch::Register& reg = this->architecture->getRegister(flag);
+
+        if (!reg.isMutable())
+          return;
+
+        this->architecture->setConcreteRegisterValue(reg, value ? 1 : 0);
+        this->symbolicEngine->concretizeRegister(reg);
+        this->taintEngine->untaintRegister(reg);
+      }
+
+
+      void x86ConcreteSemantics::setResultFlags(triton::uint64 res, triton::uint32 bits) {
+        res &= bitMask(bits);
+        this->setFlag(ID_REG_X86_PF, (std::bitset<triton::bitsize::byte>(res).count() & 1) == 0);
+        this->setFlag(ID_REG_X86_SF, msb(res, bits));
+        this->setFlag(ID_REG_X86_ZF, res == 0);
+      }
+
+
+      bool x86ConcreteSemantics::condition(const triton::arch::Instruction& inst) const {
+        switch (inst.getType()) {
+          case ID_INS_CMOVA:  case ID_INS_JA:  case ID_INS_SETA:  return !this->getFlag(ID_REG_X86_CF) && !this->getFlag(ID_REG_X86_ZF);
+          case ID_INS_CMOVAE: case ID_INS_JAE: case ID_INS_SETAE: return !this->getFlag(ID_REG_X86_CF);
+          case ID_INS_CMOVB:  case ID_INS_JB:  case ID_INS_SETB:  return this->getFlag(ID_REG_X86_CF);
+          case ID_INS_CMOVBE: case ID_INS_JBE: case ID_INS_SETBE: return this->getFlag(ID_REG_X86_CF) || this->getFlag(ID_REG_X86_ZF);
+          case ID_INS_CMOVE:  case ID_INS_JE:  case ID_INS_SETE:  return this->getFlag(ID_REG_X86_ZF);
+          case ID_INS_CMOVG:  case ID_INS_JG:  case ID_INS_SETG:  return this->getFlag(ID_REG_X86_SF) == this->getFlag(ID_REG_X86_OF) && !this->getFlag(ID_REG_X86_ZF);
+          case ID_INS_CMOVGE: case ID_INS_JGE: case ID_INS_SETGE: return this->getFlag(ID_REG_X86_SF) == this->getFlag(ID_REG_X86_OF);
+          case ID_INS_CMOVL:  case ID_INS_JL:  case ID_INS_SETL:  return this->getFlag(ID_REG_X86_SF) != this->getFlag(ID_REG_X86_OF);
+          case ID_INS_CMOVLE: case ID_INS_JLE: case ID_INS_SETLE: return this->getFlag(ID_REG_X86_SF) != this->getFlag(ID_REG_X86_OF) || this->getFlag(ID_REG_X86_ZF);
+          case ID_INS_CMOVNE: case ID_INS_JNE: case ID_INS_SETNE: return !this->getFlag(ID_REG_X86_ZF);
+          case ID_INS_CMOVNO: case ID_INS_JNO: case ID_INS_SETNO: return !this->getFlag(ID_REG_X86_OF);
+          case ID_INS_CMOVNP: case ID_INS_JNP: case ID_INS_SETNP: return !this->getFlag(ID_REG_X86_PF);
+          case ID_INS_CMOVNS: case ID_INS_JNS: case ID_INS_SETNS: return !this->getFlag(ID_REG_X86_SF);
+          case ID_INS_CMOVO:  case ID_INS_JO:  case ID_INS_SETO:  return this->getFlag(ID_REG_X86_OF);
+          case ID_INS_CMOVP:  case ID_INS_JP:  case ID_INS_SETP:  return this->getFlag(ID_REG_X86_PF);
+          case ID_INS_CMOVS:  case ID_INS_JS:  case ID_INS_SETS:  return this->getFlag(ID_REG_X86_SF);
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::condition(): Invalid instruction.");
+        }
+      }
+
+
+      void x86ConcreteSemantics::setPc(triton::uint64 value) {
+        this->write(this->architecture->getProgramCounter(), value);
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::alignStack(triton::sint64 delta) {
+        const triton::arch::Register& stack = this->architecture->getStackPointer();
+        triton::uint64 value = (this->read(stack) + delta) & bitMask(stack.getBitSize());
+
+        this->write(stack, value);
+        return value;
+      }
+
+
+      void x86ConcreteSemantics::binary_c(triton::arch::Instruction& inst) {
+        auto& dst           = inst.operands[0];
+        auto& src           = inst.operands[1];
+        triton::uint32 bits = dst.getBitSize();
+        triton::uint64 op1  = this->read(dst);
+        triton::uint64 op2  = this->read(src);
+        triton::uint64 res  = 0;
+
+        /* CMP sign extends its source */
+        if (inst.getType() == ID_INS_CMP)
+          op2 = signExtend(op2, src.getBitSize());
+
+        op1 &= bitMask(bits);
+        op2 &= bitMask(bits);
+
+        switch (inst.getType()) {
+          case ID_INS_ADD:
+            res = (op1 + op2) & bitMask(bits);
+            this->setFlag(ID_REG_X86_AF, ((res ^ op1 ^ op2) & 0x10) != 0);
+            this->setFlag(ID_REG_X86_CF, msb((op1 & op2) ^ ((op1 ^ op2 ^ res) & (op1 ^ op2)), bits));
+            this->setFlag(ID_REG_X86_OF, msb((op1 ^ ~op2) & (op1 ^ res), bits));
+            break;
+
+          case ID_INS_CMP:
+          case ID_INS_SUB:
+            res = (op1 - op2) & bitMask(bits);
+            this->setFlag(ID_REG_X86_AF, ((res ^ op1 ^ op2) & 0x10) != 0);
+            this->setFlag(ID_REG_X86_CF, msb((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)), bits));
+            this->setFlag(ID_REG_X86_OF, msb((op1 ^ op2) & (op1 ^ res), bits));
+            break;
+
+          /* AF is undefined and keeps its value */
+          case ID_INS_AND:
+          case ID_INS_TEST:
+            res = op1 & op2;
+            this->setFlag(ID_REG_X86_CF, false);
+            this->setFlag(ID_REG_X86_OF, false);
+            break;
+
+          case ID_INS_OR:
+            res = op1 | op2;
+            this->setFlag(ID_REG_X86_CF, false);
+            this->setFlag(ID_REG_X86_OF, false);
+            break;
+
+          case ID_INS_XOR:
+            res = op1 ^ op2;
+            this->setFlag(ID_REG_X86_CF, false);
+            this->setFlag(ID_REG_X86_OF, false);
+            break;
+
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::binary_c(): Invalid instruction.");
+        }
+
+        this->setResultFlags(res, bits);
+
+        if (inst.getType() != ID_INS_CMP && inst.getType() != ID_INS_TEST)
+          this->write(dst, res);
+
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::call_c(triton::arch::Instruction& inst) {
+        const triton::arch::Register& stack = this->architecture->getStackPointer();
+
+        /* As the symbolic semantics, the target is read once the stack is aligned */
+        triton::uint64 sp     = this->alignStack(-static_cast<triton::sint64>(stack.getSize()));
+        triton::uint64 target = this->read(inst.operands[0]);
+
+        this->write(triton::arch::MemoryAccess(sp, stack.getSize()), inst.getNextAddress());
+        this->setPc(target);
+      }
+
+
+      void x86ConcreteSemantics::cmov_c(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        /* The destination is written even if the condition is false */
+        if (this->condition(inst)) {
+          this->write(dst, this->read(src));
+          inst.setConditionTaken(true);
+        }
+        else {
+          this->write(dst, this->read(dst));
+        }
+
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::incDec_c(triton::arch::Instruction& inst) {
+        auto& dst           = inst.operands[0];
+        triton::uint32 bits = dst.getBitSize();
+        triton::uint64 op1  = this->read(dst) & bitMask(bits);
+        triton::uint64 res  = 0;
+
+        /* CF is not affected */
+        if (inst.getType() == ID_INS_INC) {
+          res = (op1 + 1) & bitMask(bits);
+          this->setFlag(ID_REG_X86_OF, msb((op1 ^ ~static_cast<triton::uint64>(1)) & (op1 ^ res), bits));
+        }
+        else {
+          res = (op1 - 1) & bitMask(bits);
+          this->setFlag(ID_REG_X86_OF, msb((op1 ^ 1) & (op1 ^ res), bits));
+        }
+
+        this->setFlag(ID_REG_X86_AF, ((res ^ op1 ^ 1) & 0x10) != 0);
+        this->setResultFlags(res, bits);
+        this->write(dst, res);
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::jcc_c(triton::arch::Instruction& inst) {
+        if (this->condition(inst)) {
+          inst.setConditionTaken(true);
+          this->setPc(inst.operands[0].getConstImmediate().getValue());
+        }
+        else {
+          this->setPc(inst.getNextAddress());
+        }
+      }
+
+
+      void x86ConcreteSemantics::jmp_c(triton::arch::Instruction& inst) {
+        inst.setConditionTaken(true);
+        this->setPc(this->read(inst.operands[0]));
+      }
+
+
+      void x86ConcreteSemantics::lea_c(triton::arch::Instruction& inst) {
+        const auto& dst          = inst.operands[0].getConstRegister();
+        const auto& mem          = inst.operands[1].getConstMemory();
+        const auto& srcBase      = mem.getConstBaseRegister();
+        const auto& srcIndex     = mem.getConstIndexRegister();
+        triton::uint32 leaSize   = 0;
+        triton::uint64 value     = mem.getConstDisplacement().getValue();
+
+        /* Setup LEA size */
+        if (this->architecture->isRegisterValid(srcBase))
+          leaSize = srcBase.getBitSize();
+        else if (this->architecture->isRegisterValid(srcIndex))
+          leaSize = srcIndex.getBitSize();
+        else
+          leaSize = mem.getConstDisplacement().getBitSize();
+
+        /* Effective address = Displacement + BaseReg + IndexReg * Scale */
+        if (this->architecture->isRegisterValid(srcBase)) {
+          value += this->read(srcBase);
+          /* Base with PC */
+          if (this->architecture->getParentRegister(srcBase) == this->architecture->getProgramCounter())
+            value += inst.getSize();
+        }
+
+        if (this->architecture->isRegisterValid(srcIndex))
+          value += this->read(srcIndex) * mem.getConstScale().getValue();
+
+        this->write(dst, value & bitMask(leaSize));
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::leave_c(triton::arch::Instruction& inst) {
+        const triton::arch::Register& stack = this->architecture->getStackPointer();
+        const triton::arch::Register& base  = this->architecture->getParentRegister(ID_REG_X86_BP);
+        triton::uint64 baseValue            = this->read(base);
+
+        /* RSP = RBP; RBP = pop() */
+        this->write(stack, baseValue);
+        this->write(base, this->read(triton::arch::OperandWrapper(triton::arch::MemoryAccess(baseValue, base.getSize()))));
+        this->alignStack(base.getSize());
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::mov_c(triton::arch::Instruction& inst) {
+        auto& dst            = inst.operands[0];
+        auto& src            = inst.operands[1];
+        triton::uint64 value = this->read(src) & bitMask(src.getBitSize());
+
+        if (inst.getType() == ID_INS_MOVSX || inst.getType() == ID_INS_MOVSXD)
+          value = signExtend(value, src.getBitSize());
+
+        this->write(dst, value);
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::neg_c(triton::arch::Instruction& inst) {
+        auto& dst           = inst.operands[0];
+        triton::uint32 bits = dst.getBitSize();
+        triton::uint64 op1  = this->read(dst) & bitMask(bits);
+        triton::uint64 res  = (0 - op1) & bitMask(bits);
+
+        this->setFlag(ID_REG_X86_AF, ((op1 ^ res) & 0x10) != 0);
+        this->setFlag(ID_REG_X86_CF, op1 != 0);
+        this->setFlag(ID_REG_X86_OF, msb(res & op1, bits));
+        this->setResultFlags(res, bits);
+        this->write(dst, res);
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::not_c(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+
+        this->write(dst, ~this->read(dst));
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::pop_c(triton::arch::Instruction& inst) {
+        const triton::arch::Register& stack = this->architecture->getStackPointer();
+        auto& dst                           = inst.operands[0];
+        triton::uint64 sp                   = this->read(stack);
+
+        this->write(dst, this->read(triton::arch::OperandWrapper(triton::arch::MemoryAccess(sp, dst.getSize()))));
+
+        /* Don't increment SP if the destination register is SP */
+        if (this->architecture->getParentRegister(dst.getConstRegister()) != stack)
+          this->alignStack(dst.getSize());
+
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::push_c(triton::arch::Instruction& inst) {
+        auto& src           = inst.operands[0];
+        triton::uint32 size = this->architecture->getStackPointer().getSize();
+
+        /* If it's an immediate source, the memory access is always based on the arch size */
+        if (src.getType() != triton::arch::OP_IMM)
+          size = src.getSize();
+
+        triton::uint64 value = this->read(src) & bitMask(src.getBitSize());
+        triton::uint64 sp    = this->alignStack(-static_cast<triton::sint64>(size));
+
+        this->write(triton::arch::MemoryAccess(sp, size), value);
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::ret_c(triton::arch::Instruction& inst) {
+        const triton::arch::Register& stack = this->architecture->getStackPointer();
+        triton::uint64 sp                   = this->read(stack);
+        triton::uint64 target               = this->read(triton::arch::OperandWrapper(triton::arch::MemoryAccess(sp, stack.getSize())));
+
+        this->alignStack(stack.getSize());
+        if (inst.operands.size() > 0)
+          this->alignStack(static_cast<triton::uint32>(inst.operands[0].getConstImmediate().getValue()));
+
+        this->setPc(target);
+      }
+
+
+      void x86ConcreteSemantics::set_c(triton::arch::Instruction& inst) {
+        bool taken = this->condition(inst);
+
+        if (taken)
+          inst.setConditionTaken(true);
+
+        this->write(inst.operands[0], taken);
+        this->setPc(inst.getNextAddress());
+      }
+
+
+      void x86ConcreteSemantics::shift_c(triton::arch::Instruction& inst) {
+        auto& dst           = inst.operands[0];
+        auto& src           = inst.operands[1];
+        triton::uint32 bits = dst.getBitSize();
+        triton::uint64 op1  = this->read(dst) & bitMask(bits);
+        triton::uint64 op2  = this->read(src) & bitMask(src.getBitSize()) & bitMask(bits);
+        triton::uint64 res  = 0;
+        bool cf             = false;
+        bool of             = false;
+
+        /* The count is masked with 0x3f or 0x1f */
+        op2 &= (bits == triton::bitsize::qword) ? (triton::bitsize::qword - 1) : (triton::bitsize::dword - 1);
+
+        switch (inst.getType()) {
+          case ID_INS_SAL:
+          case ID_INS_SHL: {
+            /* As the symbolic semantics, (bits - count) is computed modulo 2^bits */
+            triton::uint64 back = (bits - op2) & bitMask(bits);
+            res = (op2 >= bits) ? 0 : ((op1 << op2) & bitMask(bits));
+            cf  = (back >= bits) ? false : ((op1 >> back) & 1);
+            of  = msb(op1, bits) ^ ((op1 >> (bits - 2)) & 1);
+            break;
+          }
+
+          case ID_INS_SHR:
+            res = (op2 >= bits) ? 0 : (op1 >> op2);
+            cf  = (op2 - 1 >= bits) ? false : ((op1 >> (op2 - 1)) & 1);
+            of  = msb(op1, bits);
+            break;
+
+          case ID_INS_SAR: {
+            bool sign = msb(op1, bits);
+            res = (op2 >= bits) ? (sign ? bitMask(bits) : 0) : ((signExtend(op1, bits) >> op2) | (sign ? ~(bitMask(bits) >> op2) : 0)) & bitMask(bits);
+            cf  = (op2 == 0) ? false : (op2 > bits) ? sign : ((op1 >> (op2 - 1)) & 1);
+            of  = false;
+            break;
+          }
+
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::shift_c(): Invalid instruction.");
+        }
+
+        /* Flags are not affected by a null count, AF is undefined */
+        if (op2 != 0) {
+          this->setFlag(ID_REG_X86_CF, cf);
+          if (op2 == 1)
+            this->setFlag(ID_REG_X86_OF, of);
+          this->setResultFlags(res, bits);
+        }
+
+        this->write(dst, res);
+        this->setPc(inst.getNextAddress());
+      }
+
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -31,7 +31,10 @@ namespace triton {
 
 
       x86Cpu::x86Cpu(const x86Cpu& other) : x86Specifications(ARCH_X86) {
+        this->handle = 0;
+
         this->copy(other);
+        this->disassInit();
       }
 
 
@@ -378,13 +381,14 @@ namespace triton {
           triton::extlibs::capstone::cs_detail* detail = insn->detail;
 
           /* Init the disassembly */
-          std::stringstream str;
+          std::string str(insn[0].mnemonic);
 
-          str << insn[0].mnemonic;
-          if (detail->x86.op_count)
-            str << " " <<  insn[0].op_str;
+          if (detail->x86.op_count) {
+            str += " ";
+            str += insn[0].op_str;
+          }
 
-          inst.setDisassembly(str.str());
+          inst.setDisassembly(str);
 
           /* Refine the size */
           inst.setSize(insn[0].size);
@@ -469,11 +473,7 @@ namespace triton {
         if (execCallbacks && this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte));
 
-        auto it = this->memory.find(addr);
-        if (it == this->memory.end())
-          return 0x00;
-
-        return it->second;
+        return this->memory.getByte(addr);
       }
 
 
@@ -491,18 +491,27 @@ namespace triton {
         if (size == 0 || size > triton::size::dqqword)
           throw triton::exceptions::Cpu("x86Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
+        triton::uint8 area[triton::size::dqqword];
+        this->memory.getArea(addr, area, size);
+
         for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << triton::bitsize::byte) | this->getConcreteMemoryValue(addr+i, false));
+          ret = ((ret << triton::bitsize::byte) | area[i]);
 
         return ret;
       }
 
 
       std::vector<triton::uint8> x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
+
+        /* Callbacks are processed for every byte, before the area is read */
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_MEMORY_VALUE)) {
+          for (triton::usize index = 0; index < size; index++)
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, triton::size::byte));
+        }
 
-        for (triton::usize index = 0; index < size; index++)
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+        if (size)
+          this->memory.getArea(baseAddr, area.data(), size);
 
         return area;
       }
@@ -661,7 +670,7 @@ namespace triton {
       void x86Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
         if (this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte), value);
-        this->memory[addr] = value;
+        this->memory.setByte(addr, value);
       }
 
 
@@ -679,24 +688,29 @@ namespace triton {
         if (this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
 
+        triton::uint8 area[triton::size::dqqword];
         for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+          area[i] = (cv & 0xff).convert_to<triton::uint8>();
           cv >>= 8;
         }
+
+        this->memory.setArea(addr, area, size);
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->setConcreteMemoryValue(baseAddr+index, values[index]);
-        }
+        this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->setConcreteMemoryValue(baseAddr+index, area[index]);
+        /* Callbacks are processed for every byte, before the area is written */
+        if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE)) {
+          for (triton::usize index = 0; index < size; index++)
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, triton::size::byte), area[index]);
         }
+
+        this->memory.setArea(baseAddr, area, size);
       }
 
 
@@ -994,11 +1008,7 @@ namespace triton {
 
 
       bool x86Cpu::isConcreteMemoryValueDefined(triton::uint64 baseAddr, triton::usize size) const {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isDefined(baseAddr, size);
       }
 
 
@@ -1008,11 +1018,7 @@ namespace triton {
 
 
       void x86Cpu::clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end()) {
-            this->memory.erase(baseAddr + index);
-          }
-        }
+        this->memory.clearArea(baseAddr, size);
       }
 
     }; /* x86 namespace */
@@ -41,11 +41,21 @@ namespace triton {
 
 
     AbstractNode::~AbstractNode() {
+      for (const SharedAbstractNode& child : this->children) {
+        if (child != nullptr)
+          this->detach(child.get());
+      }
+
       /* See #828: Release ownership before calling container destructor */
       this->children.clear();
     }
 
 
+    void AbstractNode::detach(AbstractNode* child) {
+      child->parents.erase(this);
+    }
+
+
     SharedAstContext AbstractNode::getContext(void) const {
       return this->ctxt;
     }
@@ -126,6 +136,10 @@ namespace triton {
 
 
     bool AbstractNode::equalTo(const SharedAbstractNode& other) const {
+      /* Shared by the hash-consing */
+      if (this == other.get())
+        return true;
+
       return (this->evaluate() == other->evaluate()) &&
              (this->getBitvectorSize() == other->getBitvectorSize()) &&
              (this->getHash() == other->getHash()) &&
@@ -2753,6 +2767,13 @@ namespace triton {
     }
 
 
+    ReferenceNode::~ReferenceNode() {
+      /* The referenced tree is not a child, see ReferenceNode::init() */
+      if (this->expr->getAst() != nullptr)
+        this->detach(this->expr->getAst().get());
+    }
+
+
     void ReferenceNode::init(bool withParents) {
       /* Init attributes */
       this->eval        = this->expr->getAst()->evaluate();
@@ -5,6 +5,8 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <functional>
 #include <list>
 #include <memory>
 #include <vector>
@@ -22,11 +24,13 @@ namespace triton {
 
     AstContext::AstContext(const triton::modes::SharedModes& modes)
       : modes(modes) {
+      this->internLimit = INTERN_MIN_LIMIT;
     }
 
 
     AstContext::~AstContext() {
       this->valueMapping.clear();
+      this->interned.clear();
       this->nodes.clear();
     }
 
@@ -37,6 +41,8 @@ namespace triton {
       this->astRepresentation = other.astRepresentation;
       this->modes             = other.modes;
       this->valueMapping      = other.valueMapping;
+      this->interned          = other.interned;
+      this->internLimit       = other.internLimit;
       this->nodes             = other.nodes;
 
       return *this;
@@ -71,11 +77,76 @@ namespace triton {
     }
 
 
+    bool AstContext::InternKey::operator==(const InternKey& other) const {
+      return (this->type == other.type) &&
+             (this->children == other.children) &&
+             (this->value == other.value);
+    }
+
+
+    std::size_t AstContext::InternKeyHash::operator()(const InternKey& key) const {
+      std::size_t h = std::hash<triton::uint32>()(key.type) ^ std::hash<triton::uint64>()(static_cast<triton::uint64>(key.value));
+      for (AbstractNode* child : key.children)
+        h = (h * 31) ^ std::hash<AbstractNode*>()(child);
+      return h;
+    }
+
+
+    SharedAbstractNode AstContext::intern(const SharedAbstractNode& node, const triton::uint512& value) {
+      if (this->modes->isModeEnabled(triton::modes::AST_HASH_CONSING) == false) {
+        node->init();
+        return node;
+      }
+
+      /*
+       * The children of a new node are already interned, thus two identical
+       * trees are built from the same children pointers and only the root has
+       * to be looked up. The new node is only initialized (hashed, evaluated and
+       * linked to its children) if no live node matches it.
+       */
+      InternKey key;
+      key.type  = node->getType();
+      key.value = value;
+      key.children.reserve(node->getChildren().size());
+      for (const SharedAbstractNode& child : node->getChildren())
+        key.children.push_back(child.get());
+
+      auto it = this->interned.find(key);
+      if (it != this->interned.end()) {
+        if (SharedAbstractNode other = it->second.lock()) {
+          /* The children of a node can be replaced (see AbstractNode::setChild()) */
+          const auto& children = other->getChildren();
+          bool same = (children.size() == key.children.size());
+          for (triton::usize index = 0; same && index < children.size(); index++)
+            same = (children[index].get() == key.children[index]);
+          if (same)
+            return other;
+        }
+      }
+
+      node->init();
+
+      /* Dead nodes are dropped when the table has doubled since the last sweep */
+      if (this->interned.size() >= this->internLimit) {
+        for (auto i = this->interned.begin(); i != this->interned.end();) {
+          if (i->second.expired())
+            i = this->interned.erase(i);
+          else
+            i++;
+        }
+        this->internLimit = std::max<triton::usize>(INTERN_MIN_LIMIT, this->interned.size() * 2);
+      }
+
+      this->interned[key] = node;
+      return node;
+    }
+
+
     SharedAbstractNode AstContext::assert_(const SharedAbstractNode& expr) {
       SharedAbstractNode node = std::make_shared<AssertNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::assert_(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -84,7 +155,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvNode>(value, size, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bv(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -103,7 +174,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvaddNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvadd(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -141,7 +212,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvandNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvand(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -167,7 +238,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvashrNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvashr(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -183,7 +254,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvNode>(0, 1, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvfalse(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -206,7 +277,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvlshrNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvlshr(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -240,7 +311,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvmulNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvmul(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -256,7 +327,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvnandNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvnand(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -272,7 +343,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvnegNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvneg(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -288,7 +359,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvnorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvnor(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -304,7 +375,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvnotNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvnot(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -342,7 +413,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvor(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -358,7 +429,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvrolNode>(expr, rot);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvrol(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -392,7 +463,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvrolNode>(expr, this->integer(rot->evaluate()));
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvrol(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -408,7 +479,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvrorNode>(expr, rot);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvror(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -442,7 +513,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvrorNode>(expr, this->integer(rot->evaluate()));
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvror(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -464,7 +535,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvsdivNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsdiv(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -480,7 +551,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvsgeNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsge(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -489,7 +560,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvsgtNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsgt(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -512,7 +583,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvshlNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvshl(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -528,7 +599,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvsleNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsle(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -537,7 +608,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvsltNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvslt(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -546,7 +617,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvsmodNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsmod(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -562,7 +633,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvsremNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsrem(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -592,7 +663,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvsubNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsub(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -608,7 +679,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvNode>(1, 1, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvtrue(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -623,7 +694,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvudivNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvudiv(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -639,7 +710,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvugeNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvuge(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -648,7 +719,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvugtNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvugt(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -657,7 +728,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvuleNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvule(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -666,7 +737,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvultNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvult(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -675,7 +746,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvuremNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvurem(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -691,7 +762,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvxnorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvxnor(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -721,7 +792,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<BvxorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvxor(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -741,7 +812,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<ConcatNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::concat(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -769,7 +840,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<DeclareNode>(var);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::declare(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -778,7 +849,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<DistinctNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::distinct(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -787,7 +858,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<EqualNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::equal(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -807,7 +878,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<ExtractNode>(high, low, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::extract(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -827,7 +898,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<IffNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::iff(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -836,7 +907,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<IntegerNode>(value, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::integer(): Not enough memory.");
-      node->init();
+      node = this->intern(node, value);
       return this->collect(node);
     }
 
@@ -845,7 +916,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<IteNode>(ifExpr, thenExpr, elseExpr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::ite(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false && node->isLogical() == false) {
@@ -861,7 +932,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<LandNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::land(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -883,7 +954,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<LnotNode>(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::lnot(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -892,7 +963,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<LorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::lor(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -905,7 +976,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<LxorNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::lxor(): Not enough memory");
-      node->init();
+      node = this->intern(node);
       return this->collect(node);
     }
 
@@ -940,7 +1011,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<SxNode>(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::sx(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
@@ -986,7 +1057,7 @@ namespace triton {
       SharedAbstractNode node = std::make_shared<ZxNode>(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::zx(): Not enough memory.");
-      node->init();
+      node = this->intern(node);
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         if (node->isSymbolized() == false) {
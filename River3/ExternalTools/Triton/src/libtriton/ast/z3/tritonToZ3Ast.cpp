@@ -5,6 +5,10 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <stack>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <triton/cpuSize.hpp>
@@ -18,14 +22,16 @@
 namespace triton {
   namespace ast {
 
-    TritonToZ3Ast::TritonToZ3Ast(bool eval)
+    TritonToZ3Ast::TritonToZ3Ast(bool eval, bool persistent)
       : context() {
-      this->isEval = eval;
+      this->isEval       = eval;
+      this->isPersistent = persistent;
     }
 
 
     TritonToZ3Ast::~TritonToZ3Ast() {
       /* See #828: Release ownership before calling container destructor */
+      this->cache.clear();
       this->symbols.clear();
       this->variables.clear();
     }
@@ -49,10 +55,58 @@ namespace triton {
     }
 
 
+    z3::context& TritonToZ3Ast::getContext(void) {
+      return this->context;
+    }
+
+
     z3::expr TritonToZ3Ast::convert(const triton::ast::SharedAbstractNode& node) {
-      std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> results;
+      std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> local;
+      auto& results = (this->isPersistent ? this->cache : local);
+
+      if (node == nullptr)
+        throw triton::exceptions::AstTranslations("TritonToZ3Ast::convert(): node cannot be null.");
+
+      auto it = results.find(node);
+      if (it != results.end())
+        return it->second;
+
+      /*
+       * Same walk as triton::ast::childrenExtraction() (unrolled, children first),
+       * except that it stops on the nodes converted by a previous call.
+       */
+      std::vector<triton::ast::SharedAbstractNode> nodes;
+      std::unordered_set<triton::ast::AbstractNode*> visited;
+      std::stack<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+
+      worklist.push({node, false});
+      while (!worklist.empty()) {
+        triton::ast::SharedAbstractNode ast;
+        bool postOrder;
+        std::tie(ast, postOrder) = worklist.top();
+        worklist.pop();
+
+        if (postOrder) {
+          nodes.push_back(ast);
+          continue;
+        }
 
-      auto nodes = triton::ast::childrenExtraction(node, true /* unroll*/, true /* revert */);
+        if (!visited.insert(ast.get()).second || results.find(ast) != results.end())
+          continue;
+
+        worklist.push({ast, true});
+
+        for (const auto& child : ast->getChildren()) {
+          if (visited.find(child.get()) == visited.end())
+            worklist.push({child, false});
+        }
+
+        if (ast->getType() == REFERENCE_NODE) {
+          const auto& ref = reinterpret_cast<triton::ast::ReferenceNode*>(ast.get())->getSymbolicExpression()->getAst();
+          if (visited.find(ref.get()) == visited.end())
+            worklist.push({ref, false});
+        }
+      }
 
       for (auto&& n : nodes) {
         results.insert(std::make_pair(n, this->do_convert(n, &results)));
@@ -134,6 +134,18 @@ namespace triton {
         initShiftsNamespace(shiftsDict);
         PyObject* idShiftsClass = xPyClass_New(nullptr, shiftsDict, xPyString_FromString("SHIFT"));
 
+        /* Create the SOLVER_STATE namespace ========================================================== */
+
+        PyObject* solverStateDict = xPyDict_New();
+        initSolverStateNamespace(solverStateDict);
+        PyObject* idSolverStateClass = xPyClass_New(nullptr, solverStateDict, xPyString_FromString("SOLVER_STATE"));
+
+        /* Create the STOP namespace ================================================================== */
+
+        PyObject* stopDict = xPyDict_New();
+        initStopNamespace(stopDict);
+        PyObject* idStopClass = xPyClass_New(nullptr, stopDict, xPyString_FromString("STOP"));
+
         /* Create the SYMBOLIC namespace ============================================================== */
 
         PyObject* symbolicDict = xPyDict_New();
@@ -176,6 +188,8 @@ namespace triton {
         PyModule_AddObject(triton::bindings::python::tritonModule, "PREFIX",              idPrefixesClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "REG",                 idRegClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SHIFT",               idShiftsClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "SOLVER_STATE",        idSolverStateClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "STOP",                idStopClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SYMBOLIC",            idSymbolicClass);
         #if defined(__unix__) || defined(__APPLE__)
         PyModule_AddObject(triton::bindings::python::tritonModule, "SYSCALL64",           idSyscallsClass64);
@@ -34,9 +34,19 @@ The MODE namespace contains all kinds of modes.
 - **MODE.ALIGNED_MEMORY**<br>
 Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` accesses.
 
+- **MODE.AST_HASH_CONSING**<br>
+Enabled, Triton will return the live node of an identical operation (same kind and same children) instead of building a new one.
+Identical sub-trees are thus shared, which reduces the memory used by long traces. Note that the children of a shared node
+should not be replaced with `setChild()` as all its users see the change.
+
 - **MODE.AST_OPTIMIZATIONS**<br>
 Enabled, Triton will reduces the depth of the trees using classical arithmetic optimisations.
 
+- **MODE.CONCRETE_ONLY**<br>
+Enabled, Triton will execute the common x86 and x86-64 instructions (moves, arithmetic, logic, shifts, stack and branches
+on general purpose registers) directly on the concrete state, without building ASTs, symbolic expressions nor path constraints.
+The registers and the memory they write are concretized and untainted. The other instructions are processed as usual.
+
 - **MODE.CONCRETIZE_UNDEFINED_REGISTERS**<br>
 Enabled, Triton will concretize every register tagged as undefined (see #750).
 
@@ -67,7 +77,9 @@ namespace triton {
 
       void initModeNamespace(PyObject* modeDict) {
         xPyDict_SetItemString(modeDict, "ALIGNED_MEMORY",                 PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
+        xPyDict_SetItemString(modeDict, "AST_HASH_CONSING",               PyLong_FromUint32(triton::modes::AST_HASH_CONSING));
         xPyDict_SetItemString(modeDict, "AST_OPTIMIZATIONS",              PyLong_FromUint32(triton::modes::AST_OPTIMIZATIONS));
+        xPyDict_SetItemString(modeDict, "CONCRETE_ONLY",                  PyLong_FromUint32(triton::modes::CONCRETE_ONLY));
         xPyDict_SetItemString(modeDict, "CONCRETIZE_UNDEFINED_REGISTERS", PyLong_FromUint32(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS));
         xPyDict_SetItemString(modeDict, "CONSTANT_FOLDING",               PyLong_FromUint32(triton::modes::CONSTANT_FOLDING));
         xPyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",             PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
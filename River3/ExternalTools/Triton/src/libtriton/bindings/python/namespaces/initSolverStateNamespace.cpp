@@ -0,0 +1,65 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/solverEnums.hpp>
+
+
+
+/*! \page py_SOLVER_STATE_page SOLVER_STATE
+    \brief [**python api**] All information about the SOLVER_STATE Python namespace.
+
+\tableofcontents
+
+\section SOLVER_STATE_py_description Description
+<hr>
+
+The SOLVER_STATE namespace contains the status of a solver query.
+
+\subsection SOLVER_STATE_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> ctxt.beginSolverSession()
+>>> model, status = ctxt.checkWithAssumptions([node])
+>>> status == SOLVER_STATE.SAT
+True
+~~~~~~~~~~~~~
+
+\section SOLVER_STATE_py_api Python API - Items of the SOLVER_STATE namespace
+<hr>
+
+- **SOLVER_STATE.SAT**<br>
+The constraints are satisfiable.
+
+- **SOLVER_STATE.TIMEOUT**<br>
+The solver timeout is reached.
+
+- **SOLVER_STATE.UNKNOWN**<br>
+The solver cannot decide.
+
+- **SOLVER_STATE.UNSAT**<br>
+The constraints are not satisfiable.
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initSolverStateNamespace(PyObject* solverStateDict) {
+        xPyDict_SetItemString(solverStateDict, "SAT",     PyLong_FromUint32(triton::engines::solver::SAT));
+        xPyDict_SetItemString(solverStateDict, "TIMEOUT", PyLong_FromUint32(triton::engines::solver::TIMEOUT));
+        xPyDict_SetItemString(solverStateDict, "UNKNOWN", PyLong_FromUint32(triton::engines::solver::UNKNOWN));
+        xPyDict_SetItemString(solverStateDict, "UNSAT",   PyLong_FromUint32(triton::engines::solver::UNSAT));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
@@ -0,0 +1,64 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/archEnums.hpp>
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+
+
+
+/*! \page py_STOP_page STOP
+    \brief [**python api**] All information about the STOP Python namespace.
+
+\tableofcontents
+
+\section STOP_py_description Description
+<hr>
+
+The STOP namespace contains the reasons why an emulation stops.
+
+\subsection STOP_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> result = ctxt.run(0x400000, 0, 0x400000, 0x401000)
+>>> result['reason'] == STOP.REGION_EXIT
+True
+~~~~~~~~~~~~~
+
+\section STOP_py_api Python API - Items of the STOP namespace
+<hr>
+
+- **STOP.BUDGET**<br>
+The instruction budget is spent.
+
+- **STOP.END_ADDRESS**<br>
+The end address is reached.
+
+- **STOP.REGION_EXIT**<br>
+The program counter left the region.
+
+- **STOP.UNSUPPORTED**<br>
+The instruction at `pc` has no semantics, it is not executed.
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initStopNamespace(PyObject* stopDict) {
+        xPyDict_SetItemString(stopDict, "BUDGET",      PyLong_FromUint32(triton::arch::STOP_BUDGET));
+        xPyDict_SetItemString(stopDict, "END_ADDRESS", PyLong_FromUint32(triton::arch::STOP_END_ADDRESS));
+        xPyDict_SetItemString(stopDict, "REGION_EXIT", PyLong_FromUint32(triton::arch::STOP_REGION_EXIT));
+        xPyDict_SetItemString(stopDict, "UNSUPPORTED", PyLong_FromUint32(triton::arch::STOP_UNSUPPORTED));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
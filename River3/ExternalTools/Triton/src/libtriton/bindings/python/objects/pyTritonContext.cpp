@@ -42,6 +42,9 @@ libTriton offers Python bindings on top of its C++ API which allow you to build
 - <b>void addCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
 
+- <b>void assertSolverConstraint(\ref py_AstNode_page node)</b><br>
+Adds a logical constraint to the solving session (see beginSolverSession()).
+
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the memory access.
@@ -50,9 +53,18 @@ The symbolic expression (`symExpr`) must be aligned to the memory access.
 Assigns a \ref py_SymbolicExpression_page to a \ref py_Register_page. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the targeted size register. The register must be a parent register.
 
+- <b>void beginSolverSession(void)</b><br>
+Starts an incremental solving session, a previous session is dropped. The session keeps one solver: the nodes are
+converted once for the whole session and what the solver learned is kept between two checks. The nodes given to the
+session must not be modified until endSolverSession().
+
 - <b>bool buildSemantics(\ref py_Instruction_page inst)</b><br>
 Builds the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
+- <b>(dict, \ref py_SOLVER_STATE_page) checkWithAssumptions([\ref py_AstNode_page, ...] assumptions)</b><br>
+Checks the constraints of the solving session together with the `assumptions`, which only hold for this check. Returns the
+model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} (empty if it is not satisfiable) and the status.
+
 - <b>void clearCallbacks(void)</b><br>
 Clears recorded callbacks.
 
@@ -68,6 +80,10 @@ Clears concrete values assigned to the memory cells from `addr` to `addr + size`
 - <b>void clearPathConstraints(void)</b><br>
 Clears the current path predicate.
 
+- <b>void collectGarbage(void)</b><br>
+Removes the dead entries of the symbolic expressions and variables tables, and concretizes the register and memory references
+older than the history limit (see setHistoryLimit()).
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -101,6 +117,9 @@ Enables or disables the symbolic execution engine.
 - <b>void enableTaintEngine(bool flag)</b><br>
 Enables or disables the taint engine.
 
+- <b>void endSolverSession(void)</b><br>
+Ends the solving session.
+
 - <b>integer evaluateAstViaZ3(\ref py_AstNode_page node)</b><br>
 Evaluates an AST via Z3 and returns the symbolic value.
 
@@ -137,6 +156,9 @@ Returns the size in bits of the General Purpose Registers.
 - <b>integer getGprSize(void)</b><br>
 Returns the size in bytes of the General Purpose Registers.
 
+- <b>integer getHistoryLimit(void)</b><br>
+Returns the number of the most recent symbolic expressions kept symbolic, 0 for an unbounded history.
+
 - <b>\ref py_AstNode_page getImmediateAst(\ref py_Immediate_page imm)</b><br>
 Returns the AST corresponding to the \ref py_Immediate_page.
 
@@ -200,6 +222,12 @@ Returns the \ref py_SymbolicExpression_page corresponding to the parent register
 - <b>integer getSymbolicRegisterValue(\ref py_Register_page reg)</b><br>
 Returns the symbolic register value.
 
+- <b>dict getSymbolicStatistics(void)</b><br>
+Returns the size of the symbolic state as a dictionary with the keys `liveExpressions` (expressions still alive, including
+the ones only held by instructions), `reachableExpressions` and `reachableNodes` (expressions and AST nodes reachable from
+the registers, the memory and the path constraints), `reachableBytes` (an estimate of the memory they use), `symbolicRegisters`,
+`symbolicMemory` (the number of symbolic memory cells) and `pathConstraints`.
+
 - <b>\ref py_SymbolicVariable_page getSymbolicVariable(integer symVarId)</b><br>
 Returns the symbolic variable corresponding to a symbolic variable id.
 
@@ -260,6 +288,12 @@ Returns true if the register is valid.
 - <b>bool isSat(\ref py_AstNode_page node)</b><br>
 Returns true if an expression is satisfiable.
 
+- <b>bool isSnapshotValid(integer id)</b><br>
+Returns true if the snapshot exists.
+
+- <b>bool isSolverSessionActive(void)</b><br>
+Returns true if a solving session is started.
+
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
 
@@ -281,6 +315,9 @@ Returns a new symbolic variable.
 - <b>void popPathConstraint(void)</b><br>
 Pops the last constraints added to the path predicate.
 
+- <b>void popSolverScope(void)</b><br>
+Drops the constraints asserted in the solving session since the last pushSolverScope().
+
 - <b>void printSlicedExpressions(\ref py_SymbolicExpression_page expr, bool assert_=False)</b><br>
 Prints symbolic expression with used references and symbolic variables in AST representation mode. If `assert_` is true, then (assert <expr>).
 
@@ -290,12 +327,29 @@ Processes an instruction and updates engines according to the instruction semant
 - <b>void pushPathConstraint(\ref py_AstNode_page node)</b><br>
 Pushs constraints to the current path predicate.
 
+- <b>void pushSolverScope(void)</b><br>
+Saves the constraints of the solving session, they are restored by popSolverScope().
+
 - <b>void removeCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Removes a recorded callback.
 
+- <b>void removeSnapshot(integer id)</b><br>
+Removes a snapshot.
+
 - <b>void reset(void)</b><br>
 Resets everything.
 
+- <b>void restoreSnapshot(integer id)</b><br>
+Restores the concrete registers and memory, the symbolic states, the path constraints and the taint states of a snapshot.
+The snapshot is kept, it can be restored again.
+
+- <b>dict run(integer pc, integer endAddress=0, integer regionBegin=0, integer regionEnd=-1, integer budget=0)</b><br>
+Emulates from `pc` until the end address is reached, the program counter leaves [`regionBegin`, `regionEnd`] or
+`budget` instructions are executed (0 disables the end address and the budget, -1 is the highest address). It also stops
+before an instruction that has no semantics. Instructions
+are disassembled once and kept in a cache until their memory is written. Returns a dict with the \ref py_STOP_page `reason`,
+the next `pc`, the `count` of instructions executed and the list of the basic `blocks` entered.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -325,6 +379,11 @@ the symbolic state (if it exists). You should probably use the concretize functi
 - <b>void setConcreteVariableValue(\ref py_SymbolicVariable_page symVar, integer value)</b><br>
 Sets the concrete value of a symbolic variable.
 
+- <b>void setHistoryLimit(integer limit)</b><br>
+Sets the number of the most recent symbolic expressions kept symbolic, 0 for an unbounded history (the default). Each time
+`limit` expressions have been created, the registers and memory cells assigned by older expressions are concretized, the
+references to symbolic variables excepted. The expressions which are not reachable anymore are then released.
+
 - <b>void setMode(\ref py_MODE_page mode, bool flag)</b><br>
 Enables or disables a specific mode.
 
@@ -344,6 +403,14 @@ set to True, Triton will use z3 to simplify the given `node` before calling its
 - <b>dict sliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
 Slices expressions from a given one (backward slicing) and returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
+- <b>[dict, ...] solveBranchFlips([\ref py_PathConstraint_page, ...] pathConstraints, integer startIndex=0, integer limit=0, integer timeout=0)</b><br>
+Computes in one call the models which take the branches not taken by a path (e.g. the one returned by getPathConstraints()).
+Every branch not taken of the path constraints from `startIndex` is queried with the predicates taken before it, the path is
+asserted once in a solving session instead of being rebuilt for each query. At most `limit` queries are done (0 for no limit)
+and each of them is bounded by `timeout` milliseconds (0 keeps the solver timeout). Returns a list of dictionaries with
+the keys `pcIndex`, `branchIndex`, `srcAddr`, `dstAddr`, `status` (\ref py_SOLVER_STATE_page) and `model` (a dictionary of
+{integer symVarId : \ref py_SolverModel_page model}, empty if the branch cannot be taken).
+
 - <b>\ref py_SymbolicVariable_page symbolizeExpression(integer symExprId, integer symVarSize, string symVarAlias)</b><br>
 Converts a symbolic expression to a symbolic variable. `symVarSize` must be in bits. This function returns the new symbolic variable created.
 
@@ -406,6 +473,10 @@ tainted. Returns true if `regDst` is tainted.
 Taints `regDst` from `regSrc` with an union - `regDst` is tainted if `regDst` or `regSrc` are
 tainted. Returns true if `regDst` is tainted.
 
+- <b>integer takeSnapshot(void)</b><br>
+Takes a snapshot of the concrete registers and memory, the symbolic states, the path constraints and the taint states. Returns its id.
+Memory pages are shared with the snapshot until they are written, thus a snapshot is cheap to take and to restore.
+
 - <b>bool untaintMemory(integer addr)</b><br>
 Untaints an address. Returns true if the address is still tainted.
 
@@ -664,6 +735,25 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_assertSolverConstraint(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assertSolverConstraint(): Expects a AstNode as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->assertSolverConstraint(PyAstNode_AsAstNode(node));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -730,6 +820,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_beginSolverSession(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->beginSolverSession();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_buildSemantics(PyObject* self, PyObject* inst) {
         if (!PyInstruction_Check(inst))
           return PyErr_Format(PyExc_TypeError, "TritonContext::buildSemantics(): Expects an Instruction as argument.");
@@ -748,6 +854,46 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_checkWithAssumptions(PyObject* self, PyObject* assumptionsList) {
+        std::vector<triton::ast::SharedAbstractNode> assumptions;
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        PyObject* ret = nullptr;
+
+        if (!PyList_Check(assumptionsList))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::checkWithAssumptions(): Expects a list of AstNodes as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(assumptionsList); i++) {
+          PyObject* item = PyList_GetItem(assumptionsList, i);
+
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::checkWithAssumptions(): Each element from the list must be a AstNode.");
+
+          assumptions.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        try {
+          auto model = PyTritonContext_AsTritonContext(self)->checkWithAssumptions(assumptions, &status);
+
+          PyObject* mdict = xPyDict_New();
+          for (auto it = model.begin(); it != model.end(); it++) {
+            xPyDict_SetItem(mdict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+          }
+
+          ret = xPyTuple_New(2);
+          PyTuple_SetItem(ret, 0, mdict);
+          PyTuple_SetItem(ret, 1, PyLong_FromUint32(status));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_clearCallbacks(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->clearCallbacks();
@@ -830,6 +976,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_collectGarbage(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->collectGarbage();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->concretizeAllMemory();
@@ -1098,6 +1257,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_endSolverSession(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->endSolverSession();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_evaluateAstViaZ3(PyObject* self, PyObject* node) {
         if (!PyAstNode_Check(node))
           return PyErr_Format(PyExc_TypeError, "TritonContext::evaluateAstViaZ3(): Expects a AstNode as argument.");
@@ -1288,6 +1463,16 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getHistoryLimit(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getHistoryLimit());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getImmediateAst(PyObject* self, PyObject* imm) {
         if (!PyImmediate_Check(imm))
           return PyErr_Format(PyExc_TypeError, "TritonContext::getImmediateAst(): Expects an Immediate as argument.");
@@ -1659,6 +1844,29 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getSymbolicStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto stats = PyTritonContext_AsTritonContext(self)->getSymbolicStatistics();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, PyStr_FromString("liveExpressions"),      PyLong_FromUsize(stats.liveExpressions));
+          xPyDict_SetItem(ret, PyStr_FromString("reachableExpressions"), PyLong_FromUsize(stats.reachableExpressions));
+          xPyDict_SetItem(ret, PyStr_FromString("reachableNodes"),       PyLong_FromUsize(stats.reachableNodes));
+          xPyDict_SetItem(ret, PyStr_FromString("reachableBytes"),       PyLong_FromUsize(stats.reachableBytes));
+          xPyDict_SetItem(ret, PyStr_FromString("symbolicRegisters"),    PyLong_FromUsize(stats.symbolicRegisters));
+          xPyDict_SetItem(ret, PyStr_FromString("symbolicMemory"),       PyLong_FromUsize(stats.symbolicMemory));
+          xPyDict_SetItem(ret, PyStr_FromString("pathConstraints"),      PyLong_FromUsize(stats.pathConstraints));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getSymbolicVariable(PyObject* self, PyObject* arg) {
         try {
           if (PyLong_Check(arg) || PyInt_Check(arg))
@@ -1988,6 +2196,39 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_isSnapshotValid(PyObject* self, PyObject* id) {
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSnapshotValid(): Expects an integer as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSnapshotValid(PyLong_AsUsize(id)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSolverSessionActive(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSolverSessionActive() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
         try {
           if (PyTritonContext_AsTritonContext(self)->isSymbolicEngineEnabled() == true)
@@ -2144,6 +2385,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_popSolverScope(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->popSolverScope();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_printSlicedExpressions(PyObject* self, PyObject* args) {
         PyObject* expr        = nullptr;
         PyObject* assertFlag  = nullptr;
@@ -2216,6 +2473,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_pushSolverScope(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->pushSolverScope();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_removeCallback(PyObject* self, PyObject* args) {
         PyObject* cb       = nullptr;
         PyObject* function = nullptr;
@@ -2268,6 +2541,25 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_removeSnapshot(PyObject* self, PyObject* id) {
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeSnapshot(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->removeSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_reset(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->reset();
@@ -2284,6 +2576,101 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_restoreSnapshot(PyObject* self, PyObject* id) {
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::restoreSnapshot(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->restoreSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_run(PyObject* self, PyObject* args) {
+        PyObject* pc          = nullptr;
+        PyObject* endAddress  = nullptr;
+        PyObject* regionBegin = nullptr;
+        PyObject* regionEnd   = nullptr;
+        PyObject* budget      = nullptr;
+        PyObject* ret         = nullptr;
+
+        triton::arch::StopConditions conditions;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOOO", &pc, &endAddress, &regionBegin, &regionEnd, &budget) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Invalid number of arguments");
+        }
+
+        if (pc == nullptr || (!PyLong_Check(pc) && !PyInt_Check(pc)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects an integer as first argument.");
+
+        if (endAddress != nullptr && (!PyLong_Check(endAddress) && !PyInt_Check(endAddress)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects an integer as second argument.");
+
+        if (regionBegin != nullptr && (!PyLong_Check(regionBegin) && !PyInt_Check(regionBegin)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects an integer as third argument.");
+
+        if (regionEnd != nullptr && (!PyLong_Check(regionEnd) && !PyInt_Check(regionEnd)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects an integer as fourth argument.");
+
+        if (budget != nullptr && (!PyLong_Check(budget) && !PyInt_Check(budget)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects an integer as fifth argument.");
+
+        if (endAddress != nullptr)
+          conditions.endAddress = PyLong_AsUint64(endAddress);
+
+        if (regionBegin != nullptr)
+          conditions.regionBegin = PyLong_AsUint64(regionBegin);
+
+        /* -1 is the highest address, the default */
+        if (regionEnd != nullptr) {
+          long end = PyLong_AsLong(regionEnd);
+          if (end == -1 && PyErr_Occurred()) {
+            /* Above LONG_MAX */
+            PyErr_Clear();
+            conditions.regionEnd = PyLong_AsUint64(regionEnd);
+          }
+          else if (end != -1) {
+            conditions.regionEnd = PyLong_AsUint64(regionEnd);
+          }
+        }
+
+        if (budget != nullptr)
+          conditions.budget = PyLong_AsUsize(budget);
+
+        try {
+          triton::arch::RunResult result = PyTritonContext_AsTritonContext(self)->run(PyLong_AsUint64(pc), conditions);
+
+          PyObject* blocks = xPyList_New(result.blocks.size());
+          for (triton::usize index = 0; index < result.blocks.size(); index++)
+            PyList_SetItem(blocks, index, PyLong_FromUint64(result.blocks[index]));
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, PyStr_FromString("reason"), PyLong_FromUint32(result.reason));
+          xPyDict_SetItem(ret, PyStr_FromString("pc"),     PyLong_FromUint64(result.pc));
+          xPyDict_SetItem(ret, PyStr_FromString("count"),  PyLong_FromUsize(result.count));
+          xPyDict_SetItem(ret, PyStr_FromString("blocks"), blocks);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "TritonContext::setArchitecture(): Expects an ARCH as argument.");
@@ -2521,6 +2908,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setHistoryLimit(PyObject* self, PyObject* limit) {
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setHistoryLimit(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setHistoryLimit(PyLong_AsUsize(limit));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setMode(PyObject* self, PyObject* args) {
         PyObject* mode = nullptr;
         PyObject* flag = nullptr;
@@ -2695,6 +3098,78 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_solveBranchFlips(PyObject* self, PyObject* args) {
+        std::vector<triton::engines::symbolic::PathConstraint> pcs;
+        PyObject* pcList     = nullptr;
+        PyObject* startIndex = nullptr;
+        PyObject* limit      = nullptr;
+        PyObject* timeout    = nullptr;
+        PyObject* ret        = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &pcList, &startIndex, &limit, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveBranchFlips(): Invalid number of arguments");
+        }
+
+        if (pcList == nullptr || !PyList_Check(pcList))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveBranchFlips(): Expects a list of PathConstraints as first argument.");
+
+        if (startIndex != nullptr && (!PyLong_Check(startIndex) && !PyInt_Check(startIndex)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveBranchFlips(): Expects an integer as second argument.");
+
+        if (limit != nullptr && (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveBranchFlips(): Expects an integer as third argument.");
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveBranchFlips(): Expects an integer as fourth argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(pcList); i++) {
+          PyObject* item = PyList_GetItem(pcList, i);
+
+          if (!PyPathConstraint_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::solveBranchFlips(): Each element from the list must be a PathConstraint.");
+
+          pcs.push_back(*PyPathConstraint_AsPathConstraint(item));
+        }
+
+        try {
+          auto flips = PyTritonContext_AsTritonContext(self)->solveBranchFlips(
+                         pcs,
+                         startIndex != nullptr ? PyLong_AsUsize(startIndex) : 0,
+                         limit != nullptr ? PyLong_AsUsize(limit) : 0,
+                         timeout != nullptr ? PyLong_AsUint32(timeout) : 0
+                       );
+
+          ret = xPyList_New(flips.size());
+          for (triton::usize index = 0; index < flips.size(); index++) {
+            const auto& flip = flips[index];
+
+            PyObject* mdict = xPyDict_New();
+            for (auto it = flip.model.begin(); it != flip.model.end(); it++) {
+              xPyDict_SetItem(mdict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+            }
+
+            PyObject* dict = xPyDict_New();
+            xPyDict_SetItem(dict, PyStr_FromString("pcIndex"),     PyLong_FromUsize(flip.pcIndex));
+            xPyDict_SetItem(dict, PyStr_FromString("branchIndex"), PyLong_FromUsize(flip.branchIndex));
+            xPyDict_SetItem(dict, PyStr_FromString("srcAddr"),     PyLong_FromUint64(flip.srcAddr));
+            xPyDict_SetItem(dict, PyStr_FromString("dstAddr"),     PyLong_FromUint64(flip.dstAddr));
+            xPyDict_SetItem(dict, PyStr_FromString("status"),      PyLong_FromUint32(flip.status));
+            xPyDict_SetItem(dict, PyStr_FromString("model"),       mdict);
+            PyList_SetItem(ret, index, dict);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_symbolizeExpression(PyObject* self, PyObject* args) {
         PyObject* exprId        = nullptr;
         PyObject* symVarSize    = nullptr;
@@ -2927,6 +3402,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_takeSnapshot(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->takeSnapshot());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_untaintMemory(PyObject* self, PyObject* mem) {
         try {
           if (PyMemoryAccess_Check(mem)) {
@@ -3017,13 +3505,17 @@ namespace triton {
       //! TritonContext methods.
       PyMethodDef TritonContext_callbacks[] = {
         {"addCallback",                         (PyCFunction)TritonContext_addCallback,                            METH_VARARGS,       ""},
+        {"assertSolverConstraint",              (PyCFunction)TritonContext_assertSolverConstraint,                 METH_O,             ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)TritonContext_assignSymbolicExpressionToMemory,       METH_VARARGS,       ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)TritonContext_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
+        {"beginSolverSession",                  (PyCFunction)TritonContext_beginSolverSession,                     METH_NOARGS,        ""},
         {"buildSemantics",                      (PyCFunction)TritonContext_buildSemantics,                         METH_O,             ""},
+        {"checkWithAssumptions",                (PyCFunction)TritonContext_checkWithAssumptions,                   METH_O,             ""},
         {"clearCallbacks",                      (PyCFunction)TritonContext_clearCallbacks,                         METH_NOARGS,        ""},
         {"clearModes",                          (PyCFunction)TritonContext_clearModes,                             METH_NOARGS,        ""},
         {"clearConcreteMemoryValue",            (PyCFunction)TritonContext_clearConcreteMemoryValue,               METH_VARARGS,       ""},
         {"clearPathConstraints",                (PyCFunction)TritonContext_clearPathConstraints,                   METH_NOARGS,        ""},
+        {"collectGarbage",                      (PyCFunction)TritonContext_collectGarbage,                         METH_NOARGS,        ""},
         {"concretizeAllMemory",                 (PyCFunction)TritonContext_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)TritonContext_concretizeAllRegister,                  METH_NOARGS,        ""},
         {"concretizeMemory",                    (PyCFunction)TritonContext_concretizeMemory,                       METH_O,             ""},
@@ -3034,6 +3526,7 @@ namespace triton {
         {"disassembly",                         (PyCFunction)TritonContext_disassembly,                            METH_O,             ""},
         {"enableSymbolicEngine",                (PyCFunction)TritonContext_enableSymbolicEngine,                   METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)TritonContext_enableTaintEngine,                      METH_O,             ""},
+        {"endSolverSession",                    (PyCFunction)TritonContext_endSolverSession,                       METH_NOARGS,        ""},
         {"evaluateAstViaZ3",                    (PyCFunction)TritonContext_evaluateAstViaZ3,                       METH_O,             ""},
         {"getAllRegisters",                     (PyCFunction)TritonContext_getAllRegisters,                        METH_NOARGS,        ""},
         {"getArchitecture",                     (PyCFunction)TritonContext_getArchitecture,                        METH_NOARGS,        ""},
@@ -3045,6 +3538,7 @@ namespace triton {
         {"getConcreteVariableValue",            (PyCFunction)TritonContext_getConcreteVariableValue,               METH_O,             ""},
         {"getGprBitSize",                       (PyCFunction)TritonContext_getGprBitSize,                          METH_NOARGS,        ""},
         {"getGprSize",                          (PyCFunction)TritonContext_getGprSize,                             METH_NOARGS,        ""},
+        {"getHistoryLimit",                     (PyCFunction)TritonContext_getHistoryLimit,                        METH_NOARGS,        ""},
         {"getImmediateAst",                     (PyCFunction)TritonContext_getImmediateAst,                        METH_O,             ""},
         {"getMemoryAst",                        (PyCFunction)TritonContext_getMemoryAst,                           METH_O,             ""},
         {"getModel",                            (PyCFunction)TritonContext_getModel,                               METH_O,             ""},
@@ -3062,6 +3556,7 @@ namespace triton {
         {"getSymbolicMemoryValue",              (PyCFunction)TritonContext_getSymbolicMemoryValue,                 METH_O,             ""},
         {"getSymbolicRegister",                 (PyCFunction)TritonContext_getSymbolicRegister,                    METH_O,             ""},
         {"getSymbolicRegisterValue",            (PyCFunction)TritonContext_getSymbolicRegisterValue,               METH_O,             ""},
+        {"getSymbolicStatistics",               (PyCFunction)TritonContext_getSymbolicStatistics,                  METH_NOARGS,        ""},
         {"getSymbolicRegisters",                (PyCFunction)TritonContext_getSymbolicRegisters,                   METH_NOARGS,        ""},
         {"getSymbolicVariable",                 (PyCFunction)TritonContext_getSymbolicVariable,                    METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)TritonContext_getSymbolicVariables,                   METH_NOARGS,        ""},
@@ -3079,6 +3574,8 @@ namespace triton {
         {"isRegisterTainted",                   (PyCFunction)TritonContext_isRegisterTainted,                      METH_O,             ""},
         {"isRegisterValid",                     (PyCFunction)TritonContext_isRegisterValid,                        METH_O,             ""},
         {"isSat",                               (PyCFunction)TritonContext_isSat,                                  METH_O,             ""},
+        {"isSnapshotValid",                     (PyCFunction)TritonContext_isSnapshotValid,                        METH_O,             ""},
+        {"isSolverSessionActive",               (PyCFunction)TritonContext_isSolverSessionActive,                  METH_NOARGS,        ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)TritonContext_isSymbolicEngineEnabled,                METH_NOARGS,        ""},
         {"isSymbolicExpressionExists",          (PyCFunction)TritonContext_isSymbolicExpressionExists,             METH_O,             ""},
         {"isTaintEngineEnabled",                (PyCFunction)TritonContext_isTaintEngineEnabled,                   METH_NOARGS,        ""},
@@ -3086,17 +3583,23 @@ namespace triton {
         {"newSymbolicExpression",               (PyCFunction)TritonContext_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)TritonContext_newSymbolicVariable,                    METH_VARARGS,       ""},
         {"popPathConstraint",                   (PyCFunction)TritonContext_popPathConstraint,                      METH_NOARGS,        ""},
+        {"popSolverScope",                      (PyCFunction)TritonContext_popSolverScope,                         METH_NOARGS,        ""},
         {"printSlicedExpressions",              (PyCFunction)TritonContext_printSlicedExpressions,                 METH_VARARGS,       ""},
         {"processing",                          (PyCFunction)TritonContext_processing,                             METH_O,             ""},
         {"pushPathConstraint",                  (PyCFunction)TritonContext_pushPathConstraint,                     METH_O,             ""},
+        {"pushSolverScope",                     (PyCFunction)TritonContext_pushSolverScope,                        METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)TritonContext_removeCallback,                         METH_VARARGS,       ""},
+        {"removeSnapshot",                      (PyCFunction)TritonContext_removeSnapshot,                         METH_O,             ""},
         {"reset",                               (PyCFunction)TritonContext_reset,                                  METH_NOARGS,        ""},
+        {"restoreSnapshot",                     (PyCFunction)TritonContext_restoreSnapshot,                        METH_O,             ""},
+        {"run",                                 (PyCFunction)TritonContext_run,                                    METH_VARARGS,       ""},
         {"setArchitecture",                     (PyCFunction)TritonContext_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)TritonContext_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)TritonContext_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"setConcreteMemoryValue",              (PyCFunction)TritonContext_setConcreteMemoryValue,                 METH_VARARGS,       ""},
         {"setConcreteRegisterValue",            (PyCFunction)TritonContext_setConcreteRegisterValue,               METH_VARARGS,       ""},
         {"setConcreteVariableValue",            (PyCFunction)TritonContext_setConcreteVariableValue,               METH_VARARGS,       ""},
+        {"setHistoryLimit",                     (PyCFunction)TritonContext_setHistoryLimit,                        METH_O,             ""},
         {"setMode",                             (PyCFunction)TritonContext_setMode,                                METH_VARARGS,       ""},
         {"setSolverTimeout",                    (PyCFunction)TritonContext_setSolverTimeout,                       METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)TritonContext_setTaintMemory,                         METH_VARARGS,       ""},
@@ -3104,6 +3607,7 @@ namespace triton {
         {"setThumb",                            (PyCFunction)TritonContext_setThumb,                               METH_O,             ""},
         {"simplify",                            (PyCFunction)TritonContext_simplify,                               METH_VARARGS,       ""},
         {"sliceExpressions",                    (PyCFunction)TritonContext_sliceExpressions,                       METH_O,             ""},
+        {"solveBranchFlips",                    (PyCFunction)TritonContext_solveBranchFlips,                       METH_VARARGS,       ""},
         {"symbolizeExpression",                 (PyCFunction)TritonContext_symbolizeExpression,                    METH_VARARGS,       ""},
         {"symbolizeMemory",                     (PyCFunction)TritonContext_symbolizeMemory,                        METH_VARARGS,       ""},
         {"symbolizeRegister",                   (PyCFunction)TritonContext_symbolizeRegister,                      METH_VARARGS,       ""},
@@ -3111,6 +3615,7 @@ namespace triton {
         {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                            METH_O,             ""},
         {"taintRegister",                       (PyCFunction)TritonContext_taintRegister,                          METH_O,             ""},
         {"taintUnion",                          (PyCFunction)TritonContext_taintUnion,                             METH_VARARGS,       ""},
+        {"takeSnapshot",                        (PyCFunction)TritonContext_takeSnapshot,                           METH_NOARGS,        ""},
         {"untaintMemory",                       (PyCFunction)TritonContext_untaintMemory,                          METH_O,             ""},
         {"untaintRegister",                     (PyCFunction)TritonContext_untaintRegister,                        METH_O,             ""},
         {nullptr,                               nullptr,                                                           0,                  nullptr}
@@ -16,7 +16,8 @@ namespace triton {
     namespace solver {
 
       SolverEngine::SolverEngine() {
-        this->kind = triton::engines::solver::SOLVER_INVALID;
+        this->kind    = triton::engines::solver::SOLVER_INVALID;
+        this->timeout = 0;
         #ifdef TRITON_Z3_INTERFACE
         /* By default we initialized the z3 solver */
         this->setSolver(triton::engines::solver::SOLVER_Z3);
@@ -54,7 +55,8 @@ namespace triton {
         }
 
         /* Setup global variables */
-        this->kind = kind;
+        this->kind    = kind;
+        this->timeout = 0;
       }
 
 
@@ -66,7 +68,8 @@ namespace triton {
         this->solver.reset(customSolver);
 
         /* Setup global variables */
-        this->kind = triton::engines::solver::SOLVER_CUSTOM;
+        this->kind    = triton::engines::solver::SOLVER_CUSTOM;
+        this->timeout = 0;
       }
 
 
@@ -108,9 +111,63 @@ namespace triton {
       void SolverEngine::setTimeout(triton::uint32 ms) {
         if (this->solver) {
           this->solver->setTimeout(ms);
+          this->timeout = ms;
         }
       }
 
+
+      triton::uint32 SolverEngine::getTimeout(void) const {
+        return this->timeout;
+      }
+
+
+      void SolverEngine::beginSession(void) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::beginSession(): Solver undefined.");
+        this->solver->beginSession();
+      }
+
+
+      void SolverEngine::endSession(void) {
+        if (this->solver)
+          this->solver->endSession();
+      }
+
+
+      bool SolverEngine::isSessionActive(void) const {
+        if (!this->solver)
+          return false;
+        return this->solver->isSessionActive();
+      }
+
+
+      void SolverEngine::push(void) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::push(): Solver undefined.");
+        this->solver->push();
+      }
+
+
+      void SolverEngine::pop(void) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::pop(): Solver undefined.");
+        this->solver->pop();
+      }
+
+
+      void SolverEngine::assertConstraint(const triton::ast::SharedAbstractNode& node) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::assertConstraint(): Solver undefined.");
+        this->solver->assertConstraint(node);
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> SolverEngine::checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::checkWithAssumptions(): Solver undefined.");
+        return this->solver->checkWithAssumptions(assumptions, status);
+      }
+
     };
   };
 };
@@ -5,6 +5,7 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <new>
 #include <string>
 
 #include <triton/astContext.hpp>
@@ -33,6 +34,13 @@ namespace triton {
       }
 
 
+      Z3Session::Z3Session()
+        : converter(false, true),
+          solver(converter.getContext()) {
+        this->depth = 0;
+      }
+
+
       Z3Solver::Z3Solver() {
         this->timeout = 0;
       }
@@ -260,6 +268,142 @@ namespace triton {
 
       void Z3Solver::setTimeout(triton::uint32 ms) {
         this->timeout = ms;
+
+        if (this->session) {
+          z3::params p(this->session->converter.getContext());
+          p.set(":timeout", this->timeout);
+          this->session->solver.set(p);
+        }
+      }
+
+
+      Z3Session& Z3Solver::getSession(const char* where) {
+        if (!this->session)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": No session started.");
+        return *this->session;
+      }
+
+
+      void Z3Solver::beginSession(void) {
+        this->session.reset(new(std::nothrow) Z3Session());
+        if (this->session == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::beginSession(): Not enough memory.");
+
+        if (this->timeout)
+          this->setTimeout(this->timeout);
+      }
+
+
+      void Z3Solver::endSession(void) {
+        this->session.reset();
+      }
+
+
+      bool Z3Solver::isSessionActive(void) const {
+        return (this->session != nullptr);
+      }
+
+
+      void Z3Solver::push(void) {
+        Z3Session& session = this->getSession("Z3Solver::push()");
+
+        session.solver.push();
+        session.depth++;
+      }
+
+
+      void Z3Solver::pop(void) {
+        Z3Session& session = this->getSession("Z3Solver::pop()");
+
+        if (session.depth == 0)
+          throw triton::exceptions::SolverEngine("Z3Solver::pop(): No scope to pop.");
+
+        session.solver.pop();
+        session.depth--;
+
+        /* The literals defined in the dropped scope are not constrained anymore */
+        for (auto it = session.literals.begin(); it != session.literals.end();) {
+          if (it->second.second > session.depth)
+            it = session.literals.erase(it);
+          else
+            it++;
+        }
+      }
+
+
+      void Z3Solver::assertConstraint(const triton::ast::SharedAbstractNode& node) {
+        Z3Session& session = this->getSession("Z3Solver::assertConstraint()");
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::assertConstraint(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("Z3Solver::assertConstraint(): Must be a logical node.");
+
+        try {
+          session.solver.add(session.converter.convert(node));
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::assertConstraint(): ") + e.msg());
+        }
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> Z3Solver::checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status) {
+        std::unordered_map<triton::usize, SolverModel> ret;
+        Z3Session& session = this->getSession("Z3Solver::checkWithAssumptions()");
+        z3::context& ctx = session.converter.getContext();
+
+        try {
+          z3::expr_vector literals(ctx);
+
+          /*
+           * z3 only takes literals as assumptions. Each assumption gets a fresh
+           * literal `l` and `l => assumption` is asserted once, thus the same
+           * assumption checked again (e.g. a branch shared by two queries) does
+           * not add anything to the solver.
+           */
+          for (const auto& node : assumptions) {
+            if (node == nullptr || node->isLogical() == false)
+              throw triton::exceptions::SolverEngine("Z3Solver::checkWithAssumptions(): Assumptions must be logical nodes.");
+
+            auto it = session.literals.find(node);
+            if (it == session.literals.end()) {
+              z3::expr literal = z3::to_expr(ctx, Z3_mk_fresh_const(ctx, "assumption", ctx.bool_sort()));
+              session.solver.add(z3::implies(literal, session.converter.convert(node)));
+              it = session.literals.insert(std::make_pair(node, std::make_pair(literal, session.depth))).first;
+            }
+            literals.push_back(it->second.first);
+          }
+
+          z3::check_result res = session.solver.check(literals);
+          this->writeBackStatus(session.solver, res, status);
+
+          if (res == z3::sat) {
+            z3::model m = session.solver.get_model();
+
+            for (triton::uint32 i = 0; i < m.size(); i++) {
+              z3::func_decl z3Variable = m[i];
+              std::string varName = z3Variable.name().str();
+
+              /* Skip the literals of the assumptions */
+              auto var = session.converter.variables.find(varName);
+              if (var == session.converter.variables.end())
+                continue;
+
+              z3::expr exp = m.get_const_interp(z3Variable);
+              triton::uint512 value = triton::uint512(std::string(Z3_get_numeral_string(ctx, exp)));
+
+              SolverModel trionModel = SolverModel(var->second, value);
+              ret[trionModel.getId()] = trionModel;
+            }
+          }
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::checkWithAssumptions(): ") + e.msg());
+        }
+
+        return ret;
       }
 
     };
@@ -5,8 +5,11 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <cstring>
+#include <functional>
 #include <new>
+#include <unordered_set>
 
 #include <triton/exceptions.hpp>
 #include <triton/coreUtils.hpp>
@@ -38,6 +41,9 @@ namespace triton {
         this->numberOfRegisters = this->architecture->numberOfRegisters();
         this->uniqueSymExprId   = 0;
         this->uniqueSymVarId    = 0;
+        this->expressionsLimit  = EXPRESSIONS_MIN_LIMIT;
+        this->historyLimit      = 0;
+        this->historyMark       = 0;
 
         this->symbolicReg.resize(this->numberOfRegisters);
       }
@@ -53,6 +59,10 @@ namespace triton {
         this->architecture                = other.architecture;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->expressionsLimit            = other.expressionsLimit;
+        this->historyLimit                = other.historyLimit;
+        this->historyMark                 = other.historyMark;
+        this->memoryPages                 = other.memoryPages;
         this->memoryReference             = other.memoryReference;
         this->numberOfRegisters           = other.numberOfRegisters;
         this->symbolicExpressions         = other.symbolicExpressions;
@@ -79,6 +89,10 @@ namespace triton {
         this->astCtxt                     = other.astCtxt;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->expressionsLimit            = other.expressionsLimit;
+        this->historyLimit                = other.historyLimit;
+        this->historyMark                 = other.historyMark;
+        this->memoryPages                 = other.memoryPages;
         this->memoryReference             = other.memoryReference;
         this->modes                       = other.modes;
         this->numberOfRegisters           = other.numberOfRegisters;
@@ -92,6 +106,23 @@ namespace triton {
       }
 
 
+      void SymbolicEngine::restore(const SymbolicEngine& other) {
+        triton::usize symExprId = this->uniqueSymExprId;
+        triton::usize symVarId  = this->uniqueSymVarId;
+        triton::usize limit     = this->historyLimit;
+
+        *this = other;
+
+        /* The ast context still knows the variables created after the copy */
+        this->uniqueSymExprId = std::max(symExprId, other.uniqueSymExprId);
+        this->uniqueSymVarId  = std::max(symVarId, other.uniqueSymVarId);
+
+        /* The history limit is a setting, not a state */
+        this->historyLimit    = limit;
+        this->historyMark     = this->uniqueSymExprId;
+      }
+
+
       /*
        * Concretize a register. If the register is setup as nullptr, the next assignment
        * will be over the concretization. This method must be called before symbolic
@@ -135,7 +166,7 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(triton::uint64 addr) {
-        this->memoryReference.erase(addr);
+        this->removeMemoryReference(addr);
         this->removeAlignedMemory(addr, triton::size::byte);
       }
 
@@ -143,6 +174,7 @@ namespace triton {
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
         this->memoryReference.clear();
+        this->memoryPages.clear();
         this->alignedMemoryReference.clear();
       }
 
@@ -173,25 +205,18 @@ namespace triton {
 
       /* Removes an aligned memory */
       void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        /* Remove overloaded positive ranges */
-        for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::byte));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::word));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::dword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::qword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::dqword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::qqword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::dqqword));
-        }
+        /*
+         * The entries are sorted by address and are at most dqqword bytes long, so
+         * the overlapping ones start between address-(dqqword-1) and address+size-1.
+         */
+        triton::uint64 start = (address >= triton::size::dqqword - 1) ? address - (triton::size::dqqword - 1) : 0;
+        auto it = this->alignedMemoryReference.lower_bound(std::make_pair(start, 0));
 
-        /* Remove overloaded negative ranges */
-        for (triton::uint32 index = 1; index < triton::size::dqqword; index++) {
-          if (index < triton::size::word)    this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::word));
-          if (index < triton::size::dword)   this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::dword));
-          if (index < triton::size::qword)   this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::qword));
-          if (index < triton::size::dqword)  this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::dqword));
-          if (index < triton::size::qqword)  this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::qqword));
-          if (index < triton::size::dqqword) this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::dqqword));
+        while (it != this->alignedMemoryReference.end() && it->first.first < address + size) {
+          if (it->first.first + it->first.second > address)
+            it = this->alignedMemoryReference.erase(it);
+          else
+            it++;
         }
       }
 
@@ -363,12 +388,28 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicExpression(): not enough memory");
         }
 
+        /* Dead entries are dropped when the table has doubled since the last sweep */
+        if (this->symbolicExpressions.size() >= this->expressionsLimit)
+          this->removeDeadExpressions();
+
         /* Save and returns the new shared symbolic expression */
         this->symbolicExpressions[id] = expr;
         return expr;
       }
 
 
+      /* Removes the dead entries of the symbolic expressions table */
+      void SymbolicEngine::removeDeadExpressions(void) {
+        for (auto it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end();) {
+          if (it->second.expired())
+            it = this->symbolicExpressions.erase(it);
+          else
+            it++;
+        }
+        this->expressionsLimit = std::max<triton::usize>(EXPRESSIONS_MIN_LIMIT, this->symbolicExpressions.size() * 2);
+      }
+
+
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(const SharedSymbolicExpression& expr) {
         if (this->symbolicExpressions.find(expr->getId()) != this->symbolicExpressions.end()) {
@@ -860,6 +901,11 @@ namespace triton {
           return this->getAlignedMemory(address, size)->getAst();
         }
 
+        /* If the pages of the memory access have no symbolic memory cell, just return its concrete value */
+        if (!this->hasMemoryReference(address, size)) {
+          return this->astCtxt->bv(value, mem.getBitSize());
+        }
+
         /* If the memory access is 1 byte long, just return the appropriate 8-bit vector */
         if (size == 1) {
           const SharedSymbolicExpression& symMem = this->getSymbolicMemory(address);
@@ -1089,7 +1135,39 @@ namespace triton {
 
       /* Adds and assign a new memory reference */
       inline void SymbolicEngine::addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr) {
-        this->memoryReference[mem] = expr;
+        SharedSymbolicExpression& ref = this->memoryReference[mem];
+        if (ref == nullptr)
+          this->memoryPages[mem >> MEMORY_PAGE_SHIFT]++;
+        ref = expr;
+      }
+
+
+      /* Removes a memory reference */
+      void SymbolicEngine::removeMemoryReference(triton::uint64 mem) {
+        if (this->memoryReference.erase(mem) == 0)
+          return;
+
+        auto page = this->memoryPages.find(mem >> MEMORY_PAGE_SHIFT);
+        if (--page->second == 0)
+          this->memoryPages.erase(page);
+      }
+
+
+      /* Returns true if a page of the area contains a memory reference */
+      bool SymbolicEngine::hasMemoryReference(triton::uint64 addr, triton::uint32 size) const {
+        if (size == 0 || this->memoryPages.empty())
+          return false;
+
+        triton::uint64 last = addr + size - 1;
+        if (last < addr)
+          return true;
+
+        for (triton::uint64 page = addr >> MEMORY_PAGE_SHIFT; page <= (last >> MEMORY_PAGE_SHIFT); page++) {
+          if (this->memoryPages.find(page) != this->memoryPages.end())
+            return true;
+        }
+
+        return false;
       }
 
 
@@ -1178,6 +1256,159 @@ namespace triton {
       }
 
 
+      /* Returns true if the expression only holds a symbolic variable or a part of it (see symbolizeMemory() and symbolizeRegister()) */
+      static bool isVariableExpression(const SharedSymbolicExpression& expr) {
+        const triton::ast::SharedAbstractNode& node = expr->getAst();
+
+        if (node->getType() == triton::ast::EXTRACT_NODE)
+          return node->getChildren()[2]->getType() == triton::ast::VARIABLE_NODE;
+
+        return node->getType() == triton::ast::VARIABLE_NODE;
+      }
+
+
+      /* Concretizes the expressions older than symExprId and drops the references to them */
+      void SymbolicEngine::concretizeOlderThan(triton::usize symExprId) {
+        std::vector<triton::usize> ids;
+
+        for (const auto& item : this->symbolicExpressions) {
+          if (item.first < symExprId && !item.second.expired())
+            ids.push_back(item.first);
+        }
+
+        /*
+         * The newest expressions are concretized first, thus the older ones
+         * which are only referenced by them are released before being visited.
+         */
+        std::sort(ids.begin(), ids.end(), std::greater<triton::usize>());
+        for (triton::usize id : ids) {
+          SharedSymbolicExpression expr = this->symbolicExpressions[id].lock();
+          if (expr == nullptr || isVariableExpression(expr))
+            continue;
+
+          const triton::ast::SharedAbstractNode& node = expr->getAst();
+          if (node->getType() != triton::ast::BV_NODE && !node->isLogical())
+            expr->setAst(this->astCtxt->bv(node->evaluate(), node->getBitvectorSize()));
+        }
+
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
+          const SharedSymbolicExpression& expr = this->symbolicReg[i];
+          if (expr != nullptr && expr->getId() < symExprId && !isVariableExpression(expr))
+            this->symbolicReg[i] = nullptr;
+        }
+
+        for (auto it = this->alignedMemoryReference.begin(); it != this->alignedMemoryReference.end();) {
+          if (it->second->getId() < symExprId && !isVariableExpression(it->second))
+            it = this->alignedMemoryReference.erase(it);
+          else
+            it++;
+        }
+
+        for (auto it = this->memoryReference.begin(); it != this->memoryReference.end();) {
+          triton::uint64 addr = it->first;
+          bool old = (it->second->getId() < symExprId && !isVariableExpression(it->second));
+          it++;
+          if (old) {
+            this->removeMemoryReference(addr);
+            this->removeAlignedMemory(addr, triton::size::byte);
+          }
+        }
+      }
+
+
+      void SymbolicEngine::collectGarbage(bool force) {
+        if (force) {
+          this->removeDeadExpressions();
+
+          for (auto it = this->symbolicVariables.begin(); it != this->symbolicVariables.end();) {
+            if (it->second.expired())
+              it = this->symbolicVariables.erase(it);
+            else
+              it++;
+          }
+        }
+
+        /* Applied each time historyLimit expressions have been created */
+        if (this->historyLimit && (force || this->uniqueSymExprId - this->historyMark >= this->historyLimit)) {
+          if (this->uniqueSymExprId > this->historyLimit)
+            this->concretizeOlderThan(this->uniqueSymExprId - this->historyLimit);
+          this->historyMark = this->uniqueSymExprId;
+        }
+      }
+
+
+      void SymbolicEngine::setHistoryLimit(triton::usize limit) {
+        this->historyLimit = limit;
+        this->collectGarbage(true);
+      }
+
+
+      triton::usize SymbolicEngine::getHistoryLimit(void) const {
+        return this->historyLimit;
+      }
+
+
+      /* Walks the expressions and nodes reachable from the registers, the memory and the path constraints */
+      SymbolicStatistics SymbolicEngine::getStatistics(void) const {
+        std::unordered_set<triton::ast::AbstractNode*> nodes;
+        std::unordered_set<triton::usize> exprs;
+        std::vector<triton::ast::AbstractNode*> worklist;
+        SymbolicStatistics stats;
+
+        auto visit = [&](const SharedSymbolicExpression& expr) {
+          if (exprs.insert(expr->getId()).second)
+            worklist.push_back(expr->getAst().get());
+        };
+
+        for (const auto& expr : this->symbolicReg) {
+          if (expr != nullptr) {
+            stats.symbolicRegisters++;
+            visit(expr);
+          }
+        }
+
+        for (const auto& item : this->memoryReference)
+          visit(item.second);
+
+        for (const auto& item : this->alignedMemoryReference)
+          visit(item.second);
+
+        for (const auto& pc : this->pathConstraints) {
+          for (const auto& branch : pc.getBranchConstraints())
+            worklist.push_back(std::get<3>(branch).get());
+        }
+
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.back();
+          worklist.pop_back();
+
+          if (!nodes.insert(node).second)
+            continue;
+
+          stats.reachableBytes += sizeof(triton::ast::AbstractNode) + node->getChildren().size() * sizeof(triton::ast::SharedAbstractNode);
+
+          if (node->getType() == triton::ast::REFERENCE_NODE)
+            visit(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression());
+
+          for (const auto& child : node->getChildren())
+            worklist.push_back(child.get());
+        }
+
+        for (const auto& item : this->symbolicExpressions) {
+          if (!item.second.expired())
+            stats.liveExpressions++;
+        }
+
+        stats.reachableExpressions  = exprs.size();
+        stats.reachableNodes        = nodes.size();
+        stats.reachableBytes       += exprs.size() * sizeof(SymbolicExpression);
+        stats.symbolicMemory        = this->memoryReference.size();
+        stats.pathConstraints       = this->pathConstraints.size();
+
+        return stats;
+      }
+
+
       /* Returns true if memory cell expressions contain symbolic variables. */
       bool SymbolicEngine::isMemorySymbolized(const triton::arch::MemoryAccess& mem) const {
         triton::uint64 addr = mem.getAddress();
@@ -1189,6 +1420,10 @@ namespace triton {
 
       /* Returns true if memory cell expressions contain symbolic variables. */
       bool SymbolicEngine::isMemorySymbolized(triton::uint64 addr, triton::uint32 size) const {
+        if (!this->hasMemoryReference(addr, size)) {
+          return false;
+        }
+
         for (triton::uint32 i = 0; i < size; i++) {
           const SharedSymbolicExpression& expr = this->getSymbolicMemory(addr + i);
           if (expr && expr->isSymbolized()) {
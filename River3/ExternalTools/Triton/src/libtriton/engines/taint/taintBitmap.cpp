@@ -0,0 +1,237 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+
+#include <triton/taintBitmap.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      /* Returns the mask of the `size` lowest bits */
+      static inline triton::uint64 lowMask(triton::uint32 size) {
+        return (size >= 64) ? ~static_cast<triton::uint64>(0) : ((static_cast<triton::uint64>(1) << size) - 1);
+      }
+
+
+      /* Returns the `size` bits (at most 64) of a page from a byte offset, they may lie on two words */
+      static inline triton::uint64 extractBits(const triton::uint64* words, triton::usize offset, triton::uint32 size) {
+        triton::usize word  = offset / 64;
+        triton::usize shift = offset % 64;
+        triton::uint64 bits = words[word] >> shift;
+
+        if (shift + size > 64)
+          bits |= words[word + 1] << (64 - shift);
+
+        return bits & lowMask(size);
+      }
+
+
+      TaintBitmap::Page::Page() {
+        std::memset(this->bits, 0x00, sizeof(this->bits));
+        this->count = 0;
+      }
+
+
+      TaintBitmap::TaintBitmap() {
+        this->count = 0;
+      }
+
+
+      TaintBitmap::TaintBitmap(const TaintBitmap& other) {
+        this->pages = other.pages;
+        this->count = other.count;
+      }
+
+
+      TaintBitmap& TaintBitmap::operator=(const TaintBitmap& other) {
+        this->pages = other.pages;
+        this->count = other.count;
+        return *this;
+      }
+
+
+      void TaintBitmap::clear(void) {
+        this->pages.clear();
+        this->count = 0;
+      }
+
+
+      const TaintBitmap::Page* TaintBitmap::getPage(triton::uint64 index) const {
+        auto it = this->pages.find(index);
+        if (it == this->pages.end())
+          return nullptr;
+        return it->second.get();
+      }
+
+
+      triton::uint64 TaintBitmap::read(triton::uint64 addr, triton::uint32 size) const {
+        triton::uint64 bits = 0;
+        triton::uint32 done = 0;
+
+        while (done < size) {
+          triton::usize offset = (addr + done) % TAINT_PAGE_SIZE;
+          triton::uint32 chunk = static_cast<triton::uint32>(std::min<triton::usize>(size - done, TAINT_PAGE_SIZE - offset));
+          const Page* page     = this->getPage((addr + done) / TAINT_PAGE_SIZE);
+
+          if (page != nullptr)
+            bits |= extractBits(page->bits, offset, chunk) << done;
+
+          done += chunk;
+        }
+
+        return bits;
+      }
+
+
+      void TaintBitmap::write(triton::uint64 addr, triton::uint32 size, triton::uint64 bits) {
+        triton::uint32 done = 0;
+
+        while (done < size) {
+          triton::uint64 index = (addr + done) / TAINT_PAGE_SIZE;
+          triton::usize offset = (addr + done) % TAINT_PAGE_SIZE;
+          triton::uint32 chunk = static_cast<triton::uint32>(std::min<triton::usize>(size - done, TAINT_PAGE_SIZE - offset));
+          triton::uint64 value = (bits >> done) & lowMask(chunk);
+          done += chunk;
+
+          auto it = this->pages.find(index);
+          triton::uint64 old = (it == this->pages.end()) ? 0 : extractBits(it->second->bits, offset, chunk);
+
+          /* Nothing changes, the page is neither created nor duplicated */
+          if (old == value)
+            continue;
+
+          if (it == this->pages.end())
+            it = this->pages.emplace(index, std::make_shared<Page>()).first;
+
+          /* Copy-on-write */
+          else if (it->second.use_count() > 1)
+            it->second = std::make_shared<Page>(*it->second);
+
+          Page* page           = it->second.get();
+          triton::usize word   = offset / 64;
+          triton::usize shift  = offset % 64;
+          triton::uint64 mask  = lowMask(chunk);
+
+          page->bits[word] = (page->bits[word] & ~(mask << shift)) | (value << shift);
+          if (shift + chunk > 64)
+            page->bits[word + 1] = (page->bits[word + 1] & ~(mask >> (64 - shift))) | (value >> (64 - shift));
+
+          triton::usize added   = std::bitset<64>(value).count();
+          triton::usize removed = std::bitset<64>(old).count();
+          page->count = page->count + added - removed;
+          this->count = this->count + added - removed;
+
+          if (page->count == 0)
+            this->pages.erase(it);
+        }
+      }
+
+
+      bool TaintBitmap::isTainted(triton::uint64 addr) const {
+        const Page* page = this->getPage(addr / TAINT_PAGE_SIZE);
+
+        if (page == nullptr)
+          return false;
+
+        triton::usize offset = addr % TAINT_PAGE_SIZE;
+        return (page->bits[offset / 64] >> (offset % 64)) & 1;
+      }
+
+
+      bool TaintBitmap::isTainted(triton::uint64 baseAddr, triton::usize size) const {
+        if (this->count == 0)
+          return false;
+
+        while (size) {
+          triton::usize offset = baseAddr % TAINT_PAGE_SIZE;
+          triton::usize chunk  = std::min<triton::usize>(size, TAINT_PAGE_SIZE - offset);
+          const Page* page     = this->getPage(baseAddr / TAINT_PAGE_SIZE);
+
+          /* A page which is not mapped has no tainted byte */
+          if (page != nullptr) {
+            for (triton::usize index = 0; index < chunk; index += 64) {
+              if (extractBits(page->bits, offset + index, static_cast<triton::uint32>(std::min<triton::usize>(64, chunk - index))))
+                return true;
+            }
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+
+        return false;
+      }
+
+
+      void TaintBitmap::taint(triton::uint64 baseAddr, triton::usize size) {
+        for (triton::usize index = 0; index < size; index += 64) {
+          triton::uint32 chunk = static_cast<triton::uint32>(std::min<triton::usize>(64, size - index));
+          this->write(baseAddr + index, chunk, lowMask(chunk));
+        }
+      }
+
+
+      void TaintBitmap::untaint(triton::uint64 baseAddr, triton::usize size) {
+        if (this->count == 0)
+          return;
+
+        for (triton::usize index = 0; index < size; index += 64) {
+          triton::uint32 chunk = static_cast<triton::uint32>(std::min<triton::usize>(64, size - index));
+          this->write(baseAddr + index, chunk, 0);
+        }
+      }
+
+
+      void TaintBitmap::assign(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        for (triton::usize index = 0; index < size; index += 64) {
+          triton::uint32 chunk = static_cast<triton::uint32>(std::min<triton::usize>(64, size - index));
+          this->write(dst + index, chunk, this->read(src + index, chunk));
+        }
+      }
+
+
+      void TaintBitmap::merge(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        for (triton::usize index = 0; index < size; index += 64) {
+          triton::uint32 chunk = static_cast<triton::uint32>(std::min<triton::usize>(64, size - index));
+          triton::uint64 bits  = this->read(src + index, chunk);
+          if (bits)
+            this->write(dst + index, chunk, this->read(dst + index, chunk) | bits);
+        }
+      }
+
+
+      triton::usize TaintBitmap::size(void) const {
+        return this->count;
+      }
+
+
+      std::unordered_set<triton::uint64> TaintBitmap::getTaintedAddresses(void) const {
+        std::unordered_set<triton::uint64> ret;
+
+        ret.reserve(this->count);
+        for (const auto& item : this->pages) {
+          for (triton::usize word = 0; word < TAINT_PAGE_SIZE / 64; word++) {
+            triton::uint64 bits = item.second->bits[word];
+            for (triton::usize bit = 0; bits; bit++, bits >>= 1) {
+              if (bits & 1)
+                ret.insert(item.first * TAINT_PAGE_SIZE + word * 64 + bit);
+            }
+          }
+        }
+
+        return ret;
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
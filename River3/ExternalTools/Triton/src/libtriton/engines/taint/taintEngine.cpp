@@ -57,8 +57,8 @@ namespace triton {
 
 
       /* Returns the tainted addresses */
-      const std::unordered_set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
-        return this->taintedMemory;
+      std::unordered_set<triton::uint64> TaintEngine::getTaintedMemory(void) const {
+        return this->taintedMemory.getTaintedAddresses();
       }
 
 
@@ -66,8 +66,10 @@ namespace triton {
       std::unordered_set<const triton::arch::Register*> TaintEngine::getTaintedRegisters(void) const {
         std::unordered_set<const triton::arch::Register*> res;
 
-        for (auto id : this->taintedRegisters)
-          res.insert(&this->cpu.getRegister(id));
+        for (triton::usize id = 0; id < this->taintedRegisters.size(); id++) {
+          if (this->taintedRegisters.test(id))
+            res.insert(&this->cpu.getRegister(static_cast<triton::arch::register_e>(id)));
+        }
 
         return res;
       }
@@ -75,13 +77,8 @@ namespace triton {
 
       /* Returns true of false if the memory address is currently tainted */
       bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem, bool mode) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+        if (this->taintedMemory.isTainted(mem.getAddress(), mem.getSize()))
+          return TAINTED;
 
         /* Spread the taint through pointers if the mode is enabled */
         if (mode && this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
@@ -99,10 +96,8 @@ namespace triton {
 
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+        if (this->taintedMemory.isTainted(addr, size))
+          return TAINTED;
 
         return !TAINTED;
       }
@@ -110,7 +105,7 @@ namespace triton {
 
       /* Returns true of false if the register is currently tainted */
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
-        if (this->taintedRegisters.find(reg.getParent()) != this->taintedRegisters.end())
+        if (this->taintedRegisters.test(reg.getParent()))
           return TAINTED;
 
         return !TAINTED;
@@ -133,7 +128,7 @@ namespace triton {
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.insert(reg.getParent());
+        this->taintedRegisters.set(reg.getParent());
 
         return TAINTED;
       }
@@ -143,7 +138,7 @@ namespace triton {
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.erase(reg.getParent());
+        this->taintedRegisters.reset(reg.getParent());
 
         return !TAINTED;
       }
@@ -193,14 +188,10 @@ namespace triton {
 
       /* Taint the memory */
       bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+        this->taintedMemory.taint(mem.getAddress(), mem.getSize());
 
         return TAINTED;
       }
@@ -210,21 +201,17 @@ namespace triton {
       bool TaintEngine::taintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+        this->taintedMemory.taint(addr, 1);
         return TAINTED;
       }
 
 
       /* Untaint the memory */
       bool TaintEngine::untaintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
+        this->taintedMemory.untaint(mem.getAddress(), mem.getSize());
 
         return !TAINTED;
       }
@@ -234,7 +221,7 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->taintedMemory.untaint(addr, 1);
         return !TAINTED;
       }
 
@@ -325,7 +312,7 @@ namespace triton {
           const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
           if (byte == nullptr)
             continue;
-          byte->isTainted = this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i);
+          byte->isTainted = this->taintedMemory.isTainted(memAddrDst + i) | this->taintedMemory.isTainted(memAddrSrc + i);
         }
 
         return flag;
@@ -398,7 +385,7 @@ namespace triton {
           const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
           if (byte == nullptr)
             continue;
-          byte->isTainted = this->isMemoryTainted(memAddrSrc + i);
+          byte->isTainted = this->taintedMemory.isTainted(memAddrSrc + i);
         }
 
         return flag;
@@ -488,14 +475,10 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
-        for (triton::uint32 offset = 0; offset < readSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            isTainted = TAINTED;
-          }
-          else
-            this->untaintMemory(addrDst+offset);
-        }
+        /* Copy the taint of the source, a word at a time */
+        this->taintedMemory.assign(addrDst, addrSrc, readSize);
+        if (this->taintedMemory.isTainted(addrDst, readSize))
+          isTainted = TAINTED;
 
         /* Spread the taint through pointers if the mode is enabled */
         if (this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
@@ -567,12 +550,10 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
-        /* Check source */
-        for (triton::uint32 offset = 0; offset < writeSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            isTainted = TAINTED;
-          }
+        /* Check source, the taint is added a word at a time */
+        if (this->taintedMemory.isTainted(addrSrc, writeSize)) {
+          this->taintedMemory.merge(addrDst, addrSrc, writeSize);
+          isTainted = TAINTED;
         }
 
         /* Spread the taint through pointers if the mode is enabled */
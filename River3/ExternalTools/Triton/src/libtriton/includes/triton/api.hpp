@@ -8,12 +8,17 @@
 #ifndef TRITON_API_H
 #define TRITON_API_H
 
+#include <map>
+#include <memory>
+
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
 #include <triton/astRepresentation.hpp>
+#include <triton/branchFlip.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/emulation.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
 #include <triton/irBuilder.hpp>
@@ -82,6 +87,24 @@ namespace triton {
         //! The IR builder.
         triton::arch::IrBuilder* irBuilder = nullptr;
 
+        //! A snapshot of the concrete, symbolic and taint states.
+        struct Snapshot {
+          //! The concrete registers and memory.
+          std::unique_ptr<triton::arch::CpuInterface> cpu;
+
+          //! The symbolic registers, memory and path constraints.
+          std::unique_ptr<triton::engines::symbolic::SymbolicEngine> symbolic;
+
+          //! The tainted registers and memory.
+          std::unique_ptr<triton::engines::taint::TaintEngine> taint;
+        };
+
+        //! The snapshots, id -> snapshot.
+        std::map<triton::usize, Snapshot> snapshots;
+
+        //! The id of the next snapshot.
+        triton::usize uniqueSnapshotId = 0;
+
 
       public:
         //! A shortcut to access to a Register class from a register name.
@@ -243,6 +266,15 @@ namespace triton {
         //! [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported.
         TRITON_EXPORT bool processing(triton::arch::Instruction& inst);
 
+        /*!
+         * \brief [**proccesing api**] - Emulates from `pc` until a stop condition is met.
+         *
+         * \details Instructions are disassembled once and taken from a cache afterwards, see triton::arch::Architecture::decode().
+         * The addresses of the basic blocks entered are returned in triton::arch::RunResult::blocks.
+         * An instruction without semantics stops the emulation with triton::arch::STOP_UNSUPPORTED, `pc` is left on it.
+         */
+        TRITON_EXPORT triton::arch::RunResult run(triton::uint64 pc, const triton::arch::StopConditions& conditions);
+
         //! [**proccesing api**] - Initializes everything.
         TRITON_EXPORT void initEngines(void);
 
@@ -254,6 +286,22 @@ namespace triton {
 
 
 
+        /* Snapshot API ================================================================================== */
+
+        //! [**snapshot api**] - Takes a snapshot of the concrete registers and memory, the symbolic states, the path constraints and the taint states. Returns its id.
+        TRITON_EXPORT triton::usize takeSnapshot(void);
+
+        //! [**snapshot api**] - Restores the states of a snapshot. The snapshot is kept, it can be restored again.
+        TRITON_EXPORT void restoreSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Removes a snapshot.
+        TRITON_EXPORT void removeSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Returns true if the snapshot exists.
+        TRITON_EXPORT bool isSnapshotValid(triton::usize id) const;
+
+
+
         /* IR API ======================================================================================== */
 
         //! [**IR builder api**] - Builds the instruction semantics. Returns true if the instruction is supported. You must define an architecture before. \sa processing().
@@ -488,6 +536,18 @@ namespace triton {
         //! [**symbolic api**] - Concretizes a specific symbolic register reference.
         TRITON_EXPORT void concretizeRegister(const triton::arch::Register& reg);
 
+        //! [**symbolic api**] - Removes the dead entries of the expressions and variables tables, and concretizes the references older than the history limit.
+        TRITON_EXPORT void collectGarbage(void);
+
+        //! [**symbolic api**] - Sets the number of the most recent expressions kept symbolic, 0 for an unbounded history. \sa triton::engines::symbolic::SymbolicEngine::collectGarbage().
+        TRITON_EXPORT void setHistoryLimit(triton::usize limit);
+
+        //! [**symbolic api**] - Returns the number of the most recent expressions kept symbolic, 0 for an unbounded history.
+        TRITON_EXPORT triton::usize getHistoryLimit(void) const;
+
+        //! [**symbolic api**] - Returns the size of the symbolic state.
+        TRITON_EXPORT triton::engines::symbolic::SymbolicStatistics getSymbolicStatistics(void) const;
+
         //! [**symbolic api**] - Slices all expressions from a given one.
         TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
@@ -558,6 +618,45 @@ namespace triton {
         //! [**solver api**] - Defines a solver timeout (in milliseconds).
         TRITON_EXPORT void setSolverTimeout(triton::uint32 ms);
 
+        //! [**solver api**] - Starts an incremental solving session. A previous session is dropped.
+        TRITON_EXPORT void beginSolverSession(void);
+
+        //! [**solver api**] - Ends the incremental solving session.
+        TRITON_EXPORT void endSolverSession(void);
+
+        //! [**solver api**] - Returns true if an incremental solving session is started.
+        TRITON_EXPORT bool isSolverSessionActive(void) const;
+
+        //! [**solver api**] - Saves the constraints of the solving session.
+        TRITON_EXPORT void pushSolverScope(void);
+
+        //! [**solver api**] - Drops the constraints asserted in the solving session since the last pushSolverScope().
+        TRITON_EXPORT void popSolverScope(void);
+
+        //! [**solver api**] - Adds a constraint to the solving session.
+        TRITON_EXPORT void assertSolverConstraint(const triton::ast::SharedAbstractNode& node);
+
+        /*!
+         * \brief [**solver api**] - Checks the constraints of the solving session and the assumptions, which only hold for this check. Returns a model if it is satisfiable.
+         *
+         * \details
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::solver::SolverModel> checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status = nullptr);
+
+        /*!
+         * \brief [**solver api**] - Computes the models which take the branches not taken by a path.
+         *
+         * \details
+         * Every branch not taken of the path constraints from `startIndex` is queried with the predicates
+         * taken before it. The path is asserted once in a solving session, thus the prefix is not rebuilt
+         * and not converted again for each query. At most `limit` queries are done (0 for no limit) and
+         * each of them is bounded by `timeout` milliseconds (0 keeps the solver timeout). A started
+         * solving session is kept, the path is asserted in a new scope of it.
+         */
+        TRITON_EXPORT std::vector<triton::engines::solver::BranchFlip> solveBranchFlips(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::usize startIndex = 0, triton::usize limit = 0, triton::uint32 timeout = 0);
+
 
 
         /* Taint engine API ============================================================================== */
@@ -566,7 +665,7 @@ namespace triton {
         TRITON_EXPORT triton::engines::taint::TaintEngine* getTaintEngine(void);
 
         //! [**taint api**] - Returns the tainted addresses.
-        TRITON_EXPORT const std::unordered_set<triton::uint64>& getTaintedMemory(void) const;
+        TRITON_EXPORT std::unordered_set<triton::uint64> getTaintedMemory(void) const;
 
         //! [**taint api**] - Returns the tainted registers.
         TRITON_EXPORT std::unordered_set<const triton::arch::Register*> getTaintedRegisters(void) const;
@@ -43,6 +43,14 @@ namespace triton {
       BE_ENDIANNESS, /*!< Big endian.        */
     };
 
+    /*! Reasons why an emulation stops (see triton::API::run()) */
+    enum stop_e {
+      STOP_END_ADDRESS = 0, /*!< The end address is reached.                  */
+      STOP_REGION_EXIT,     /*!< The program counter left the region.         */
+      STOP_BUDGET,          /*!< The instruction budget is spent.             */
+      STOP_UNSUPPORTED,     /*!< The instruction at pc has no semantics.      */
+    };
+
     /*! Types of operand */
     enum operand_e {
       OP_INVALID = 0, //!< invalid operand
@@ -16,6 +16,7 @@
 #include <triton/archEnums.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/cpuInterface.hpp>
+#include <triton/decodeCache.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
@@ -53,6 +54,9 @@ namespace triton {
         //! Instance to the real CPU class.
         std::unique_ptr<triton::arch::CpuInterface> cpu;
 
+        //! The instructions already disassembled, see decode().
+        triton::arch::DecodeCache decodeCache;
+
       public:
         //! Constructor.
         TRITON_EXPORT Architecture(triton::callbacks::Callbacks* callbacks=nullptr);
@@ -108,6 +112,12 @@ namespace triton {
         //! Clears the architecture states (registers and memory).
         TRITON_EXPORT void clearArchitecture(void);
 
+        //! Returns a copy of the CPU states (registers and memory), the memory pages are shared until written.
+        TRITON_EXPORT std::unique_ptr<triton::arch::CpuInterface> copyCpuState(void) const;
+
+        //! Restores the CPU states (registers and memory) from a copy returned by copyCpuState().
+        TRITON_EXPORT void restoreCpuState(const triton::arch::CpuInterface& state);
+
         //! Returns all registers.
         TRITON_EXPORT const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& getAllRegisters(void) const;
 
@@ -135,6 +145,17 @@ namespace triton {
         //! Disassembles the instruction according to the architecture.
         TRITON_EXPORT void disassembly(triton::arch::Instruction& inst) const;
 
+        /*!
+         * \brief Returns the disassembled instruction at an address. The opcodes are read from the concrete memory.
+         *
+         * \details Instructions are kept in a cache until the memory they lie on is written through
+         * this class. Writes done directly on the CPU instance are not seen, clearDecodeCache() must be called then.
+         */
+        TRITON_EXPORT const triton::arch::Instruction& decode(triton::uint64 addr);
+
+        //! Drops all the instructions kept by decode().
+        TRITON_EXPORT void clearDecodeCache(void);
+
         //! Builds the instruction semantics according to the architecture. Returns true if the instruction is supported.
         TRITON_EXPORT bool buildSemantics(triton::arch::Instruction& inst);
 
@@ -100,6 +100,9 @@ namespace triton {
         //! Contect use to create this node
         SharedAstContext ctxt;
 
+        //! Removes the node from the parents of `child`. Called when the node is destroyed, as a weak reference would keep its memory.
+        void detach(AbstractNode* child);
+
       public:
         //! Constructor.
         TRITON_EXPORT AbstractNode(triton::ast::ast_e type, const SharedAstContext& ctxt);
@@ -738,6 +741,7 @@ namespace triton {
 
       public:
         TRITON_EXPORT ReferenceNode(const triton::engines::symbolic::SharedSymbolicExpression& expr);
+        TRITON_EXPORT ~ReferenceNode();
         TRITON_EXPORT void init(bool withParents=false);
         TRITON_EXPORT const triton::engines::symbolic::SharedSymbolicExpression& getSymbolicExpression(void) const;
     };
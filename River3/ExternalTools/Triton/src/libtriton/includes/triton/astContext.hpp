@@ -48,6 +48,9 @@ namespace triton {
    *  @{
    */
 
+    //! The size of the interned nodes table below which dead nodes are not removed.
+    const triton::usize INTERN_MIN_LIMIT = 0x1000;
+
     //! \class AstContext
     /*! \brief AST Context - Used as AST builder. */
     class AstContext : public std::enable_shared_from_this<AstContext> {
@@ -64,6 +67,29 @@ namespace triton {
         //! The list of nodes
         std::deque<SharedAbstractNode> nodes;
 
+        //! The identity of a node for the hash-consing: its type, its children and the value of an integer node.
+        struct InternKey {
+          triton::ast::ast_e type;
+          std::vector<AbstractNode*> children;
+          triton::uint512 value;
+
+          bool operator==(const InternKey& other) const;
+        };
+
+        //! The hash of an InternKey.
+        struct InternKeyHash {
+          std::size_t operator()(const InternKey& key) const;
+        };
+
+        //! The interned nodes (see triton::modes::AST_HASH_CONSING).
+        std::unordered_map<InternKey, triton::ast::WeakAbstractNode, InternKeyHash> interned;
+
+        //! The number of interned nodes which triggers the removal of the dead ones.
+        triton::usize internLimit;
+
+        //! Initializes a new node, or returns the live node identical to it when the hash-consing is enabled.
+        SharedAbstractNode intern(const SharedAbstractNode& node, const triton::uint512& value=0);
+
         //! Returns simplified concatenation.
         SharedAbstractNode simplify_concat(std::vector<SharedAbstractNode> exprs);
 
@@ -196,7 +222,7 @@ namespace triton {
           SharedAbstractNode node = std::make_shared<CompoundNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
-          node->init();
+          node = this->intern(node);
           return this->collect(node);
         }
 
@@ -208,7 +234,7 @@ namespace triton {
           SharedAbstractNode node = std::make_shared<ConcatNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
-          node->init();
+          node = this->intern(node);
 
           if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
             if (node->isSymbolized() == false) {
@@ -244,7 +270,7 @@ namespace triton {
           SharedAbstractNode node = std::make_shared<ForallNode>(vars, body);
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
-          node->init();
+          node = this->intern(node);
           return this->collect(node);
         }
 
@@ -265,7 +291,7 @@ namespace triton {
           SharedAbstractNode node = std::make_shared<LandNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
-          node->init();
+          node = this->intern(node);
           return this->collect(node);
         }
 
@@ -283,7 +309,7 @@ namespace triton {
           SharedAbstractNode node = std::make_shared<LorNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
-          node->init();
+          node = this->intern(node);
           return this->collect(node);
         }
 
@@ -295,7 +321,7 @@ namespace triton {
           SharedAbstractNode node = std::make_shared<LxorNode>(exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
-          node->init();
+          node = this->intern(node);
           return this->collect(node);
         }
 
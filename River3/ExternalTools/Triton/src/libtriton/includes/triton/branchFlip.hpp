@@ -0,0 +1,71 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_BRANCHFLIP_HPP
+#define TRITON_BRANCHFLIP_HPP
+
+#include <unordered_map>
+
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class BranchFlip
+       *  \brief The query of a branch not taken (see triton::API::solveBranchFlips()). */
+      class BranchFlip {
+        public:
+          //! The index of the path constraint.
+          triton::usize pcIndex = 0;
+
+          //! The index of the branch in the path constraint.
+          triton::usize branchIndex = 0;
+
+          //! The source address of the branch.
+          triton::uint64 srcAddr = 0;
+
+          //! The destination address of the branch.
+          triton::uint64 dstAddr = 0;
+
+          //! The status of the query.
+          triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+
+          //! The model which takes the branch, symbolic variable id -> model. Empty if the query is not satisfiable.
+          std::unordered_map<triton::usize, triton::engines::solver::SolverModel> model;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_BRANCHFLIP_HPP */
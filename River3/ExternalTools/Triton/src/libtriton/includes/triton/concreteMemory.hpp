@@ -0,0 +1,132 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_CONCRETEMEMORY_HPP
+#define TRITON_CONCRETEMEMORY_HPP
+
+#include <memory>
+#include <unordered_map>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The size of a concrete memory page.
+    const triton::usize CONCRETE_PAGE_SIZE = 0x1000;
+
+    /*! \class ConcreteMemory
+     *  \brief The concrete memory of a CPU.
+     *
+     * \details Memory is kept in 4 KiB pages found through a sparse page directory, a
+     * range access costs one directory lookup per page. Every page keeps a bitmap of
+     * its defined bytes, a byte is defined once it has been written and until it is
+     * cleared. Pages without defined bytes are released.
+     *
+     * Pages are shared between copies and duplicated on their first write (copy-on-write),
+     * thus copying a memory costs in proportion to the number of pages, not their content.
+     */
+    class ConcreteMemory {
+      protected:
+        //! A memory page.
+        struct Page {
+          //! The content of the page.
+          triton::uint8 data[CONCRETE_PAGE_SIZE];
+
+          //! The defined bytes of the page, one bit per byte.
+          triton::uint64 defined[CONCRETE_PAGE_SIZE / 64];
+
+          //! The number of defined bytes.
+          triton::usize count;
+
+          //! Constructor.
+          Page();
+        };
+
+        //! The page directory, page number -> page.
+        std::unordered_map<triton::uint64, std::shared_ptr<Page>> pages;
+
+        //! The number of defined bytes.
+        triton::usize count;
+
+        //! The page number of the last page used.
+        mutable triton::uint64 lastIndex;
+
+        //! The last page used, nullptr if none.
+        mutable Page* lastPage;
+
+        //! True if the last page used is not shared and can be written.
+        mutable bool lastWritable;
+
+        //! Returns the page of an address for reading, nullptr if it is not mapped.
+        const Page* getPage(triton::uint64 index) const;
+
+        //! Returns the page of an address for writing, it is created or duplicated if needed.
+        Page* getWritablePage(triton::uint64 index);
+
+        //! Forgets the last page used.
+        void invalidate(void) const;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT ConcreteMemory();
+
+        //! Constructor by copy, pages are shared until written.
+        TRITON_EXPORT ConcreteMemory(const ConcreteMemory& other);
+
+        //! Copies a ConcreteMemory, pages are shared until written.
+        TRITON_EXPORT ConcreteMemory& operator=(const ConcreteMemory& other);
+
+        //! Clears the whole memory.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the concrete value of a byte, 0 if it is not defined.
+        TRITON_EXPORT triton::uint8 getByte(triton::uint64 addr) const;
+
+        //! Sets the concrete value of a byte.
+        TRITON_EXPORT void setByte(triton::uint64 addr, triton::uint8 value);
+
+        //! Reads a memory area, the undefined bytes are read as 0.
+        TRITON_EXPORT void getArea(triton::uint64 baseAddr, triton::uint8* area, triton::usize size) const;
+
+        //! Writes a memory area.
+        TRITON_EXPORT void setArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
+
+        //! Returns true if all the bytes of a memory area are defined.
+        TRITON_EXPORT bool isDefined(triton::uint64 baseAddr, triton::usize size) const;
+
+        //! Undefines the bytes of a memory area.
+        TRITON_EXPORT void clearArea(triton::uint64 baseAddr, triton::usize size);
+
+        //! Returns the number of defined bytes.
+        TRITON_EXPORT triton::usize size(void) const;
+
+        //! Returns the number of mapped pages.
+        TRITON_EXPORT triton::usize getPageCount(void) const;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONCRETEMEMORY_HPP */
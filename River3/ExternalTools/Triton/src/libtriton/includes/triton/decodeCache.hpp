@@ -0,0 +1,113 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_DECODECACHE_HPP
+#define TRITON_DECODECACHE_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The size of a code page of the decode cache.
+    const triton::usize DECODE_PAGE_SIZE = 0x1000;
+
+    //! A page number that is never used.
+    const triton::uint64 DECODE_NO_PAGE = static_cast<triton::uint64>(-1);
+
+    /*! \class DecodeCache
+     *  \brief The cache of disassembled instructions.
+     *
+     * \details Instructions are kept by address, in the state returned by the disassembler
+     * (operands, type, prefix, size) and without semantics. Every cached instruction is
+     * also indexed by the code pages it lies on, thus a write to memory only drops the
+     * instructions of the pages it touches.
+     *
+     * When the whole memory may have changed (e.g. a snapshot is restored) the cache
+     * is aged instead of cleared. An old instruction is stale, its opcodes must be
+     * compared with the memory before it is used again.
+     */
+    class DecodeCache {
+      protected:
+        //! A cached instruction.
+        struct Entry {
+          //! The disassembled instruction.
+          triton::arch::Instruction inst;
+
+          //! The age of the cache when the instruction was last checked.
+          triton::usize epoch;
+        };
+
+        //! The instructions, address -> entry.
+        std::unordered_map<triton::uint64, Entry> instructions;
+
+        //! The instructions of every code page, page number -> addresses.
+        std::unordered_map<triton::uint64, std::vector<triton::uint64>> pages;
+
+        //! The age of the cache.
+        triton::usize epoch;
+
+        //! Drops the instruction at an address, its entry in the page `skipPage` is left as is.
+        void remove(triton::uint64 addr, triton::uint64 skipPage);
+
+        //! Returns the number of the first page of an instruction.
+        triton::uint64 firstPage(const triton::arch::Instruction& inst) const;
+
+        //! Returns the number of the last page of an instruction.
+        triton::uint64 lastPage(const triton::arch::Instruction& inst) const;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT DecodeCache();
+
+        //! Returns the instruction at an address, nullptr if it is not cached. `stale` is set if it must be checked.
+        TRITON_EXPORT const triton::arch::Instruction* find(triton::uint64 addr, bool& stale) const;
+
+        //! Adds a disassembled instruction and returns the cached one.
+        TRITON_EXPORT const triton::arch::Instruction& insert(const triton::arch::Instruction& inst);
+
+        //! Marks the instruction at an address as checked.
+        TRITON_EXPORT void refresh(triton::uint64 addr);
+
+        //! Drops the instructions of the code pages touched by a memory area.
+        TRITON_EXPORT void invalidate(triton::uint64 baseAddr, triton::usize size);
+
+        //! Makes all the instructions stale.
+        TRITON_EXPORT void age(void);
+
+        //! Drops all the instructions.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the number of cached instructions.
+        TRITON_EXPORT triton::usize size(void) const;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DECODECACHE_HPP */
@@ -0,0 +1,74 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EMULATION_HPP
+#define TRITON_EMULATION_HPP
+
+#include <limits>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class StopConditions
+     *  \brief The conditions that stop an emulation (see triton::API::run()). */
+    class StopConditions {
+      public:
+        //! The emulation stops before executing the instruction at this address. 0 disables the condition.
+        triton::uint64 endAddress = 0;
+
+        //! The first address of the region the program counter must stay in.
+        triton::uint64 regionBegin = 0;
+
+        //! The last address of the region the program counter must stay in.
+        triton::uint64 regionEnd = std::numeric_limits<triton::uint64>::max();
+
+        //! The maximum number of instructions executed. 0 disables the condition.
+        triton::usize budget = 0;
+    };
+
+    /*! \class RunResult
+     *  \brief The outcome of an emulation (see triton::API::run()). */
+    class RunResult {
+      public:
+        //! Why the emulation stopped.
+        triton::arch::stop_e reason = triton::arch::STOP_END_ADDRESS;
+
+        //! The program counter when the emulation stopped, the next instruction to execute.
+        triton::uint64 pc = 0;
+
+        //! The number of instructions executed.
+        triton::usize count = 0;
+
+        //! The addresses of the basic blocks entered, in execution order. The first one is the start address.
+        std::vector<triton::uint64> blocks;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EMULATION_HPP */
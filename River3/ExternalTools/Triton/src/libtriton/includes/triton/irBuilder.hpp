@@ -80,6 +80,9 @@ namespace triton {
         //! x86 ISA builder.
         triton::arch::SemanticsInterface* x86Isa;
 
+        //! x86 concrete ISA builder, used by the CONCRETE_ONLY mode.
+        triton::arch::SemanticsInterface* x86ConcreteIsa;
+
       public:
         //! Constructor.
         TRITON_EXPORT IrBuilder(triton::arch::Architecture* architecture,
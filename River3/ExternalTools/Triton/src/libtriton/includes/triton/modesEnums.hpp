@@ -28,7 +28,9 @@ namespace triton {
     //! Enumerates all kinds of mode.
     enum mode_e {
       ALIGNED_MEMORY,                 //!< [symbolic] Keep a map of aligned memory.
+      AST_HASH_CONSING,               //!< [AST] Reuse the live node of an identical operation instead of building a new one.
       AST_OPTIMIZATIONS,              //!< [AST] Classical arithmetic optimisations to reduce the depth of the trees.
+      CONCRETE_ONLY,                  //!< [symbolic] Execute the common x86 instructions concretely, without AST nor symbolic expression.
       CONCRETIZE_UNDEFINED_REGISTERS, //!< [symbolic] Concretize every registers tagged as undefined (see #750).
       CONSTANT_FOLDING,               //!< [symbolic] Perform a constant folding optimization of sub ASTs which do not contain symbolic variables.
       ONLY_ON_SYMBOLIZED,             //!< [symbolic] Perform symbolic execution only on symbolized expressions.
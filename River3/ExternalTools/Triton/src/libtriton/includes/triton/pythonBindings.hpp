@@ -90,6 +90,12 @@ namespace triton {
       //! Initializes the MODE python namespace.
       void initModeNamespace(PyObject* modeDict);
 
+      //! Initializes the SOLVER_STATE python namespace.
+      void initSolverStateNamespace(PyObject* solverStateDict);
+
+      //! Initializes the STOP python namespace.
+      void initStopNamespace(PyObject* stopDict);
+
       //! Initializes the SYMBOLIC python namespace.
       void initSymbolicNamespace(PyObject* symbolicDict);
 
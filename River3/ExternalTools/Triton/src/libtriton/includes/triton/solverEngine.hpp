@@ -57,6 +57,9 @@ namespace triton {
           //! Instance to the real solver class.
           std::unique_ptr<triton::engines::solver::SolverInterface> solver;
 
+          //! The solver timeout (in milliseconds), 0 if unlimited.
+          triton::uint32 timeout;
+
         public:
           //! Constructor.
           TRITON_EXPORT SolverEngine();
@@ -102,6 +105,36 @@ namespace triton {
 
           //! Defines a solver timeout (in milliseconds).
           TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Returns the solver timeout (in milliseconds), 0 if unlimited.
+          TRITON_EXPORT triton::uint32 getTimeout(void) const;
+
+          //! Starts an incremental solving session. A previous session is dropped.
+          TRITON_EXPORT void beginSession(void);
+
+          //! Ends the incremental solving session.
+          TRITON_EXPORT void endSession(void);
+
+          //! Returns true if an incremental solving session is started.
+          TRITON_EXPORT bool isSessionActive(void) const;
+
+          //! Saves the constraints of the session.
+          TRITON_EXPORT void push(void);
+
+          //! Drops the constraints asserted since the last push().
+          TRITON_EXPORT void pop(void);
+
+          //! Adds a constraint to the session.
+          TRITON_EXPORT void assertConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Checks the constraints of the session and the assumptions, which only hold for this check. Returns a model if it is satisfiable.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status = nullptr);
       };
 
     /*! @} End of solver namespace */
@@ -13,6 +13,7 @@
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/exceptions.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/tritonTypes.hpp>
@@ -73,6 +74,47 @@ namespace triton {
 
           //! Defines a solver timeout (in milliseconds).
           TRITON_EXPORT virtual void setTimeout(triton::uint32 ms) = 0;
+
+          //! Starts an incremental solving session. A previous session is dropped.
+          TRITON_EXPORT virtual void beginSession(void) {
+            throw triton::exceptions::SolverEngine("SolverInterface::beginSession(): Incremental solving is not supported by this solver.");
+          }
+
+          //! Ends the incremental solving session.
+          TRITON_EXPORT virtual void endSession(void) {
+            throw triton::exceptions::SolverEngine("SolverInterface::endSession(): Incremental solving is not supported by this solver.");
+          }
+
+          //! Returns true if an incremental solving session is started.
+          TRITON_EXPORT virtual bool isSessionActive(void) const {
+            return false;
+          }
+
+          //! Saves the constraints of the session.
+          TRITON_EXPORT virtual void push(void) {
+            throw triton::exceptions::SolverEngine("SolverInterface::push(): Incremental solving is not supported by this solver.");
+          }
+
+          //! Drops the constraints asserted since the last push().
+          TRITON_EXPORT virtual void pop(void) {
+            throw triton::exceptions::SolverEngine("SolverInterface::pop(): Incremental solving is not supported by this solver.");
+          }
+
+          //! Adds a constraint to the session.
+          TRITON_EXPORT virtual void assertConstraint(const triton::ast::SharedAbstractNode& node) {
+            throw triton::exceptions::SolverEngine("SolverInterface::assertConstraint(): Incremental solving is not supported by this solver.");
+          }
+
+          //! Checks the constraints of the session and the assumptions, which only hold for this check. Returns a model if it is satisfiable.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT virtual std::unordered_map<triton::usize, SolverModel> checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status = nullptr) {
+            throw triton::exceptions::SolverEngine("SolverInterface::checkWithAssumptions(): Incremental solving is not supported by this solver.");
+          }
       };
 
     /*! @} End of solver namespace */
@@ -26,6 +26,7 @@
 #include <triton/symbolicEnums.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicSimplification.hpp>
+#include <triton/symbolicStatistics.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -54,6 +55,12 @@ namespace triton {
      *  @{
      */
 
+      //! The size of the symbolic expressions table below which dead entries are not removed.
+      const triton::usize EXPRESSIONS_MIN_LIMIT = 0x1000;
+
+      //! The log2 of the size of the pages summarizing the symbolic memory.
+      const triton::uint32 MEMORY_PAGE_SHIFT = 12;
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
@@ -105,9 +112,26 @@ namespace triton {
            */
           std::unordered_map<triton::uint64, SharedSymbolicExpression> memoryReference;
 
+          /*! \brief map of page -> number of symbolic memory cells
+           *
+           * \details
+           * **item1**: memory address >> MEMORY_PAGE_SHIFT<br>
+           * **item2**: number of entries of memoryReference in the page
+           */
+          std::unordered_map<triton::uint64, triton::uint32> memoryPages;
+
           //! Symbolic register state.
           std::vector<SharedSymbolicExpression> symbolicReg;
 
+          //! The size of the symbolic expressions table which triggers the removal of the dead entries.
+          triton::usize expressionsLimit;
+
+          //! The number of the most recent expressions kept symbolic, 0 for an unbounded history.
+          triton::usize historyLimit;
+
+          //! The expression id at which the history limit has been applied for the last time.
+          triton::usize historyMark;
+
         private:
           //! Reference to the context managing ast nodes.
           triton::ast::SharedAstContext astCtxt;
@@ -142,6 +166,18 @@ namespace triton {
           //! Adds a symbolic memory reference.
           inline void addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr);
 
+          //! Removes a symbolic memory reference.
+          void removeMemoryReference(triton::uint64 mem);
+
+          //! Returns true if a memory cell of the area may have a symbolic memory reference. Only checks the pages.
+          bool hasMemoryReference(triton::uint64 addr, triton::uint32 size) const;
+
+          //! Removes the dead entries of the symbolic expressions table.
+          void removeDeadExpressions(void);
+
+          //! Replaces the AST of the expressions older than `symExprId` by their value and drops the register and memory references to them. The symbolic variables are kept.
+          void concretizeOlderThan(triton::usize symExprId);
+
           //! Returns the AST corresponding to the extend operation. Mainly used for AArch64 operands.
           triton::ast::SharedAbstractNode getExtendAst(const triton::arch::arm::ArmOperandProperties& extend, const triton::ast::SharedAbstractNode& node);
 
@@ -167,6 +203,9 @@ namespace triton {
           //! Copies a SymbolicEngine.
           TRITON_EXPORT SymbolicEngine& operator=(const SymbolicEngine& other);
 
+          //! Restores the symbolic states of a copy. Unlike operator=, the expression and variable ids are not given again.
+          TRITON_EXPORT void restore(const SymbolicEngine& other);
+
           //! Creates a new shared symbolic expression.
           TRITON_EXPORT SharedSymbolicExpression newSymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::string& comment="");
 
@@ -302,6 +341,25 @@ namespace triton {
           //! Returns true if the symbolic expression ID exists.
           TRITON_EXPORT bool isSymbolicExpressionExists(triton::usize symExprId) const;
 
+          /*!
+           * \brief Removes the dead entries of the expressions and variables tables, and applies the history limit.
+           *
+           * \details
+           * The history limit is applied each time `limit` expressions have been created, thus between `limit` and
+           * twice `limit` expressions are kept symbolic. If `force` is true, the tables are swept and the limit is
+           * applied now.
+           */
+          TRITON_EXPORT void collectGarbage(bool force=false);
+
+          //! Sets the number of the most recent expressions kept symbolic, the older ones are concretized. 0 for an unbounded history.
+          TRITON_EXPORT void setHistoryLimit(triton::usize limit);
+
+          //! Returns the number of the most recent expressions kept symbolic, 0 for an unbounded history.
+          TRITON_EXPORT triton::usize getHistoryLimit(void) const;
+
+          //! Returns the size of the symbolic state.
+          TRITON_EXPORT SymbolicStatistics getStatistics(void) const;
+
           //! Returns true if memory cell expressions contain symbolic variables.
           TRITON_EXPORT bool isMemorySymbolized(const triton::arch::MemoryAccess& mem) const;
 
@@ -0,0 +1,70 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYMBOLICSTATISTICS_HPP
+#define TRITON_SYMBOLICSTATISTICS_HPP
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SymbolicStatistics
+       *  \brief The size of the symbolic state (see triton::engines::symbolic::SymbolicEngine::getStatistics()). */
+      class SymbolicStatistics {
+        public:
+          //! The number of live expressions, including the ones only held by instructions.
+          triton::usize liveExpressions = 0;
+
+          //! The number of expressions reachable from the registers, the memory and the path constraints.
+          triton::usize reachableExpressions = 0;
+
+          //! The number of AST nodes reachable from the registers, the memory and the path constraints.
+          triton::usize reachableNodes = 0;
+
+          //! An estimate of the memory used by the reachable expressions and nodes, in bytes.
+          triton::usize reachableBytes = 0;
+
+          //! The number of symbolic registers.
+          triton::usize symbolicRegisters = 0;
+
+          //! The number of symbolic memory cells.
+          triton::usize symbolicMemory = 0;
+
+          //! The number of path constraints.
+          triton::usize pathConstraints = 0;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICSTATISTICS_HPP */
@@ -0,0 +1,131 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TAINTBITMAP_HPP
+#define TRITON_TAINTBITMAP_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! The size of a page of the taint bitmap.
+      const triton::usize TAINT_PAGE_SIZE = 0x1000;
+
+      /*! \class TaintBitmap
+       *  \brief The shadow taint of the memory.
+       *
+       * \details The taint of the memory is kept as one bit per byte in 4 KiB pages found
+       * through a sparse page directory. Ranges are tainted, untainted, copied and merged
+       * 64 bytes at a time, and a range without any tainted byte is recognized by testing
+       * its words. Pages without tainted bytes are released.
+       *
+       * Pages are shared between copies and duplicated on their first write (copy-on-write),
+       * as for triton::arch::ConcreteMemory.
+       */
+      class TaintBitmap {
+        protected:
+          //! A page of the bitmap.
+          struct Page {
+            //! The taint of the page, one bit per byte.
+            triton::uint64 bits[TAINT_PAGE_SIZE / 64];
+
+            //! The number of tainted bytes.
+            triton::usize count;
+
+            //! Constructor.
+            Page();
+          };
+
+          //! The page directory, page number -> page.
+          std::unordered_map<triton::uint64, std::shared_ptr<Page>> pages;
+
+          //! The number of tainted bytes.
+          triton::usize count;
+
+          //! Returns a page for reading, nullptr if it has no tainted byte.
+          const Page* getPage(triton::uint64 index) const;
+
+          //! Returns the taint of `size` bytes (at most 64), one bit per byte.
+          triton::uint64 read(triton::uint64 addr, triton::uint32 size) const;
+
+          //! Sets the taint of `size` bytes (at most 64), one bit per byte.
+          void write(triton::uint64 addr, triton::uint32 size, triton::uint64 bits);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT TaintBitmap();
+
+          //! Constructor by copy, pages are shared until written.
+          TRITON_EXPORT TaintBitmap(const TaintBitmap& other);
+
+          //! Copies a TaintBitmap, pages are shared until written.
+          TRITON_EXPORT TaintBitmap& operator=(const TaintBitmap& other);
+
+          //! Untaints the whole memory.
+          TRITON_EXPORT void clear(void);
+
+          //! Returns true if a byte is tainted.
+          TRITON_EXPORT bool isTainted(triton::uint64 addr) const;
+
+          //! Returns true if one byte of a memory area is tainted.
+          TRITON_EXPORT bool isTainted(triton::uint64 baseAddr, triton::usize size) const;
+
+          //! Taints a memory area.
+          TRITON_EXPORT void taint(triton::uint64 baseAddr, triton::usize size);
+
+          //! Untaints a memory area.
+          TRITON_EXPORT void untaint(triton::uint64 baseAddr, triton::usize size);
+
+          //! Copies the taint of the area `src` to the area `dst`.
+          TRITON_EXPORT void assign(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Adds the taint of the area `src` to the area `dst`.
+          TRITON_EXPORT void merge(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Returns the number of tainted bytes.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the tainted addresses.
+          TRITON_EXPORT std::unordered_set<triton::uint64> getTaintedAddresses(void) const;
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTBITMAP_HPP */
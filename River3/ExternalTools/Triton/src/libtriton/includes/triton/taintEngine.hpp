@@ -8,13 +8,16 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <bitset>
 #include <unordered_set>
 
+#include <triton/archEnums.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/modes.hpp>
 #include <triton/register.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/taintBitmap.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -65,11 +68,11 @@ namespace triton {
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::unordered_set<triton::uint64> taintedMemory;
+          //! The taint of the memory, one bit per byte.
+          triton::engines::taint::TaintBitmap taintedMemory;
 
-          //! The set of tainted registers. Currently it is an over approximation of the taint.
-          std::unordered_set<triton::arch::register_e> taintedRegisters;
+          //! The tainted registers, one bit per parent register id. Currently it is an over approximation of the taint.
+          std::bitset<triton::arch::ID_REG_LAST_ITEM> taintedRegisters;
 
         public:
           //! Constructor.
@@ -85,7 +88,7 @@ namespace triton {
           TRITON_EXPORT void enable(bool flag);
 
           //! Returns the tainted addresses.
-          TRITON_EXPORT const std::unordered_set<triton::uint64>& getTaintedMemory(void) const;
+          TRITON_EXPORT std::unordered_set<triton::uint64> getTaintedMemory(void) const;
 
           //! Returns the tainted registers.
           TRITON_EXPORT std::unordered_set<const triton::arch::Register*> getTaintedRegisters(void) const;
@@ -93,7 +96,7 @@ namespace triton {
           //! Returns true if the taint engine is enabled.
           TRITON_EXPORT bool isEnabled(void) const;
 
-          //! Returns true if the addr is tainted.
+          //! Returns true if one byte of the memory area is tainted.
           TRITON_EXPORT bool isMemoryTainted(triton::uint64 addr, triton::uint32 size=1) const;
 
           //! Returns true if the memory is tainted.
@@ -8,6 +8,7 @@
 #ifndef TRITON_TRITONTOZ3AST_H
 #define TRITON_TRITONTOZ3AST_H
 
+#include <string>
 #include <unordered_map>
 #include <z3++.h>
 
@@ -39,6 +40,12 @@ namespace triton {
         //! This flag define if the conversion is used to evaluated a node or not.
         bool isEval;
 
+        //! This flag define if the converted nodes are kept between two conversions.
+        bool isPersistent;
+
+        //! The converted nodes, kept if the conversion is persistent.
+        std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> cache;
+
         //! Returns the integer of the z3 expression (expr must be an int).
         triton::__uint getUintValue(const z3::expr& expr);
 
@@ -59,14 +66,17 @@ namespace triton {
         //! The set of symbolic variables contained in the expression.
         std::unordered_map<std::string, triton::engines::symbolic::SharedSymbolicVariable> variables;
 
-        //! Constructor.
-        TRITON_EXPORT TritonToZ3Ast(bool eval=true);
+        //! Constructor. If `persistent` is true, a node already converted is not converted again (the AST must not be modified meanwhile).
+        TRITON_EXPORT TritonToZ3Ast(bool eval=true, bool persistent=false);
 
         //! Destructor.
         TRITON_EXPORT ~TritonToZ3Ast();
 
         //! Converts to Z3's AST
         TRITON_EXPORT z3::expr convert(const triton::ast::SharedAbstractNode& node);
+
+        //! Returns the z3's context of the converted expressions.
+        TRITON_EXPORT z3::context& getContext(void);
     };
 
   /*! @} End of ast namespace */
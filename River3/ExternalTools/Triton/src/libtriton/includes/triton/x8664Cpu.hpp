@@ -15,6 +15,7 @@
 
 #include <triton/archEnums.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/cpuInterface.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/externalLibs.hpp>
@@ -70,13 +71,8 @@ namespace triton {
           void disassInit(void);
 
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \details
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::unordered_map<triton::uint64, triton::uint8> memory;
+          //! Concrete memory, paged and copy-on-write
+          triton::arch::ConcreteMemory memory;
 
           //! Concrete value of rax
           triton::uint8 rax[triton::size::qword];
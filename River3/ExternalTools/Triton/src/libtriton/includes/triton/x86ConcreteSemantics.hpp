@@ -0,0 +1,174 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_X86CONCRETESEMANTICS_H
+#define TRITON_X86CONCRETESEMANTICS_H
+
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/semanticsInterface.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      /*! \class x86ConcreteSemantics
+          \brief The concrete x86 semantics used by the triton::modes::CONCRETE_ONLY mode.
+
+          \details The common integer instructions (moves, arithmetic, logic, shifts, stack
+          and branches on general purpose registers) are executed directly on the register file
+          and the memory, without AST, symbolic expression nor path constraint. The resulting
+          state is the same as the one of triton::arch::x86::x86Semantics. Written registers
+          and memory are concretized and untainted. buildSemantics() returns false for every
+          other instruction, which then goes through the symbolic semantics. */
+      class x86ConcreteSemantics : public SemanticsInterface {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                             triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                             triton::engines::taint::TaintEngine* taintEngine);
+
+          //! Executes the instruction. Returns false, without side effect, if the instruction is not handled.
+          TRITON_EXPORT bool buildSemantics(triton::arch::Instruction& inst);
+
+        private:
+          //! Returns true if the instruction and its operands are handled.
+          bool isSupported(const triton::arch::Instruction& inst) const;
+
+          //! Returns true if the operand can be read and written as a 64-bit value.
+          bool isSupported(const triton::arch::OperandWrapper& op) const;
+
+          //! Returns true if the register is a general purpose register.
+          bool isGPR(const triton::arch::Register& reg) const;
+
+          //! Computes the address of a memory operand, as triton::engines::symbolic::SymbolicEngine::initLeaAst().
+          void initAddress(triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the concrete value of an operand.
+          triton::uint64 read(const triton::arch::OperandWrapper& op) const;
+
+          //! Returns the concrete value of a register.
+          triton::uint64 read(const triton::arch::Register& reg) const;
+
+          //! Writes an operand.
+          void write(const triton::arch::OperandWrapper& op, triton::uint64 value);
+
+          //! Writes a register. A 32-bit register clears the upper bits of its parent.
+          void write(const triton::arch::Register& reg, triton::uint64 value);
+
+          //! Writes a memory area.
+          void write(const triton::arch::MemoryAccess& mem, triton::uint64 value);
+
+          //! Returns a flag.
+          bool getFlag(triton::arch::register_e flag) const;
+
+          //! Sets a flag.
+          void setFlag(triton::arch::register_e flag, bool value);
+
+          //! Sets PF, SF and ZF from a result.
+          void setResultFlags(triton::uint64 res, triton::uint32 bits);
+
+          //! Returns the condition of a Jcc, CMOVcc or SETcc.
+          bool condition(const triton::arch::Instruction& inst) const;
+
+          //! Sets the program counter.
+          void setPc(triton::uint64 value);
+
+          //! Aligns the stack. Returns the new stack value.
+          triton::uint64 alignStack(triton::sint64 delta);
+
+          //! ADD, SUB, CMP, AND, OR, XOR and TEST.
+          void binary_c(triton::arch::Instruction& inst);
+
+          //! CALL.
+          void call_c(triton::arch::Instruction& inst);
+
+          //! CMOVcc.
+          void cmov_c(triton::arch::Instruction& inst);
+
+          //! INC and DEC.
+          void incDec_c(triton::arch::Instruction& inst);
+
+          //! Jcc.
+          void jcc_c(triton::arch::Instruction& inst);
+
+          //! JMP.
+          void jmp_c(triton::arch::Instruction& inst);
+
+          //! LEA.
+          void lea_c(triton::arch::Instruction& inst);
+
+          //! LEAVE.
+          void leave_c(triton::arch::Instruction& inst);
+
+          //! MOV, MOVABS, MOVZX, MOVSX and MOVSXD.
+          void mov_c(triton::arch::Instruction& inst);
+
+          //! NEG.
+          void neg_c(triton::arch::Instruction& inst);
+
+          //! NOT.
+          void not_c(triton::arch::Instruction& inst);
+
+          //! POP.
+          void pop_c(triton::arch::Instruction& inst);
+
+          //! PUSH.
+          void push_c(triton::arch::Instruction& inst);
+
+          //! RET.
+          void ret_c(triton::arch::Instruction& inst);
+
+          //! SETcc.
+          void set_c(triton::arch::Instruction& inst);
+
+          //! SHL, SAL, SHR and SAR.
+          void shift_c(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X86CONCRETESEMANTICS_H */
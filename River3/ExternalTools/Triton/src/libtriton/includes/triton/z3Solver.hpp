@@ -8,8 +8,10 @@
 #ifndef TRITON_Z3SOLVER_H
 #define TRITON_Z3SOLVER_H
 
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <z3++.h>
 #include <z3_api.h>
@@ -19,6 +21,7 @@
 #include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/tritonToZ3Ast.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -44,6 +47,26 @@ namespace triton {
      *  @{
      */
 
+      //! \class Z3Session
+      /*! \brief The state of an incremental solving session (see Z3Solver::beginSession()). */
+      class Z3Session {
+        public:
+          //! The converter, it keeps the z3's context and the converted nodes of the session.
+          triton::ast::TritonToZ3Ast converter;
+
+          //! The solver, it keeps the constraints and what z3 learned between two checks.
+          z3::solver solver;
+
+          //! The literals standing for the assumptions already seen, and the scope they were defined in.
+          std::unordered_map<triton::ast::SharedAbstractNode, std::pair<z3::expr, triton::usize>> literals;
+
+          //! The number of push() not popped yet.
+          triton::usize depth;
+
+          //! Constructor.
+          Z3Session();
+      };
+
       //! \class Z3Solver
       /*! \brief Solver engine using z3. */
       class Z3Solver : public SolverInterface {
@@ -51,9 +74,15 @@ namespace triton {
           //! The SMT solver timeout. By default, unlimited.
           triton::uint32 timeout;
 
+          //! The incremental solving session, null if there is none.
+          std::unique_ptr<Z3Session> session;
+
           //! Writes back the status code of the solver into the pointer pointed by status.
           void writeBackStatus(z3::solver& solver, z3::check_result res, triton::engines::solver::status_e* status) const;
 
+          //! Returns the session or throws an exception if there is none.
+          Z3Session& getSession(const char* where);
+
         public:
           //! Constructor.
           TRITON_EXPORT Z3Solver();
@@ -90,6 +119,37 @@ namespace triton {
 
           //! Defines a solver timeout (in milliseconds).
           TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Starts an incremental solving session. A previous session is dropped.
+          /*!
+           * \details The session keeps one z3 solver. The Triton nodes are converted once for the whole
+           * session (they must not be modified meanwhile), and what z3 learned is kept between two checks.
+           */
+          TRITON_EXPORT void beginSession(void);
+
+          //! Ends the incremental solving session.
+          TRITON_EXPORT void endSession(void);
+
+          //! Returns true if an incremental solving session is started.
+          TRITON_EXPORT bool isSessionActive(void) const;
+
+          //! Saves the constraints of the session.
+          TRITON_EXPORT void push(void);
+
+          //! Drops the constraints asserted since the last push().
+          TRITON_EXPORT void pop(void);
+
+          //! Adds a constraint to the session.
+          TRITON_EXPORT void assertConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Checks the constraints of the session and the assumptions, which only hold for this check. Returns a model if it is satisfiable.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status = nullptr);
       };
 
     /*! @} End of solver namespace */
@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Test AST hash-consing."""
+
+import unittest
+
+from triton import TritonContext, ARCH, MODE, Instruction
+
+
+class TestAstHashConsing(unittest.TestCase):
+
+    """Testing the AST hash-consing."""
+
+    def setUp(self):
+        """Define the arch and the mode."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.setMode(MODE.AST_HASH_CONSING, True)
+        self.ast = self.ctx.getAstContext()
+
+        self.v1 = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.v2 = self.ast.variable(self.ctx.newSymbolicVariable(32))
+
+    def test_shared(self):
+        """Test that identical operations return the same node"""
+        n1 = self.ast.bvadd(self.v1, self.ast.bv(1, 32))
+        n2 = self.ast.bvadd(self.v1, self.ast.bv(1, 32))
+
+        # One parent for both additions, one child for both constants
+        self.assertEqual(len(self.v1.getParents()), 1)
+        self.assertEqual(len(n1.getChildren()[1].getParents()), 1)
+
+        # Nodes built on the shared one are shared too
+        e1 = self.ast.extract(7, 0, n1)
+        e2 = self.ast.extract(7, 0, n2)
+        self.assertEqual(len(n1.getParents()), 1)
+        self.assertTrue(e1.equalTo(e2))
+
+    def test_not_shared(self):
+        """Test that different operations return different nodes"""
+        self.ast.bvadd(self.v1, self.v2)
+        self.ast.bvadd(self.v2, self.v1)
+        self.ast.bvsub(self.v1, self.v2)
+        self.assertEqual(len(self.v1.getParents()), 3)
+
+        self.ast.extract(7, 0, self.v1)
+        self.ast.extract(15, 8, self.v1)
+        self.assertEqual(len(self.v1.getParents()), 5)
+
+    def test_evaluation(self):
+        """Test that a shared node follows the variables"""
+        n1 = self.ast.bvadd(self.v1, self.v2)
+        self.ctx.setConcreteVariableValue(self.v1.getSymbolicVariable(), 4)
+        n2 = self.ast.bvadd(self.v1, self.v2)
+        self.ctx.setConcreteVariableValue(self.v2.getSymbolicVariable(), 2)
+        self.assertEqual(n1.evaluate(), 6)
+        self.assertEqual(n2.evaluate(), 6)
+
+    def test_set_child(self):
+        """Test that a node whose child is replaced is not returned for the old operation"""
+        n1 = self.ast.bvadd(self.v1, self.v2)
+        n1.setChild(0, self.ast.bv(1, 32))
+        n2 = self.ast.bvadd(self.v1, self.v2)
+        self.assertEqual(len(self.v1.getParents()), 1)
+        self.assertEqual(str(n2), "(bvadd SymVar_0 SymVar_1)")
+
+    def test_disabled(self):
+        """Test that no node is shared when the mode is disabled"""
+        self.ctx.setMode(MODE.AST_HASH_CONSING, False)
+        self.ast.bvadd(self.v1, self.v2)
+        self.ast.bvadd(self.v1, self.v2)
+        self.assertEqual(len(self.v1.getParents()), 2)
+
+    def test_same_semantics(self):
+        """Test that the semantics give the same values with and without the mode"""
+        trace = [
+            b"\x48\x01\xd8",              # add rax, rbx
+            b"\x48\x01\xd8",              # add rax, rbx
+            b"\x48\x31\xd9",              # xor rcx, rbx
+            b"\x48\x0f\xaf\xc1",          # imul rax, rcx
+            b"\x48\xc1\xe0\x03",          # shl rax, 3
+            b"\x48\x39\xc8",              # cmp rax, rcx
+        ]
+
+        other = TritonContext()
+        other.setArchitecture(ARCH.X86_64)
+
+        for ctx in [self.ctx, other]:
+            ctx.symbolizeRegister(ctx.registers.rbx)
+            ctx.setConcreteRegisterValue(ctx.registers.rax, 0x1234)
+            ctx.setConcreteRegisterValue(ctx.registers.rbx, 0x5678)
+            for opcodes in trace:
+                ctx.processing(Instruction(opcodes))
+
+        for name in ['rax', 'rcx', 'zf', 'cf', 'of', 'sf']:
+            ast1 = self.ctx.getSymbolicRegister(self.ctx.getRegister(name)).getAst()
+            ast2 = other.getSymbolicRegister(other.getRegister(name)).getAst()
+            self.assertEqual(ast1.evaluate(), ast2.evaluate())
+            self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.getRegister(name)),
+                             other.getConcreteRegisterValue(other.getRegister(name)))
@@ -0,0 +1,95 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Test the batched branch flips."""
+
+import unittest
+from triton import *
+
+
+class TestBranchFlips(unittest.TestCase):
+
+    """Testing solveBranchFlips."""
+
+    def setUp(self):
+        """Define the arch and run a path with three conditional branches."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0)
+
+        code = [
+            b"\x48\x83\xf8\x01",  # cmp rax, 1
+            b"\x74\x10",          # je +0x10
+            b"\x48\x83\xf8\x02",  # cmp rax, 2
+            b"\x74\x10",          # je +0x10
+            b"\x48\x83\xf8\x01",  # cmp rax, 1
+            b"\x74\x10",          # je +0x10
+        ]
+        for opcodes in code:
+            self.ctx.processing(Instruction(opcodes))
+
+        self.pcs = self.ctx.getPathConstraints()
+
+    def test_flips(self):
+        """Test that every branch not taken is queried with the path before it"""
+        flips = self.ctx.solveBranchFlips(self.pcs)
+        self.assertEqual([f['pcIndex'] for f in flips], [0, 1, 2])
+
+        for flip in flips:
+            branch = self.pcs[flip['pcIndex']].getBranchConstraints()[flip['branchIndex']]
+            self.assertFalse(branch['isTaken'])
+            self.assertEqual(flip['srcAddr'], branch['srcAddr'])
+            self.assertEqual(flip['dstAddr'], branch['dstAddr'])
+
+        self.assertEqual(flips[0]['status'], SOLVER_STATE.SAT)
+        self.assertEqual(list(flips[0]['model'].values())[0].getValue(), 1)
+        self.assertEqual(flips[1]['status'], SOLVER_STATE.SAT)
+        self.assertEqual(list(flips[1]['model'].values())[0].getValue(), 2)
+
+        # rax != 1 was taken before
+        self.assertEqual(flips[2]['status'], SOLVER_STATE.UNSAT)
+        self.assertEqual(len(flips[2]['model']), 0)
+
+    def test_same_as_get_model(self):
+        """Test that the queries are the ones built with getModel"""
+        ast = self.ctx.getAstContext()
+        prefix = ast.equal(ast.bvtrue(), ast.bvtrue())
+        flips = self.ctx.solveBranchFlips(self.pcs)
+        for flip in flips:
+            pc = self.pcs[flip['pcIndex']]
+            branch = pc.getBranchConstraints()[flip['branchIndex']]
+            model = self.ctx.getModel(ast.land([prefix, branch['constraint']]))
+            self.assertEqual(len(model), len(flip['model']))
+            self.assertEqual(flip['status'] == SOLVER_STATE.SAT, len(model) > 0)
+            prefix = ast.land([prefix, pc.getTakenPredicate()])
+
+    def test_bounds(self):
+        """Test the start index and the limit"""
+        flips = self.ctx.solveBranchFlips(self.pcs, 1)
+        self.assertEqual([f['pcIndex'] for f in flips], [1, 2])
+
+        flips = self.ctx.solveBranchFlips(self.pcs, 0, 2)
+        self.assertEqual([f['pcIndex'] for f in flips], [0, 1])
+
+        flips = self.ctx.solveBranchFlips(self.pcs, 0, 0, 1000)
+        self.assertEqual(len(flips), 3)
+
+        self.assertEqual(self.ctx.solveBranchFlips(self.pcs, 3), [])
+
+    def test_session_kept(self):
+        """Test that a started solving session is kept as is"""
+        self.assertFalse(self.ctx.isSolverSessionActive())
+        self.ctx.solveBranchFlips(self.pcs)
+        self.assertFalse(self.ctx.isSolverSessionActive())
+
+        x = self.ctx.getAstContext().variable(self.ctx.getSymbolicVariable(0))
+        self.ctx.beginSolverSession()
+        self.ctx.assertSolverConstraint(x == 2)
+
+        flips = self.ctx.solveBranchFlips(self.pcs)
+        self.assertEqual([f['status'] for f in flips], [SOLVER_STATE.UNSAT, SOLVER_STATE.SAT, SOLVER_STATE.UNSAT])
+
+        # The path was asserted in a scope which is dropped
+        self.assertTrue(self.ctx.isSolverSessionActive())
+        _, status = self.ctx.checkWithAssumptions([])
+        self.assertEqual(status, SOLVER_STATE.SAT)
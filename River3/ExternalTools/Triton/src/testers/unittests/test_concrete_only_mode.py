@@ -0,0 +1,145 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Test CONCRETE_ONLY."""
+
+import os
+import unittest
+
+from triton import ARCH, CALLBACK, MODE, TritonContext, Instruction, MemoryAccess
+
+
+
+class TestConcreteOnlyMode(unittest.TestCase):
+
+    """Testing the CONCRETE_ONLY mode."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.setMode(MODE.CONCRETE_ONLY, True)
+
+    def test_mov(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0x1122334455667788)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.ctx.taintRegister(self.ctx.registers.rax)
+
+        inst = Instruction(b"\x48\x89\xc3") # mov rbx, rax
+        self.assertTrue(self.ctx.processing(inst))
+
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rbx), 0x1122334455667788)
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rbx))
+        self.assertFalse(self.ctx.isRegisterTainted(self.ctx.registers.rbx))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rip), inst.getNextAddress())
+
+    def test_dword_write(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0xffffffffffffffff)
+
+        inst = Instruction(b"\x83\xc0\x01") # add eax, 1
+        self.assertTrue(self.ctx.processing(inst))
+
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.cf), 1)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.zf), 1)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.of), 0)
+
+    def test_stack(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rsp, 0x1000)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0xdeadbeef)
+
+        inst = Instruction(b"\x50") # push rax
+        self.assertTrue(self.ctx.processing(inst))
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rsp), 0xff8)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0xff8, 8)), 0xdeadbeef)
+
+        inst = Instruction(b"\x5b") # pop rbx
+        self.assertTrue(self.ctx.processing(inst))
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rsp), 0x1000)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rbx), 0xdeadbeef)
+
+    def test_branch(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.zf, 1)
+
+        inst = Instruction(0x1000, b"\x74\x10") # je 0x1012
+        self.assertTrue(self.ctx.processing(inst))
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(inst.isConditionTaken())
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rip), 0x1012)
+
+        # Path constraints are not recorded
+        self.assertEqual(len(self.ctx.getPathConstraints()), 0)
+
+    def test_fallback(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 6)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 7)
+
+        inst = Instruction(b"\x48\x0f\xaf\xc3") # imul rax, rbx
+        self.assertTrue(self.ctx.processing(inst))
+
+        # Not handled concretely, the symbolic semantics is used
+        self.assertNotEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 42)
+
+
+class TestConcreteOnlyModeIR(unittest.TestCase):
+
+    """Testing the CONCRETE_ONLY mode against the symbolic semantics."""
+
+    def load_binary(self, ctx, filename):
+        """Load in memory every opcode from an elf program."""
+        import lief
+        binary = lief.parse(filename)
+        for phdr in binary.segments:
+            ctx.setConcreteMemoryAreaValue(phdr.virtual_address, phdr.content)
+
+    def new_context(self, concrete):
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.setMode(MODE.CONCRETE_ONLY, concrete)
+
+        # Load the binary
+        binary_file = os.path.join(os.path.dirname(__file__), "misc", "ir-test-suite.bin")
+        self.load_binary(ctx, binary_file)
+
+        # Define a fake stack
+        ctx.setConcreteRegisterValue(ctx.registers.rbp, 0x7fffffff)
+        ctx.setConcreteRegisterValue(ctx.registers.rsp, 0x6fffffff)
+        return ctx
+
+    def record_stores(self, ctx, stores):
+        """Record every byte written in the concrete memory, the fast path doesn't report its store accesses."""
+        def cb(api, mem, value):
+            stores.update(range(mem.getAddress(), mem.getAddress() + mem.getSize()))
+        ctx.addCallback(CALLBACK.SET_CONCRETE_MEMORY_VALUE, cb)
+
+    def test_ir(self):
+        """Emulate the ir test suite in both modes and compare the states after each instruction."""
+        ref = self.new_context(False)
+        ctx = self.new_context(True)
+
+        # Bytes written by either context, compared after each instruction
+        stores = set()
+        self.record_stores(ref, stores)
+        self.record_stores(ctx, stores)
+
+        pc = 0x40065c
+        while pc:
+            stores.clear()
+            opcode = ref.getConcreteMemoryAreaValue(pc, 16)
+
+            inst1 = Instruction(pc, opcode)
+            inst2 = Instruction(pc, opcode)
+            self.assertTrue(ref.processing(inst1))
+            self.assertTrue(ctx.processing(inst2))
+
+            for reg in ref.getParentRegisters():
+                self.assertEqual(ref.getConcreteRegisterValue(reg), ctx.getConcreteRegisterValue(ctx.getRegister(reg.getId())), "%s: %s" %(inst1, reg.getName()))
+
+            for addr in stores:
+                self.assertEqual(ref.getConcreteMemoryValue(addr), ctx.getConcreteMemoryValue(addr), "%s: %#x" %(inst1, addr))
+
+            self.assertEqual(inst1.isConditionTaken(), inst2.isConditionTaken())
+            pc = ref.getConcreteRegisterValue(ref.registers.rip)
@@ -4,7 +4,7 @@
 
 import unittest
 
-from triton import ARCH, TritonContext
+from triton import ARCH, CPUSIZE, MemoryAccess, TritonContext
 
 
 class TestX86ConcreteRegisterValue(unittest.TestCase):
@@ -148,6 +148,29 @@ class TestX86ConcreteMemoryValue(unittest.TestCase):
         self.Triton.setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1000, 12), b"\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
 
+    def test_page_crossing(self):
+        """Check areas that span several pages"""
+        self.Triton.setConcreteMemoryAreaValue(0x1ffe, b"\x11\x22\x33\x44")
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x1ffe, 4))
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x1ffd, 4))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1ffc, 8), b"\x00\x00\x11\x22\x33\x44\x00\x00")
+        self.assertEqual(self.Triton.getConcreteMemoryValue(MemoryAccess(0x1ffe, CPUSIZE.DWORD)), 0x44332211)
+
+        self.Triton.setConcreteMemoryValue(MemoryAccess(0x2ffc, CPUSIZE.QWORD), 0x8877665544332211)
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x2ffc, 8), b"\x11\x22\x33\x44\x55\x66\x77\x88")
+
+        self.Triton.clearConcreteMemoryValue(0x1fff, 2)
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x1ffe, 1))
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x1fff, 1))
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x2000, 1))
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x2001, 1))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1ffe, 4), b"\x11\x00\x00\x44")
+
+        area = bytes(range(256)) * 48
+        self.Triton.setConcreteMemoryAreaValue(0x10080, area)
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x10080, len(area)))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x10080, len(area)), area)
+
 class TestX8664ConcreteMemoryValue(unittest.TestCase):
 
     """Testing the X86 concrete value api."""
@@ -176,3 +199,26 @@ class TestX8664ConcreteMemoryValue(unittest.TestCase):
         self.Triton.setConcreteMemoryAreaValue(0x1000, b"\x11\x22\x33\x44\x55\x66")
         self.Triton.setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1000, 12), b"\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
+
+    def test_page_crossing(self):
+        """Check areas that span several pages"""
+        self.Triton.setConcreteMemoryAreaValue(0x1ffe, b"\x11\x22\x33\x44")
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x1ffe, 4))
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x1ffd, 4))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1ffc, 8), b"\x00\x00\x11\x22\x33\x44\x00\x00")
+        self.assertEqual(self.Triton.getConcreteMemoryValue(MemoryAccess(0x1ffe, CPUSIZE.DWORD)), 0x44332211)
+
+        self.Triton.setConcreteMemoryValue(MemoryAccess(0x2ffc, CPUSIZE.QWORD), 0x8877665544332211)
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x2ffc, 8), b"\x11\x22\x33\x44\x55\x66\x77\x88")
+
+        self.Triton.clearConcreteMemoryValue(0x1fff, 2)
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x1ffe, 1))
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x1fff, 1))
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x2000, 1))
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x2001, 1))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1ffe, 4), b"\x11\x00\x00\x44")
+
+        area = bytes(range(256)) * 48
+        self.Triton.setConcreteMemoryAreaValue(0x10080, area)
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x10080, len(area)))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x10080, len(area)), area)
@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Test the native emulation loop."""
+
+import unittest
+from triton import *
+
+
+CODE = [
+    b"\x48\xc7\xc1\x05\x00\x00\x00",  # 0x1000: mov rcx, 5
+    b"\x48\xff\xc9",                  # 0x1007: dec rcx
+    b"\x75\xfb",                      # 0x100a: jnz 0x1007
+    b"\x90",                          # 0x100c: nop
+    b"\xf4",                          # 0x100d: hlt
+]
+
+
+class TestRun(unittest.TestCase):
+
+    """Testing TritonContext.run."""
+
+    def setUp(self):
+        """Define the arch and load the code."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.setConcreteMemoryAreaValue(0x1000, b"".join(CODE))
+
+    def test_end_address(self):
+        """Test that run stops on the end address"""
+        result = self.ctx.run(0x1000, 0x100d, 0x1000, 0x1fff)
+        self.assertEqual(result['reason'], STOP.END_ADDRESS)
+        self.assertEqual(result['pc'], 0x100d)
+        self.assertEqual(result['count'], 12)
+        self.assertEqual(result['blocks'], [0x1000, 0x1007, 0x1007, 0x1007, 0x1007, 0x100c])
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rcx), 0)
+
+    def test_region_exit(self):
+        """Test that run stops when the program counter leaves the region"""
+        result = self.ctx.run(0x1000, 0, 0x1000, 0x100b)
+        self.assertEqual(result['reason'], STOP.REGION_EXIT)
+        self.assertEqual(result['pc'], 0x100c)
+        self.assertEqual(result['count'], 11)
+
+    def test_budget(self):
+        """Test that run stops when the budget is spent"""
+        result = self.ctx.run(0x1000, 0, 0, -1, 3)
+        self.assertEqual(result['reason'], STOP.BUDGET)
+        self.assertEqual(result['pc'], 0x100a)
+        self.assertEqual(result['count'], 3)
+
+    def test_unsupported(self):
+        """Test that run stops on an instruction without semantics"""
+        result = self.ctx.run(0x1000, 0, 0x1000, 0x1fff)
+        self.assertEqual(result['reason'], STOP.UNSUPPORTED)
+        self.assertEqual(result['pc'], 0x100d)
+        self.assertEqual(result['count'], 12)
+
+    def test_same_as_processing(self):
+        """Test that run and processing give the same state"""
+        other = TritonContext()
+        other.setArchitecture(ARCH.X86_64)
+        other.setConcreteMemoryAreaValue(0x1000, b"".join(CODE))
+
+        pc = 0x1000
+        while pc != 0x100d:
+            other.processing(Instruction(pc, other.getConcreteMemoryAreaValue(pc, 16)))
+            pc = other.getConcreteRegisterValue(other.registers.rip)
+
+        self.ctx.run(0x1000, 0x100d)
+        for name in ['rcx', 'rip', 'zf', 'sf']:
+            self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.getRegister(name)),
+                             other.getConcreteRegisterValue(other.getRegister(name)))
+
+    def test_code_write(self):
+        """Test that a write to the code drops the cached instructions"""
+        self.assertEqual(self.ctx.run(0x1000, 0x100d)['count'], 12)
+
+        # mov rcx, 2
+        self.ctx.setConcreteMemoryValue(0x1003, 2)
+        self.assertEqual(self.ctx.run(0x1000, 0x100d)['count'], 6)
+
+    def test_code_restored(self):
+        """Test that the cached instructions are checked after a snapshot is restored"""
+        snap = self.ctx.takeSnapshot()
+        self.ctx.setConcreteMemoryValue(0x1003, 2)
+        self.assertEqual(self.ctx.run(0x1000, 0x100d)['count'], 6)
+
+        self.ctx.restoreSnapshot(snap)
+        self.assertEqual(self.ctx.run(0x1000, 0x100d)['count'], 12)
@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Test Snapshot."""
+
+import unittest
+from triton import *
+
+
+class TestSnapshot(unittest.TestCase):
+
+    """Testing snapshots of a context."""
+
+    def setUp(self):
+        """Define the arch and a first state."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0x1111)
+        self.ctx.setConcreteMemoryAreaValue(0x1000, b"\x11" * 0x2000)
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.ctx.taintRegister(self.ctx.registers.rbx)
+
+        self.snap = self.ctx.takeSnapshot()
+
+    def run_trace(self):
+        trace = [
+            b"\x48\xc7\xc0\x22\x22\x00\x00",      # mov rax, 0x2222
+            b"\x48\x89\x1c\x25\x00\x18\x00\x00",  # mov [0x1800], rbx
+            b"\x48\x83\xfb\x10",                  # cmp rbx, 0x10
+            b"\x74\x10",                          # je +0x10
+        ]
+        for opcodes in trace:
+            self.ctx.processing(Instruction(opcodes))
+
+    def test_restore(self):
+        """Test the states restored by restoreSnapshot"""
+        exprs = len(self.ctx.getSymbolicExpressions())
+        self.run_trace()
+        self.ctx.setConcreteMemoryValue(0x5000, 0x33)
+
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0x2222)
+        self.assertTrue(self.ctx.isMemorySymbolized(MemoryAccess(0x1800, CPUSIZE.QWORD)))
+        self.assertTrue(self.ctx.isMemoryTainted(MemoryAccess(0x1800, CPUSIZE.QWORD)))
+        self.assertEqual(len(self.ctx.getPathConstraints()), 1)
+
+        self.ctx.restoreSnapshot(self.snap)
+
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0x1111)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x1000, 0x2000), b"\x11" * 0x2000)
+        self.assertFalse(self.ctx.isConcreteMemoryValueDefined(0x5000))
+        self.assertFalse(self.ctx.isMemorySymbolized(MemoryAccess(0x1800, CPUSIZE.QWORD)))
+        self.assertFalse(self.ctx.isMemoryTainted(MemoryAccess(0x1800, CPUSIZE.QWORD)))
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rbx))
+        self.assertTrue(self.ctx.isRegisterTainted(self.ctx.registers.rbx))
+        self.assertEqual(len(self.ctx.getPathConstraints()), 0)
+        self.assertEqual(len(self.ctx.getSymbolicExpressions()), exprs)
+
+    def test_restore_twice(self):
+        """Test that a snapshot can be restored several times"""
+        for _ in range(2):
+            self.run_trace()
+            self.ctx.restoreSnapshot(self.snap)
+            self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0x1111)
+            self.assertEqual(self.ctx.getConcreteMemoryValue(0x1800), 0x11)
+
+        # New variables do not collide with the ones created before the restore
+        var1 = self.ctx.newSymbolicVariable(32)
+        self.run_trace()
+        self.ctx.restoreSnapshot(self.snap)
+        var2 = self.ctx.newSymbolicVariable(32)
+        self.assertNotEqual(var1.getId(), var2.getId())
+
+    def test_snapshot_is_isolated(self):
+        """Test that a snapshot does not see the writes made after it"""
+        self.ctx.setConcreteMemoryValue(0x1000, 0x22)
+        snap2 = self.ctx.takeSnapshot()
+        self.ctx.setConcreteMemoryValue(0x1000, 0x33)
+
+        self.ctx.restoreSnapshot(self.snap)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x11)
+        self.ctx.restoreSnapshot(snap2)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x22)
+
+    def test_remove(self):
+        """Test removeSnapshot"""
+        self.assertTrue(self.ctx.isSnapshotValid(self.snap))
+        self.ctx.removeSnapshot(self.snap)
+        self.assertFalse(self.ctx.isSnapshotValid(self.snap))
+
+        with self.assertRaises(TypeError):
+            self.ctx.restoreSnapshot(self.snap)
+
+    def test_reset(self):
+        """Test that reset removes the snapshots"""
+        self.ctx.reset()
+        self.assertFalse(self.ctx.isSnapshotValid(self.snap))
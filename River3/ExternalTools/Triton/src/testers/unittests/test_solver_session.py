@@ -0,0 +1,92 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Test the incremental solving session."""
+
+import unittest
+from triton import *
+
+
+class TestSolverSession(unittest.TestCase):
+
+    """Testing beginSolverSession and checkWithAssumptions."""
+
+    def setUp(self):
+        """Define the arch and a symbolic variable."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.x = self.ast.variable(self.ctx.newSymbolicVariable(8))
+
+        self.ctx.beginSolverSession()
+        self.ctx.assertSolverConstraint(self.x > 10)
+
+    def test_session(self):
+        """Test that a session can be started and ended"""
+        self.assertTrue(self.ctx.isSolverSessionActive())
+        self.ctx.endSolverSession()
+        self.assertFalse(self.ctx.isSolverSessionActive())
+
+        with self.assertRaises(TypeError):
+            self.ctx.checkWithAssumptions([])
+
+    def test_assumptions(self):
+        """Test that assumptions only hold for one check"""
+        model, status = self.ctx.checkWithAssumptions([self.x == 20])
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[0].getValue(), 20)
+
+        model, status = self.ctx.checkWithAssumptions([self.x == 5])
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertEqual(len(model), 0)
+
+        model, status = self.ctx.checkWithAssumptions([self.x == 5, self.x == 20])
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+
+        model, status = self.ctx.checkWithAssumptions([])
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertTrue(model[0].getValue() > 10)
+
+    def test_scopes(self):
+        """Test that popSolverScope drops the constraints of the scope"""
+        self.ctx.pushSolverScope()
+        self.ctx.assertSolverConstraint(self.x < 15)
+
+        _, status = self.ctx.checkWithAssumptions([self.x == 20])
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+
+        self.ctx.popSolverScope()
+        model, status = self.ctx.checkWithAssumptions([self.x == 20])
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[0].getValue(), 20)
+
+        with self.assertRaises(TypeError):
+            self.ctx.popSolverScope()
+
+    def test_branch_flips(self):
+        """Test that the branches of a path can be flipped in one session"""
+        self.ctx.endSolverSession()
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0)
+
+        code = [
+            b"\x48\x83\xf8\x01",  # cmp rax, 1
+            b"\x74\x10",          # je +0x10
+            b"\x48\x83\xf8\x02",  # cmp rax, 2
+            b"\x74\x10",          # je +0x10
+            b"\x48\x83\xf8\x03",  # cmp rax, 3
+            b"\x74\x10",          # je +0x10
+        ]
+        for opcodes in code:
+            self.ctx.processing(Instruction(opcodes))
+
+        self.ctx.beginSolverSession()
+        values = []
+        for pc in self.ctx.getPathConstraints():
+            for branch in pc.getBranchConstraints():
+                if not branch['isTaken']:
+                    model, status = self.ctx.checkWithAssumptions([branch['constraint']])
+                    self.assertEqual(status, SOLVER_STATE.SAT)
+                    values.append(list(model.values())[0].getValue())
+            self.ctx.assertSolverConstraint(pc.getTakenPredicate())
+
+        self.assertEqual(values, [1, 2, 3])
@@ -0,0 +1,74 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Test the symbolic garbage collection."""
+
+import unittest
+
+from triton import ARCH, AST_NODE, TritonContext, Instruction, MemoryAccess
+
+
+
+class TestSymbolicGarbageCollection(unittest.TestCase):
+
+    """Testing the history limit and the symbolic statistics."""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+
+    def emulate(self, count):
+        # add rax, rbx ; mov [0x2000], rax
+        for _ in range(count):
+            self.assertTrue(self.ctx.processing(Instruction(b"\x48\x01\xd8")))
+            self.assertTrue(self.ctx.processing(Instruction(b"\x48\x89\x04\x25\x00\x20\x00\x00")))
+
+    def test_history_limit(self):
+        self.assertEqual(self.ctx.getHistoryLimit(), 0)
+        self.ctx.setHistoryLimit(100)
+        self.assertEqual(self.ctx.getHistoryLimit(), 100)
+        self.ctx.setHistoryLimit(0)
+        self.assertEqual(self.ctx.getHistoryLimit(), 0)
+
+    def test_statistics(self):
+        stats = self.ctx.getSymbolicStatistics()
+        for key in ["liveExpressions", "reachableExpressions", "reachableNodes", "reachableBytes", "symbolicRegisters", "symbolicMemory", "pathConstraints"]:
+            self.assertEqual(stats[key], 0)
+
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.emulate(1)
+        stats = self.ctx.getSymbolicStatistics()
+        self.assertGreater(stats["reachableExpressions"], 0)
+        self.assertGreater(stats["reachableNodes"], 0)
+        self.assertGreater(stats["reachableBytes"], 0)
+        self.assertGreater(stats["symbolicRegisters"], 0)
+        self.assertEqual(stats["symbolicMemory"], 8)
+
+    def test_bounded(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 3)
+        var = self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.ctx.setHistoryLimit(200)
+
+        self.emulate(1000)
+        self.assertLess(self.ctx.getSymbolicStatistics()["liveExpressions"], 1000)
+
+        # The concrete state is kept
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 3000)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0x2000, 8)), 3000)
+
+        # The symbolic variable is still referenced by the latest expressions
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        ast = self.ctx.getSymbolicRegister(self.ctx.registers.rax).getAst()
+        self.assertEqual(ast.evaluate(), 3000)
+        names = [n.getSymbolicVariable().getName() for n in self.ctx.getAstContext().search(ast, AST_NODE.VARIABLE)]
+        self.assertIn(var.getName(), names)
+
+    def test_collect_garbage(self):
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.emulate(100)
+        self.ctx.collectGarbage()
+        stats = self.ctx.getSymbolicStatistics()
+        self.assertEqual(stats["liveExpressions"], stats["reachableExpressions"])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -38,3 +38,39 @@ class TestSymbolicOptimizations(unittest.TestCase):
         self.assertEqual(rcx.getType(), AST_NODE.REFERENCE)
         self.assertEqual(rcx.evaluate(), 1)
         return
+
+
+    def test_concrete_memory(self):
+        self.ctx.setConcreteMemoryValue(MemoryAccess(0x1ffc, CPUSIZE.QWORD), 0x1122334455667788)
+
+        # No symbolic memory cell in the pages of the access
+        node = self.ctx.getMemoryAst(MemoryAccess(0x1ffc, CPUSIZE.QWORD))
+        self.assertEqual(node.getType(), AST_NODE.BV)
+        self.assertEqual(node.evaluate(), 0x1122334455667788)
+
+        # The access crosses a page with a symbolic memory cell
+        self.ctx.symbolizeMemory(MemoryAccess(0x2000, CPUSIZE.BYTE))
+        node = self.ctx.getMemoryAst(MemoryAccess(0x1ffc, CPUSIZE.QWORD))
+        self.assertEqual(node.getType(), AST_NODE.CONCAT)
+        self.assertEqual(node.evaluate(), 0x1122334455667788)
+        self.assertTrue(self.ctx.isMemorySymbolized(MemoryAccess(0x1ffc, CPUSIZE.QWORD)))
+
+        self.ctx.concretizeMemory(0x2000)
+        node = self.ctx.getMemoryAst(MemoryAccess(0x1ffc, CPUSIZE.QWORD))
+        self.assertEqual(node.getType(), AST_NODE.BV)
+        self.assertFalse(self.ctx.isMemorySymbolized(MemoryAccess(0x1ffc, CPUSIZE.QWORD)))
+        return
+
+
+    def test_overlapping_store(self):
+        self.ctx.setMode(MODE.ALIGNED_MEMORY, True)
+
+        self.ctx.processing(Instruction(b"\x48\xc7\xc0\x01\x00\x00\x00")) # mov rax, 1
+        self.ctx.processing(Instruction(b"\x48\x89\x03"))                 # mov [rbx], rax
+        self.ctx.processing(Instruction(b"\x88\x43\x07"))                 # mov [rbx+7], al
+
+        # The aligned qword has been overwritten
+        rcx = self.ctx.getMemoryAst(MemoryAccess(0, CPUSIZE.QWORD))
+        self.assertEqual(rcx.getType(), AST_NODE.CONCAT)
+        self.assertEqual(rcx.evaluate(), 0x0100000000000001)
+        return
@@ -429,6 +429,31 @@ class TestTaint(unittest.TestCase):
         self.assertTrue(0x4003 in m)
         self.assertFalse(0x5000 in m)
 
+    def test_taint_memory_areas(self):
+        """Check tainting unaligned memory areas and areas across pages."""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        Triton.taintMemory(MemoryAccess(0x1ffc, 8))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x1ff8, 8)))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x2000, 8)))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x1ff0, 8)))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x2004, 8)))
+        self.assertEqual(len(Triton.getTaintedMemory()), 8)
+
+        Triton.taintAssignment(MemoryAccess(0x3fe1, 64), MemoryAccess(0x1fe0, 64))
+        self.assertEqual(sorted(Triton.getTaintedMemory())[8:], list(range(0x3ffd, 0x4005)))
+
+        Triton.untaintMemory(MemoryAccess(0x1fff, 2))
+        Triton.taintUnion(MemoryAccess(0x3fe1, 64), MemoryAccess(0x1fe0, 64))
+        self.assertEqual(sorted(Triton.getTaintedMemory())[6:], list(range(0x3ffd, 0x4005)))
+
+        Triton.taintAssignment(MemoryAccess(0x3fe1, 64), MemoryAccess(0x1fe0, 64))
+        self.assertFalse(Triton.isMemoryTainted(0x4000))
+        self.assertFalse(Triton.isMemoryTainted(0x4001))
+        self.assertTrue(Triton.isMemoryTainted(0x4002))
+        self.assertEqual(len(Triton.getTaintedMemory()), 12)
+
     def test_taint_set_register(self):
         """Set taint register"""
         Triton = TritonContext()
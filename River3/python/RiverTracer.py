@@ -1,7 +1,7 @@
 import RiverUtils
 from RiverUtils import Input
 from typing import List, Dict, Set
-from triton import TritonContext, ARCH, Instruction, MemoryAccess, CPUSIZE, MODE
+from triton import TritonContext, ARCH, Instruction, MemoryAccess, CPUSIZE, MODE, STOP
 import logging
 
 # Some constants
@@ -28,8 +28,11 @@ class RiverTracer:
 		self.context.setMode(MODE.ALIGNED_MEMORY, True)
 		if symbolized:
 			self.context.setMode(MODE.ONLY_ON_SYMBOLIZED, True)
+			self.context.setMode(MODE.AST_HASH_CONSING, True) # Share identical sub-trees between the expressions of long traces
 			# symbolicContext.setMode(MODE.AST_OPTIMIZATIONS, True)
 			# symbolicContext.setMode(MODE.CONSTANT_FOLDING, True)
+		else:
+			self.context.setMode(MODE.CONCRETE_ONLY, True) # Common instructions run without building ASTs, used by the scoring runs
 
 		# The set of basic blocks found so far by this tracer.
 		self.allBlocksFound: Set[int] = set()
@@ -37,6 +40,7 @@ class RiverTracer:
 		self.entryFuncAddr = None # Entry function address
 		self.codeSection_begin = None # Where the code section begins and ends
 		self.codeSection_end = None
+		self.initialSnapshot = None # Context state right after the binary was loaded, restored before each run
 
 		# Create the cache of symbolic variables if they are to be keep fixed.
 		inputMaxLenPlusSentinelSize = self.maxInputSize + RiverUtils.SENTINEL_SIZE
@@ -84,33 +88,27 @@ class RiverTracer:
 				newBasicBlocksFound.add(addr)
 				self.allBlocksFound.add(addr)
 
-		onBasicBlockFound(currentBBlockAddr)
-
 		logging.info('[+] Starting emulation.')
-		while pc and (pc >= self.codeSection_begin and pc <= self.codeSection_end):
-			# Fetch opcode
-			opcode = self.context.getConcreteMemoryAreaValue(pc, 16)
-
-			# Create the ctx instruction
-			instruction = Instruction()
-			instruction.setOpcode(opcode)
-			instruction.setAddress(pc)
-
-			# Process
-			self.context.processing(instruction)
-			logging.info(instruction)
-
-			# Next
-			prevpc = pc
-			pc = self.context.getConcreteRegisterValue(self.context.registers.rip)
-
-			if instruction.isControlFlow():
-				currentBBlockAddr = pc
-				onBasicBlockFound(currentBBlockAddr)
-				logging.info(f"Instruction is control flow of type {instruction.getType()}. Addr of the new Basic block {hex(currentBBlockAddr)}")
-
-			if self.TARGET_TO_REACH is not None and pc == self.TARGET_TO_REACH:
-				targetAddressFound = True
+		# The instructions run natively, decoded once and cached, until the program counter leaves the code section.
+		# The target may be in the middle of a block, so the run stops on it first and then goes on from there.
+		endAddress = 0 if self.TARGET_TO_REACH is None else self.TARGET_TO_REACH
+		result = self.context.run(pc, endAddress, self.codeSection_begin, self.codeSection_end)
+		blocks = result['blocks']
+		count = result['count']
+		if endAddress != 0 and result['reason'] == STOP.END_ADDRESS:
+			targetAddressFound = True
+			# the first block of the next run is only where it resumes
+			result = self.context.run(result['pc'], 0, self.codeSection_begin, self.codeSection_end)
+			blocks += result['blocks'][1:]
+			count += result['count']
+
+		if result['reason'] == STOP.UNSUPPORTED:
+			logging.warning(f"Emulation stopped on an unsupported instruction at {hex(result['pc'])}")
+		logging.info(f"Emulation stopped at {hex(result['pc'])} after {count} instructions")
+
+		# The first block is the entry point, the next ones start after a control flow instruction
+		for currentBBlockAddr in blocks:
+			onBasicBlockFound(currentBBlockAddr)
 
 		logging.info('[+] Emulation done.')
 		if countBBlocks:
@@ -204,6 +202,9 @@ class RiverTracer:
 		return
 
 	def runInput(self, inputToTry : RiverUtils.Input, symbolized : bool, countBBlocks : bool):
+		# Drop the heap, stack, symbolic expressions and path constraints of the previous run
+		self.ResetMem()
+
 		# Init context memory
 		self.__initContext(inputToTry, symbolized=symbolized)
 
@@ -222,6 +223,23 @@ class RiverTracer:
 		assert self.symbolized == True, "you try to solve inputs using a non-symbolic tracer context !"
 
 		model = self.context.getModel(constraint)
+		return self.__modelToInputChanges(model)
+
+	# Ask for the input changes of all the branches not taken by the last run, starting from the path constraint at index bound.
+	# The whole path is solved in one native call, returns a list of (path constraint index, changes) for the branches that can be taken
+	def solveInputChangesForBranchFlips(self, pathConstraints, bound):
+		assert self.symbolized == True, "you try to solve inputs using a non-symbolic tracer context !"
+
+		res = []
+		for flip in self.context.solveBranchFlips(pathConstraints, bound):
+			changes = self.__modelToInputChanges(flip['model'])
+			if changes:
+				res.append((flip['pcIndex'], changes))
+
+		return res
+
+	# Put all the changed bytes of a model (map from index to value) in a dictionary
+	def __modelToInputChanges(self, model):
 		changes = dict()  # A dictionary  from byte index (relative to input buffer beginning) to the value it has in he model
 		for k, v in list(model.items()):
 			# Get the symbolic variable assigned to the model
@@ -270,12 +288,15 @@ class RiverTracer:
 				vaddr = phdr.virtual_address
 				logging.info('[+] Loading 0x%06x - 0x%06x' % (vaddr, vaddr + size))
 				tracersInstances[tracerIndex].context.setConcreteMemoryAreaValue(vaddr, phdr.content.tolist())
-				#assert False, "Check where is stack and heap and reset them "
+
+			# Memory pages are shared with the snapshot, a reset only copies back what a run has written
+			tracersInstances[tracerIndex].initialSnapshot = tracersInstances[tracerIndex].context.takeSnapshot()
 
 	def throwStats(self, target):
 		target.onAddNewStatsFromTracer(self.allBlocksFound)
 		self.allBlocksFound.clear()
 
+	# Restores the context state taken after the binary was loaded
 	def ResetMem(self):
-		# TODO
-		pass
\ No newline at end of file
+		if self.initialSnapshot is not None:
+			self.context.restoreSnapshot(self.initialSnapshot)
\ No newline at end of file
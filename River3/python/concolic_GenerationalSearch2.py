@@ -36,48 +36,20 @@ def Expand(symbolicTracer : RiverTracer, inputToTry):
     # Get path constraints from the last execution
     PathConstraints = symbolicTracer.getLastRunPathConstraints()
 
-    # Get the astContext
-    astCtxt = symbolicTracer.getAstContext()
-
-    # This represents the current path constraint, dummy initialization
-    currentPathConstraint = astCtxt.equal(astCtxt.bvtrue(), astCtxt.bvtrue())
-
-    # Go through the path constraints from bound of the input (to prevent backtracking as described in the paper)
-    PCLen = len(PathConstraints)
-    for pcIndex in range(inputToTry.bound, PCLen):
-        pc = PathConstraints[pcIndex]
-
-        # Get all branches
-        branches = pc.getBranchConstraints()
-
-        if RECONSTRUCT_BB_GRAPH:
-            # Put all detected edges in the graph
-            for branch in branches:
+    if RECONSTRUCT_BB_GRAPH:
+        # Put all detected edges in the graph
+        for pc in PathConstraints[inputToTry.bound:]:
+            for branch in pc.getBranchConstraints():
                 onEdgeDetected(branch['srcAddr'], branch['dstAddr'])
 
-        # If there is a condition on this path (not a direct jump), try to reverse it
-        if pc.isMultipleBranches():
-            takenAddress = pc.getTakenAddress()
-            for branch in branches:
-                # Get the constraint of the branch which has been not taken
-                if branch['dstAddr'] != takenAddress:
-                    #print(branch['constraint'])
-                    #expr = astCtxt.unroll(branch['constraint'])
-                    #expr = ctx.simplify(expr)
-
-                    # Check if we can change current executed path with the branch changed
-                    desiredConstrain = astCtxt.land([currentPathConstraint, branch['constraint']])
-                    changes = symbolicTracer.solveInputChangesForPath(desiredConstrain)
-
-                    # Then, if a possible change was detected => create a new input entry and add it to the output list
-                    if changes:
-                        newInput = copy.deepcopy(inputToTry)
-                        newInput.applyChanges(changes)
-                        newInput.bound = pcIndex + 1
-                        inputs.append(newInput)
-
-        # Update the previous constraints with taken(true) branch to keep the same path initially taken
-        currentPathConstraint = astCtxt.land([currentPathConstraint, pc.getTakenPredicate()])
+    # Try to reverse each condition on the path from the bound of the input (to prevent backtracking as described in the paper),
+    # keeping the branches taken before it. All the branches are solved in one call sharing the path prefix.
+    for pcIndex, changes in symbolicTracer.solveInputChangesForBranchFlips(PathConstraints, inputToTry.bound):
+        # A possible change was detected => create a new input entry and add it to the output list
+        newInput = copy.deepcopy(inputToTry)
+        newInput.applyChanges(changes)
+        newInput.bound = pcIndex + 1
+        inputs.append(newInput)
 
     # Clear the path constraints to be clean at the next execution.
     symbolicTracer.resetLastRunPathConstraints()